@@ -18,6 +18,8 @@
 #   find_package(SFML 2 COMPONENTS system window graphics)
 #   find_package(TGUI 0.6)
 #
+# When linking statically, the libraries that TGUI depends on must be linked as well. They are listed in TGUI_DEPENDENCIES.
+#
 # If TGUI is not installed in a standard path, you can use the TGUI_ROOT CMake (or environment) variable
 # to tell CMake where TGUI is.
 #
@@ -30,13 +32,14 @@
 # - TGUI_LIBRARY:         the name of the library to link to (includes both debug and optimized names if necessary)
 # - TGUI_FOUND:           true if either the debug or release library is found
 # - TGUI_INCLUDE_DIR:     the path where TGUI headers are located (the directory containing the TGUI/Config.hpp file)
+# - TGUI_DEPENDENCIES:    the list of libraries TGUI depends on, in case of static linking
 #
 # example:
 #   find_package(SFML 2 COMPONENTS system window graphics REQUIRED)
 #   find_package(TGUI 0.6 REQUIRED)
 #   include_directories(${SFML_INCLUDE_DIR} ${TGUI_INCLUDE_DIR})
 #   add_executable(myapp ...)
-#   target_link_libraries(myapp ${SFML_LIBRARIES} ${TGUI_LIBRARY})
+#   target_link_libraries(myapp ${TGUI_LIBRARY} ${TGUI_DEPENDENCIES} ${SFML_LIBRARIES} ${SFML_DEPENDENCIES})
 #
 
 # deduce the libraries suffix from the options
@@ -132,6 +135,26 @@ endif()
 # mark variables as advanced so that they won't show up unless the 'advanced' option is checked
 mark_as_advanced(TGUI_LIBRARY TGUI_LIBRARY_RELEASE TGUI_LIBRARY_DEBUG)
 
+# in case of static linking, the dependencies of TGUI have to be found as well
+set(TGUI_DEPENDENCIES)
+set(FIND_TGUI_DEPENDENCIES_NOTFOUND)
+if(TGUI_FOUND AND SFML_STATIC_LIBRARIES)
+    # the clipboard uses X11 and a separate thread on linux and freebsd
+    if((${CMAKE_SYSTEM_NAME} MATCHES "Linux") OR (${CMAKE_SYSTEM_NAME} MATCHES "FreeBSD"))
+        find_package(X11 QUIET)
+        find_package(Threads QUIET)
+
+        if(NOT X11_X11_LIB)
+            set(FIND_TGUI_DEPENDENCIES_NOTFOUND "${FIND_TGUI_DEPENDENCIES_NOTFOUND} X11")
+        endif()
+        if(NOT Threads_FOUND)
+            set(FIND_TGUI_DEPENDENCIES_NOTFOUND "${FIND_TGUI_DEPENDENCIES_NOTFOUND} Threads")
+        endif()
+
+        set(TGUI_DEPENDENCIES ${X11_X11_LIB} ${CMAKE_THREAD_LIBS_INIT})
+    endif()
+endif()
+
 # handle errors
 if(NOT TGUI_VERSION_OK)
     # TGUI version not ok
@@ -140,6 +163,10 @@ if(NOT TGUI_VERSION_OK)
 elseif(NOT TGUI_FOUND)
     # include directory or library not found
     set(FIND_TGUI_ERROR "Could NOT find TGUI")
+elseif(FIND_TGUI_DEPENDENCIES_NOTFOUND)
+    # dependencies of the static library not found
+    set(FIND_TGUI_ERROR "TGUI found but some of its dependencies are missing (${FIND_TGUI_DEPENDENCIES_NOTFOUND})")
+    set(TGUI_FOUND FALSE)
 endif()
 if (NOT TGUI_FOUND)
     if(TGUI_FIND_REQUIRED)
@@ -0,0 +1,88 @@
+#include <TGUI/TGUI.hpp>
+
+#include <iomanip>
+#include <iostream>
+
+// The amount of widgets on the screen that is rebuilt in every round
+const unsigned int WidgetCount = 2000;
+const unsigned int Rounds = 50;
+
+struct Timings
+{
+    sf::Time create;
+    sf::Time teardown;
+};
+
+// Widgets that are created on their own get their memory from operator new before they are added to the panel
+void createWithNew(tgui::Panel& panel)
+{
+    for (unsigned int i = 0; i < WidgetCount / 4; ++i)
+    {
+        tgui::Label::Ptr label;
+        panel.add(label);
+
+        tgui::Button::Ptr button;
+        panel.add(button);
+
+        tgui::Checkbox::Ptr checkbox;
+        panel.add(checkbox);
+
+        tgui::EditBox::Ptr editBox;
+        panel.add(editBox);
+    }
+}
+
+// Widgets that are created for the panel get their memory from the arena of the panel
+void createInArena(tgui::Panel& panel)
+{
+    for (unsigned int i = 0; i < WidgetCount / 4; ++i)
+    {
+        tgui::Label::Ptr label(panel);
+        tgui::Button::Ptr button(panel);
+        tgui::Checkbox::Ptr checkbox(panel);
+        tgui::EditBox::Ptr editBox(panel);
+    }
+}
+
+Timings measure(void (*createWidgets)(tgui::Panel&))
+{
+    tgui::Panel::Ptr panel;
+    Timings timings;
+    sf::Clock clock;
+
+    // The first round isn't measured, it lets the arena get its memory from the system
+    for (unsigned int round = 0; round <= Rounds; ++round)
+    {
+        clock.restart();
+        createWidgets(*panel);
+        sf::Time createTime = clock.restart();
+
+        panel->removeAllWidgets();
+        sf::Time teardownTime = clock.restart();
+
+        if (round > 0)
+        {
+            timings.create += createTime;
+            timings.teardown += teardownTime;
+        }
+    }
+
+    return timings;
+}
+
+void print(const char* name, const Timings& timings)
+{
+    std::cout << std::setw(14) << std::left << name << std::fixed << std::setprecision(3)
+              << "create " << timings.create.asSeconds() * 1000 / Rounds << " ms, "
+              << "teardown " << timings.teardown.asSeconds() * 1000 / Rounds << " ms" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Creating and removing " << WidgetCount << " widgets, average of " << Rounds << " rounds:" << std::endl;
+
+    print("operator new:", measure(&createWithNew));
+    print("widget arena:", measure(&createInArena));
+
+    return 0;
+}
@@ -56,6 +56,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         AnimatedPicture(const AnimatedPicture& copy);
+        AnimatedPicture(AnimatedPicture&& other); ///< Move constructor
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -74,6 +75,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         AnimatedPicture& operator= (const AnimatedPicture& right);
+        AnimatedPicture& operator= (AnimatedPicture&& right); ///< Move assignment operator
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +99,65 @@ namespace tgui
         bool addFrame(const std::string& filename, sf::Time frameDuration = sf::Time());
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Add frames that are packed together in a single image.
+        ///
+        /// \param filename       The filename of the image that contains the frames.
+        /// \param rows           The amount of rows of frames in the image.
+        /// \param columns        The amount of columns of frames in the image.
+        /// \param frameDuration  The amount of time that each frame will be displayed on the screen.
+        /// \param frameCount     The amount of frames to add. When 0 (default), every cell of the image becomes a frame.
+        ///
+        /// The image is divided in rows and columns of equal size, like in SpriteSheet. The frames are added from left to
+        /// right, one row after the other.
+        ///
+        /// All frames use the same texture, so switching frames only changes which part of the texture is drawn.
+        /// Other animated pictures that load the same image also share the texture.
+        ///
+        /// \return True when the frames were added.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addFrames(const std::string& filename, unsigned int rows, unsigned int columns, sf::Time frameDuration = sf::Time(), unsigned int frameCount = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Add frames that are packed together in a single image.
+        ///
+        /// \param filename       The filename of the image that contains the frames.
+        /// \param frameRects     The part of the image that is used by every frame, in the order that they are displayed.
+        /// \param frameDuration  The amount of time that each frame will be displayed on the screen.
+        ///
+        /// All frames use the same texture, so switching frames only changes which part of the texture is drawn.
+        /// Other animated pictures that load the same image also share the texture.
+        ///
+        /// \return True when the frames were added.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addFrames(const std::string& filename, const std::vector<sf::IntRect>& frameRects, sf::Time frameDuration = sf::Time());
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Plays the frames directly from the files instead of loading them all in advance.
+        ///
+        /// \param filenames        The filenames of the images, in the order in which they are displayed.
+        /// \param frameDuration    The amount of time that each frame will be displayed on the screen.
+        /// \param preloadedFrames  The amount of frames that are loaded ahead of the displayed frame.
+        ///
+        /// This is meant for long animations that would use too much memory when all frames were kept loaded.
+        /// A separate thread loads the next few frames from their files while the animation is playing. A frame is
+        /// forgotten once it has been displayed, so only a single texture and the preloaded images are kept in memory.
+        /// This function waits until the first frame has been loaded. When a later frame isn't loaded in time, the previous
+        /// frame simply remains visible until the thread has loaded it.
+        ///
+        /// All frames that were added before are removed. While the frames are streamed, addFrame, addFrames and
+        /// removeFrame can't be used. Call removeAllFrames to stop streaming.
+        ///
+        /// \return True when the first frame could be loaded.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadStreamedFrames(const std::vector<std::string>& filenames, sf::Time frameDuration = sf::Time(), unsigned int preloadedFrames = 4);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the size of the displayed image.
         ///
@@ -296,6 +357,13 @@ namespace tgui
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns the time until the next frame has to be displayed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time getTimeUntilNextUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         // Draws the widget on the render target.
@@ -303,6 +371,22 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Displays a frame when the frames are streamed. When the frame hasn't been loaded yet, the current texture remains
+        // visible and the widget keeps being updated until it is available, unless wait is true in which case it waits for it.
+        // Returns false when the image of the frame couldn't be loaded, the previous frame then remains visible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool showStreamedFrame(unsigned int frame, bool wait);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns whether the frames are streamed and the thread hasn't loaded the frame that should be displayed yet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isWaitingForStreamedFrame() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       public:
 
@@ -326,6 +410,11 @@ namespace tgui
 
         bool m_Playing;
         bool m_Looping;
+
+        // The thread and the frames when the frames are streamed from files, which is only used inside AnimatedPicture.cpp.
+        // It is a nullptr when the frames are stored in m_Textures.
+        struct StreamData;
+        StreamData* m_Stream;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
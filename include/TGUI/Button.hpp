@@ -58,6 +58,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Button(const Button& copy);
+        Button(Button&& other); ///< Move constructor
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,6 +77,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Button& operator= (const Button& right);
+        Button& operator= (Button&& right); ///< Move assignment operator
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -52,7 +52,7 @@ namespace tgui
         // How did the callbak occur?
         unsigned int trigger;
 
-        // Pointer to the widget
+        // Pointer to the widget. Construct a WeakWidgetPtr from it when the widget is needed after the callback was handled.
         Widget* widget;
 
         // The type of the widget
@@ -58,6 +58,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ChatBox(const ChatBox& copy);
+        ChatBox(ChatBox&& other); ///< Move constructor
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,6 +77,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ChatBox& operator= (const ChatBox& right);
+        ChatBox& operator= (ChatBox&& right); ///< Move assignment operator
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -73,6 +73,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ChildWindow(const ChildWindow& copy);
+        ChildWindow(ChildWindow&& other); ///< Move constructor
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -91,6 +92,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ChildWindow& operator= (const ChildWindow& right);
+        ChildWindow& operator= (ChildWindow&& right); ///< Move assignment operator
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,6 +56,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ClickableWidget(const ClickableWidget& copy);
+        ClickableWidget(ClickableWidget&& other); ///< Move constructor
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -74,6 +75,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ClickableWidget& operator= (const ClickableWidget& right);
+        ClickableWidget& operator= (ClickableWidget&& right); ///< Move assignment operator
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,12 +29,24 @@
 
 #include <TGUI/Global.hpp>
 
+#include <functional>
+#include <vector>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Gives access to the clipboard of the operating system.
+    ///
+    /// On Windows the system clipboard is used once the window handle is set.
+    /// On Linux and FreeBSD the X11 CLIPBOARD selection is used, through a separate connection to the X server that is
+    /// opened the first time the clipboard is accessed. When no X server can be reached then the clipboard only works
+    /// inside the application.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API Clipboard : public sf::NonCopyable
     {
       public:
@@ -58,10 +70,51 @@ namespace tgui
         ///
         /// \return Contents of the clipboard
         ///
+        /// On X11 the contents have to be requested from the application that owns the clipboard. This function doesn't wait
+        /// for them: it returns the last known contents and asks for the new contents in the background. Use requestContents
+        /// when you need the current contents, e.g. when pasting.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         sf::String get();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Passes the current contents of the clipboard to a function
+        ///
+        /// \param function  Function that will be called with the contents of the clipboard
+        ///
+        /// When the contents are known then the function is called immediately. On X11 the contents of another application
+        /// first have to arrive, the function is then called from the update function. When the other application doesn't
+        /// respond within a second then the function receives the last known contents.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestContents(const std::function<void(const sf::String&)>& function);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Passes the contents that arrived in the background to the functions that are waiting for them
+        ///
+        /// The gui calls this function every time it is drawn. You only have to call it yourself when you use the clipboard
+        /// without a gui, getTimeUntilUpdate tells you when.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Find out when the update function has to be called for the functions that are waiting for the contents
+        ///
+        /// The clipboard can't wake up the application when the contents arrive, so it has to be polled while functions are
+        /// waiting. The gui takes this into account in its needsRedraw and getTimeUntilNextRedraw functions.
+        ///
+        /// \param time  Time after which update has to be called, only changed when the function returns true
+        ///
+        /// \return Are there functions waiting for the contents of the clipboard?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getTimeUntilUpdate(sf::Time& time) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the contents of the clipboard
         ///
@@ -76,10 +129,23 @@ namespace tgui
         ///
         /// \param windowHandle  Handle to the window
         ///
+        /// The window handle isn't needed on X11, where the clipboard uses a hidden window of its own.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setWindowHandle(const sf::WindowHandle& windowHandle);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+    #if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Connects to the X server the first time that the clipboard is used. Returns false when there is no X server.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool connectToX11();
+    #endif
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -87,6 +153,17 @@ namespace tgui
         sf::WindowHandle m_windowHandle;
         bool m_isWindowHandleSet;
 
+    #if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD)
+        // Everything related to X11, which is only used inside Clipboard.cpp so that the X11 headers aren't needed here.
+        // It stays a nullptr until the clipboard is used, and also when no connection to the X server could be made.
+        struct X11Data;
+        X11Data* m_x11;
+        bool m_x11Unavailable;
+
+        // The functions that are waiting until the contents arrive from another application
+        std::vector< std::function<void(const sf::String&)> > m_pendingRequests;
+    #endif
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -56,6 +56,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ComboBox(const ComboBox& copy);
+        ComboBox(ComboBox&& other); ///< Move constructor
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -74,6 +75,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ComboBox& operator= (const ComboBox& right);
+        ComboBox& operator= (ComboBox&& right); ///< Move assignment operator
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,6 +324,40 @@ namespace tgui
         int addItem(const sf::String& itemName, int id = 0);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes all items from the list and adds the given items instead.
+        ///
+        /// \param itemNames  The names of the items that you want to add
+        /// \param ids        Optional ids given to the items, the item at index i gets the id at index i.
+        ///                   Items for which no id was given get 0 as id.
+        ///
+        /// Pass the vectors with std::move to avoid copying the items.
+        ///
+        /// \return The amount of items that were added.
+        ///         This is less than the amount of items passed when the list can't contain all of them.
+        ///
+        /// \see addItems
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int setItems(std::vector<sf::String> itemNames, std::vector<int> ids = std::vector<int>());
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Adds multiple items to the list at once.
+        ///
+        /// \param itemNames  The names of the items that you want to add
+        /// \param ids        Optional ids given to the items, the item at index i gets the id at index i.
+        ///                   Items for which no id was given get 0 as id.
+        ///
+        /// \return The amount of items that were added.
+        ///         This is less than the amount of items passed when the list can't contain all of them.
+        ///
+        /// \see setItems
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int addItems(std::vector<sf::String> itemNames, std::vector<int> ids = std::vector<int>());
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Selects an item from the list.
         ///
@@ -361,6 +397,19 @@ namespace tgui
         bool setSelectedItem(int index);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Selects the first item from the list that was added with the given id.
+        ///
+        /// \param id  Id that was given to the addItem function
+        ///
+        /// \return
+        ///         - true on success
+        ///         - false when none of the items has the given id
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setSelectedItemById(int id);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Deselects the selected item.
         ///
@@ -447,12 +496,24 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Returns the list that contains all the items.
         ///
+        /// \warning This function may not be called while a model is set (see setModel), the items of the model aren't stored
+        ///          in the combo box.
+        ///
         /// \return The vector of strings
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         std::vector<sf::String>& getItems() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of items in the list.
+        ///
+        /// \return The amount of items, also when they are provided by a model
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getItemCount() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Returns the currently selected item.
         ///
@@ -570,6 +631,64 @@ namespace tgui
         unsigned int getMaximumItems() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes whether the items are kept sorted by name.
+        ///
+        /// \param sorted  Should the items be sorted?
+        ///
+        /// When the items are sorted, new items are inserted at their sorted position instead of at the end of the list and
+        /// searching an item by name no longer has to look at every item. Sorting is disabled by default.
+        ///
+        /// \warning The indices of the items will change when they are sorted.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSorted(bool sorted);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the items are kept sorted by name.
+        ///
+        /// \return Are the items sorted?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSorted() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Lets the combo box display the items of a model instead of its own items.
+        ///
+        /// \param model  The model that provides the items, or nullptr to go back to the items added to the combo box itself
+        ///
+        /// The items that were added to the combo box are removed. While a model is set, the functions that add, remove or
+        /// change items do nothing and getItems may not be called. Only the items that are displayed are requested from
+        /// the model. The items of the model are also left out of the Items property.
+        ///
+        /// The combo box doesn't take ownership of the model, it has to stay alive while the combo box uses it.
+        ///
+        /// \see modelChanged
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setModel(ListBoxModel* model);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the model that provides the items.
+        ///
+        /// \return The model that was passed to setModel, or nullptr when the combo box uses its own items
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ListBoxModel* getModel() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Tells the combo box that the items in the model were changed.
+        ///
+        /// This function has to be called after items were added to, removed from or changed in the model.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void modelChanged();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the transparency of the widget.
         ///
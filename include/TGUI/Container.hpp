@@ -36,6 +36,7 @@
 namespace tgui
 {
     struct Callback;
+    class WidgetArena;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Parent class for widgets that store multiple widgets.
@@ -61,6 +62,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Container(const Container& copy);
+        Container(Container&& containerToMove); ///< Move constructor
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -79,6 +81,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Container& operator= (const Container& right);
+        Container& operator= (Container&& right); ///< Move assignment operator
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -347,6 +350,33 @@ namespace tgui
         void moveWidgetToBack(Widget *const widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes whether the container should remember the bounds of its widgets between frames.
+        ///
+        /// \param cache  Should the bounds of the widgets be cached?
+        ///
+        /// Widgets that lie completely outside the visible area of the container are not drawn. To find these widgets, the
+        /// bounds of every widget have to be checked each frame. With thousands of widgets you can let the container cache
+        /// these bounds. They are only recalculated in the frames after a widget inside the container has changed.
+        ///
+        /// The bounds are not cached by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void cacheWidgetBounds(bool cache = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Tells the container that the position or size of one of its widgets has changed.
+        ///
+        /// This is only needed when the bounds are being cached and a widget changed without telling its parent, e.g. a custom
+        /// widget that doesn't call invalidate. Adding, removing, reordering and changing widgets already does this.
+        ///
+        /// \see cacheWidgetBounds
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateWidgetBounds();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the transparency of the widget.
         ///
@@ -506,11 +536,34 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function is called every frame.
+        // This function is called when one of the widgets inside the container has to be updated.
+        // Only the widgets that are animating receive the elapsed time.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the first of the animating widgets inside the container has to be updated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time getTimeUntilNextUpdate() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called by the widgets inside the container when they start or stop animating.
+        // The container will itself be animating as long as one of its widgets is.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addAnimatedWidget(Widget* widget);
+        void removeAnimatedWidget(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called by the widgets inside the container to start or stop tweening their properties.
+        // The tweens of all widgets in the container are updated together.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addTween(const Tween& tween);
+        void removeTweens(const Widget* widget);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // When this function is called then all the widgets receive the event (if there are widgets).
         // The function returns true when the event is consumed and false when the event was ignored by all widgets.
@@ -540,26 +593,109 @@ namespace tgui
         Widget::Ptr mouseOnWhichWidget(float x, float y);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers which widget is below the mouse. The widget that was below the mouse before is told that the mouse left it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setHoveredWidget(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget still has to be told when the left mouse button is released.
+        // This is the case when the mouse went down on it, or on one of its widgets when it is a container.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isWidgetPressed(const Widget& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the widgets in m_PressedWidgets that the left mouse button was released, except for the widget that
+        // already received the release event itself. Widgets that are no longer pressed are removed from the list.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void releasePressedWidgets(const Widget* releasedWidget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rebuilds m_WidgetFlags when widgets were added, removed or reordered, or when one of them was shown, hidden,
+        // enabled or disabled since the last time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgetFlags() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called by the widgets in this container when they are shown, hidden, enabled or disabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetStateChanged();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will call the draw function from all the widgets.
+        // The clipping area is the scissor box that the caller has set, in pixels counting from the top left of the target.
+        // It is passed on so that the widgets outside it can be skipped without asking OpenGL for it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states, const sf::IntRect& clippingArea) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the arena from which the widgets that are created for this container are allocated.
+        // The arena is only created when the first widget is created with the container as parameter.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
+        WidgetArena* getWidgetArena();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
+        // The bits that are stored for every widget in m_WidgetFlags
+        enum WidgetFlag
+        {
+            WidgetFlagVisible       = 1, ///< The widget is drawn
+            WidgetFlagReceivesMouse = 2  ///< The widget is visible and enabled, so it can be below the mouse
+        };
+
         std::vector<Widget::Ptr> m_Widgets;
         std::vector<sf::String>  m_ObjName;
 
         // The focused widget
         Widget* m_FocusedWidget;
 
+        // The widgets on which the left mouse button went down. Only these widgets have to be told when it is released.
+        std::vector<Widget::Ptr> m_PressedWidgets;
+
+        // The widget below the mouse. Only this widget has to be told when the mouse leaves it.
+        Widget* m_HoveredWidget;
+
         sf::Font m_GlobalFont;
 
         // A list that stores all functions that receive callbacks triggered by child widgets
         std::list< std::function<void(const Callback&)> > m_GlobalCallbackFunctions;
 
+        // The widgets that are currently animating and thus have to receive the elapsed time
+        std::vector<Widget::Ptr> m_AnimatedWidgets;
+
+        // Is update looping through the animated widgets? Widgets that stop animating are then only cleared from the list.
+        bool m_UpdatingAnimations;
+
+        // The tweens that are changing the properties of the widgets in this container
+        Tweener m_Tweener;
+
+        // The state of the widgets that drawing and hit-testing check for every widget, stored next to each other in the same
+        // order as m_Widgets. The widgets themselves don't have to be accessed to skip the hidden and disabled ones.
+        mutable bool m_WidgetFlagsNeedUpdate;
+        mutable std::vector<unsigned char> m_WidgetFlags;
+
+        // The bounds of the widgets, only used when m_CacheWidgetBounds is true
+        bool m_CacheWidgetBounds;
+        mutable bool m_WidgetBoundsNeedUpdate;
+        mutable std::vector<sf::FloatRect> m_WidgetBounds;
+
+        // The memory pool for widgets created for this container, nullptr until it is needed
+        WidgetArena* m_WidgetArena;
+
+
+        friend class Widget;
+
+        template <class T>
+        friend class SharedWidgetPtr;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -575,6 +711,12 @@ namespace tgui
         typedef SharedWidgetPtr<Container> Ptr;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GuiContainer();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Unbind the global callback function(s).
         ///
@@ -627,11 +769,23 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when one of the widgets changed. Remembers that the window has to be redrawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
         sf::RenderTarget* m_Window;
 
+        // Did something change since the last time the gui was drawn?
+        bool m_NeedsRedraw;
+
 
         friend class Gui;
 
@@ -27,6 +27,7 @@
 
 
 #include <TGUI/ClickableWidget.hpp>
+#include <TGUI/TextHistory.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -75,6 +76,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         EditBox(const EditBox& copy);
+        EditBox(EditBox&& other); ///< Move constructor
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -93,6 +95,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         EditBox& operator= (const EditBox& right);
+        EditBox& operator= (EditBox&& right); ///< Move assignment operator
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -263,6 +266,51 @@ namespace tgui
         unsigned int getMaximumCharacters() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Reverts the last change that was made to the text.
+        ///
+        /// \return True when a change was undone, false when there was nothing to undo
+        ///
+        /// Characters that are typed after each other are undone together, one word at a time.
+        /// The user can also undo a change by pressing Ctrl+Z.
+        ///
+        /// Changing the text with setText forgets all changes that were made before.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool undo();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Makes the last change that was undone again.
+        ///
+        /// \return True when a change was redone, false when there was nothing to redo
+        ///
+        /// The user can also redo a change by pressing Ctrl+Y or Ctrl+Shift+Z.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool redo();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the amount of memory that may be used to remember the changes that can be undone.
+        ///
+        /// \param bytes  The maximum amount of memory in bytes. Set it to 0 to disable undo.
+        ///
+        /// The limit is 1 MB by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setUndoMemoryLimit(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of memory that may be used to remember the changes that can be undone.
+        ///
+        /// \return The maximum amount of memory in bytes
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getUndoMemoryLimit() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Change the text alignment
         ///
@@ -472,6 +520,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void textEntered(sf::Uint32 Key);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void widgetFocused();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -519,12 +572,58 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the selected characters with the contents of the clipboard. This function is called after pressing ctrl+V,
+        // as soon as the contents of the clipboard are available.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pasteText(const sf::String& contents);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the position of the texts.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateTextPositions();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width that the character at the given index adds to the displayed text, including the kerning with the
+        // character in front of it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getCharacterWidth(unsigned int index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces a part of the text without recalculating the offsets of the characters in front of it.
+        // This is used to undo and redo changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void replaceCharacters(unsigned int position, unsigned int count, const sf::String& characters);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rebuilds the table with the position of every character from scratch.
+        // This has to be called when the displayed text is replaced or when the font or text size changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateCharacterOffsets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the character positions after characters were inserted in the displayed text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertCharacterOffsets(unsigned int index, unsigned int count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the character positions after characters were removed from the displayed text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeCharacterOffsets(unsigned int index, unsigned int count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the character positions from the given index until the end of the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateCharacterOffsets(unsigned int index);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called when the widget is added to a container.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -537,6 +636,12 @@ namespace tgui
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the blinking selection point has to be toggled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time getTimeUntilNextUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -575,6 +680,11 @@ namespace tgui
         sf::String    m_DisplayedText;
         sf::String    m_Text;
 
+        // The width of every displayed character (kerning included) and the position in front of every character.
+        // The offsets contain one more element than there are characters: the last one is the width of the whole text.
+        std::vector<float> m_CharacterWidths;
+        std::vector<float> m_CharacterOffsets;
+
         // This will store the size of the text ( 0 to auto size )
         unsigned int  m_TextSize;
 
@@ -629,6 +739,9 @@ namespace tgui
         bool m_NumbersOnly;
         bool m_SeparateHoverImage;
 
+        // The changes to the text that can be undone and redone
+        TextHistory m_UndoHistory;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     };
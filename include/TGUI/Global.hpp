@@ -105,7 +105,8 @@ namespace tgui
         Type_Panel,
         Type_ChildWindow,
         Type_Grid,
-        Type_MessageBox
+        Type_MessageBox,
+        Type_Table
     };
 }
 
@@ -131,6 +131,24 @@ namespace tgui
         void draw(bool resetView = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Check whether something changed since the gui was last drawn.
+        ///
+        /// Widgets mark the gui as changed when they are added, removed, moved, altered through one of their setters,
+        /// hovered, focused, when they send a callback or react to an event, when an animation step is due and when the
+        /// contents that are being pasted have arrived.
+        /// The flag is cleared by the draw function.
+        ///
+        /// This allows you to only redraw the window when needed. Combined with getTimeUntilNextRedraw,
+        /// the application can wait for events instead of running the main loop continuously.
+        /// Note that the window will still have to be redrawn when anything else that you draw changes.
+        ///
+        /// \return Does the window have to be redrawn?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool needsRedraw() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Get the next callback from the callback queue.
         ///
@@ -501,6 +519,25 @@ namespace tgui
         bool saveWidgetsToFile(const std::string& filename);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Find out how long the gui can remain unchanged because of animations.
+        ///
+        /// Only widgets that are actually animating (e.g. a focused edit box with a blinking selection point or a playing
+        /// animated picture) are taken into account. This allows you to sleep or wait for events instead of redrawing
+        /// the window every frame when nothing is animating.
+        /// While a widget is waiting for the contents of the clipboard, the time until the clipboard has to be checked
+        /// again is also taken into account. The contents are passed to the widget when the gui is drawn.
+        ///
+        /// \param time  Time until the next animation step will happen, only changed when the function returns true
+        ///
+        /// \return
+        ///        - true when a widget is animating or pasting, the window will have to be redrawn after the returned time
+        ///        - false when no widget is animating or pasting, animations are ignored when the window is not focused
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getTimeUntilNextRedraw(sf::Time& time) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update the internal clock to make animation possible. This function is called automatically by the draw function.
         // You will thus only need to call it yourself when you are drawing everything manually.
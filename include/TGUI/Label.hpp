@@ -127,6 +127,9 @@ namespace tgui
         ///
         /// When the text is auto-sized (default), then the size of the label will be changed to fit the whole text.
         ///
+        /// Setting the same text again has no effect. When only a few characters change and the new characters are just as
+        /// wide as the old ones (e.g. digits in most fonts), then only these characters are updated.
+        ///
         /// \see setAutoSize
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -307,6 +310,32 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rebuilds the quads of all characters from the glyphs in the font.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateGeometry();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tries to only replace the quads of the characters that differ from the current text. This is only possible when the
+        // text has the same length and the new characters take up exactly the same space as the ones they replace.
+        // Returns false when the text was not changed, in which case the whole geometry has to be rebuilt.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateChangedCharacters(const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places the quad of a single character at the given pen position.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCharacterQuad(unsigned int vertexIndex, const sf::Glyph& glyph, const sf::Vector2f& position);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the bounds of the text from the quads and repositions the text and background.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTextBounds();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       public:
 
@@ -327,7 +356,25 @@ namespace tgui
 
         sf::RectangleShape m_Background;
 
-        sf::Text m_Text;
+        // The properties of the text
+        sf::String      m_String;
+        const sf::Font* m_Font;
+        unsigned int    m_TextSize;
+        sf::Uint32      m_TextStyle;
+        sf::Color       m_TextColor;
+
+        // The quads of all characters and the position at which the text is drawn
+        sf::VertexArray m_Vertices;
+        sf::Vector2f    m_TextPosition;
+        sf::FloatRect   m_TextBounds;
+
+        // For every character the index of its first vertex (-1 for whitespace) and its pen position
+        std::vector<int>          m_CharacterVertices;
+        std::vector<sf::Vector2f> m_CharacterPositions;
+
+        // Area covered by the whitespace characters (they are part of the bounds but have no quad)
+        sf::Vector2f m_WhitespaceMin;
+        sf::Vector2f m_WhitespaceMax;
 
         bool m_AutoSize;
 
@@ -27,7 +27,10 @@
 #define TGUI_LIST_BOX_HPP
 
 
+#include <unordered_map>
+
 #include <TGUI/Widget.hpp>
+#include <TGUI/ListBoxModel.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -58,6 +61,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ListBox(const ListBox& copy);
+        ListBox(ListBox&& other); ///< Move constructor
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,6 +80,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ListBox& operator= (const ListBox& right);
+        ListBox& operator= (ListBox&& right); ///< Move assignment operator
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -286,6 +291,43 @@ namespace tgui
         int addItem(const sf::String& itemName, int id = 0);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes all items from the list and adds the given items instead.
+        ///
+        /// \param itemNames  The names of the items that you want to add
+        /// \param ids        Optional ids given to the items, the item at index i gets the id at index i.
+        ///                   Items for which no id was given get 0 as id.
+        ///
+        /// The vectors are taken over by the list box when it was empty, pass them with std::move to avoid copying the items.
+        /// The scrollbar is only updated once, which makes this much faster than calling addItem for every item.
+        ///
+        /// \return The amount of items that were added.
+        ///         This is less than the amount of items passed when the list box can't contain all of them.
+        ///
+        /// \see addItems
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int setItems(std::vector<sf::String> itemNames, std::vector<int> ids = std::vector<int>());
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Adds multiple items to the list at once.
+        ///
+        /// \param itemNames  The names of the items that you want to add
+        /// \param ids        Optional ids given to the items, the item at index i gets the id at index i.
+        ///                   Items for which no id was given get 0 as id.
+        ///
+        /// The scrollbar is only updated once, which makes this much faster than calling addItem for every item.
+        ///
+        /// \return The amount of items that were added.
+        ///         This is less than the amount of items passed when the list box can't contain all of them.
+        ///
+        /// \see setItems
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int addItems(std::vector<sf::String> itemNames, std::vector<int> ids = std::vector<int>());
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Selects an item in the list box.
         ///
@@ -324,6 +366,19 @@ namespace tgui
         bool setSelectedItem(int index);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Selects the first item in the list box that was added with the given id.
+        ///
+        /// \param id  Id that was given to the addItem function
+        ///
+        /// \return
+        ///         - true on success
+        ///         - false when none of the items has the given id
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setSelectedItemById(int id);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Deselects the selected item.
         ///
@@ -408,12 +463,25 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Returns the list of all the items.
         ///
+        /// \warning When the items are sorted, changing the names in the returned list can break the order of the items.
+        /// \warning This function may not be called while a model is set (see setModel), the items of the model aren't stored
+        ///          in the list box.
+        ///
         /// \return The vector of strings
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         std::vector<sf::String>& getItems();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of items in the list.
+        ///
+        /// \return The amount of items, including the ones that are hidden by a filter
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getItemCount() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Returns the currently selected item.
         ///
@@ -553,6 +621,113 @@ namespace tgui
         unsigned int getMaximumItems() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes whether the items are kept sorted by name.
+        ///
+        /// \param sorted  Should the items be sorted?
+        ///
+        /// When the items are sorted, new items are inserted at their sorted position instead of at the end of the list and
+        /// searching an item by name no longer has to look at every item. Items with the same name keep the order in which
+        /// they were added. Sorting is disabled by default.
+        ///
+        /// \warning The indices of the items will change when they are sorted.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSorted(bool sorted);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the items are kept sorted by name.
+        ///
+        /// \return Are the items sorted?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSorted() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Only displays the items for which the given function returns true.
+        ///
+        /// \param filter  Function that receives the name of an item and returns whether the item should be displayed
+        ///
+        /// The items themselves are not changed by the filter, functions like getItem and getItemIndex still use the index
+        /// of the item in the full list. Items that are added or changed while the filter is set are filtered as well.
+        /// Passing an empty function removes the filter.
+        ///
+        /// \see setFilterPrefix
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilter(std::function<bool(const sf::String&)> filter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Only displays the items that start with the given text.
+        ///
+        /// \param prefix  Text with which the displayed items have to start. The comparison is not case sensitive.
+        ///
+        /// When the new prefix starts with the previous one (e.g. when it is updated every time the user types a character)
+        /// then only the items that were still being displayed have to be checked again.
+        /// Passing an empty string removes the filter.
+        ///
+        /// \see setFilter
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilterPrefix(const sf::String& prefix);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes the filter so that all items are displayed again.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFilter();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of items that are displayed with the current filter.
+        ///
+        /// \return The amount of items that passed the filter, or the amount of items in the list when there is no filter
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getFilteredItemCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Lets the list box display the items of a model instead of its own items.
+        ///
+        /// \param model  The model that provides the items, or nullptr to go back to the items added to the list box itself
+        ///
+        /// The items that were added to the list box are removed. While a model is set, the functions that add, remove or
+        /// change items do nothing and getItems may not be called. Only the items that are displayed are requested from
+        /// the model, a page at a time. The items of the model are also left out of the Items property, so they aren't
+        /// saved together with the list box.
+        ///
+        /// The list box doesn't take ownership of the model, it has to stay alive while the list box uses it.
+        ///
+        /// \see modelChanged
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setModel(ListBoxModel* model);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the model that provides the items.
+        ///
+        /// \return The model that was passed to setModel, or nullptr when the list box uses its own items
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ListBoxModel* getModel() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Tells the list box that the items in the model were changed.
+        ///
+        /// This function has to be called after items were added to, removed from or changed in the model.
+        /// The items that were requested earlier are forgotten and the selection is removed when the item no longer exists.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void modelChanged();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the size of the borders.
         ///
@@ -616,6 +791,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void mouseNoLongerDown();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void textEntered(sf::Uint32 key);
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
@@ -655,6 +835,95 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of items that the list box can contain. Without a scrollbar this depends on the size of the list
+        // box. When there is no limit then the maximum value of an unsigned int is returned.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getItemLimit() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sorts the items by name. The items before firstUnsortedItem must already be sorted.
+        // The ids and the selected item move along with their items.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortItems(unsigned int firstUnsortedItem = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the item at index 'from' to index 'to'. The items in between shift one place.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void moveItem(unsigned int from, unsigned int to);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rebuilds the map from ids to item indices when items were inserted or removed in the middle of the list.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemIdIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the item that is displayed at the given row, taking the filter into account.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getItemIndexOfRow(unsigned int row) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the row on which the item is displayed, or -1 when the filter hides the item.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getRowOfItem(unsigned int index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the item passes the current filter.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool passesFilter(const sf::String& item) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Checks all items against the filter again. Only needed when the indices of existing items changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyFilter();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the filtered items after the item at the given index was inserted or changed.
+        // When it was inserted, the indices of the filtered items behind it have to be increased as well.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void filterItem(unsigned int index, bool inserted);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the text starts with the prefix, ignoring the case of ascii letters.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool startsWith(const sf::String& text, const sf::String& prefix);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the name and id of the item with the given index, either from the list box itself or from the model.
+        // A reference returned by getItemName remains valid until another item is requested.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::String& getItemName(unsigned int index) const;
+        int getItemIdAt(unsigned int index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // A range of consecutive items that was requested from the model
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct ModelPage
+        {
+            unsigned int first;
+            std::vector<sf::String> items;
+            std::vector<int> ids;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the page from the model that contains the item with the given index, requesting it from the model when
+        // it isn't in the cache yet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const ModelPage& getModelPage(unsigned int index) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       public:
 
@@ -678,6 +947,34 @@ namespace tgui
         std::vector<sf::String> m_Items;
         std::vector<int> m_ItemIds;
 
+        // When the items are sorted then they can be found with a binary search
+        bool m_Sorted;
+
+        // Maps every id to the indices of the items with that id. Appending items keeps the map up to date, other changes
+        // only mark it as outdated so that it is rebuilt the next time an item is searched by id.
+        std::unordered_map< int, std::vector<unsigned int> > m_ItemIdIndex;
+        bool m_ItemIdIndexNeedsUpdate;
+
+        // When a filter is set then only the items that pass it are displayed. The indices of these items are stored in
+        // ascending order in m_FilteredItems. When there is no filter function then the prefix is used to filter the items.
+        bool m_Filtered;
+        std::function<bool(const sf::String&)> m_FilterFunction;
+        sf::String m_FilterPrefix;
+        std::vector<unsigned int> m_FilteredItems;
+
+        // The characters typed in the list box, used to jump to the first item that starts with them.
+        // The text is forgotten when no character was typed for a second.
+        sf::String m_TypeAheadText;
+        unsigned int m_TypeAheadRow;
+        sf::Clock m_TypeAheadClock;
+
+        // The model that provides the items instead of m_Items (not owned by the list box)
+        ListBoxModel* m_Model;
+        unsigned int m_ModelItemCount;
+
+        // The pages of items that were requested from the model, the most recently used page is in front
+        mutable std::list<ModelPage> m_ModelPages;
+
         // What is the index of the selected item?
         int m_SelectedItem;
 
@@ -0,0 +1,109 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_LIST_BOX_MODEL_HPP
+#define TGUI_LIST_BOX_MODEL_HPP
+
+#include <vector>
+
+#include <TGUI/Global.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Provides the items of a list box or combo box without copying all of them into the widget.
+    ///
+    /// Inherit from this class when the items are stored elsewhere (e.g. in a database or a large array) and pass the model
+    /// to ListBox::setModel. The list box only asks for the items that it has to display, in pages of consecutive items.
+    ///
+    /// The model is not owned by the list box and must stay alive as long as it is being used.
+    /// Call ListBox::modelChanged after items were added, removed or changed.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ListBoxModel
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Virtual destructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual ~ListBoxModel();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of items in the model.
+        ///
+        /// \return Number of items
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual unsigned int getItemCount() const = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the name of an item.
+        ///
+        /// \param index  The index of the item, which is always smaller than the value returned by getItemCount
+        ///
+        /// \return The text that will be displayed for the item
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::String getItem(unsigned int index) const = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the id of an item.
+        ///
+        /// \param index  The index of the item, which is always smaller than the value returned by getItemCount
+        ///
+        /// \return The id of the item. The default implementation returns 0 for every item.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual int getItemId(unsigned int index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the names and ids of a range of consecutive items.
+        ///
+        /// \param first  Index of the first requested item
+        /// \param count  Amount of requested items, the range never goes past the last item
+        /// \param items  Vector to which the names of the items have to be appended
+        /// \param ids    Vector to which the ids of the items have to be appended
+        ///
+        /// The default implementation calls getItem and getItemId for every item. Override this function when a range of items
+        /// can be fetched faster than the items one by one.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void getItems(unsigned int first, unsigned int count, std::vector<sf::String>& items, std::vector<int>& ids) const;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_LIST_BOX_MODEL_HPP
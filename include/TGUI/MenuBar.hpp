@@ -328,6 +328,13 @@ namespace tgui
         unsigned int getMinimumSubMenuWidth() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // While a menu is open, it is drawn below the menu bar.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::FloatRect getDrawBounds() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
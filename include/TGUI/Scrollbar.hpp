@@ -56,6 +56,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Scrollbar(const Scrollbar& copy);
+        Scrollbar(Scrollbar&& other); ///< Move constructor
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -74,6 +75,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Scrollbar& operator= (const Scrollbar& right);
+        Scrollbar& operator= (Scrollbar&& right); ///< Move assignment operator
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -404,11 +406,12 @@ namespace tgui
         Texture m_TextureArrowDownNormal;
         Texture m_TextureArrowDownHover;
 
-        // ListBox, ComboBox and TextBox can access the scrollbar directly
+        // ListBox, ComboBox, TextBox, ChatBox and Table can access the scrollbar directly
         friend class ListBox;
         friend class ComboBox;
         friend class TextBox;
         friend class ChatBox;
+        friend class Table;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -27,16 +27,119 @@
 #define TGUI_SHARED_WIDGET_PTR_HPP
 
 
+#include <TGUI/Config.hpp>
+
 #include <SFML/System/String.hpp>
 
 #include <cstddef>
 
+#ifdef TGUI_ATOMIC_REFCOUNT
+    #include <atomic>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     class Container;
     class Gui;
+    class Widget;
+    class WidgetArena;
+
+    template <class T>
+    class WeakWidgetPtr;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Reference counts that are shared by all SharedWidgetPtr and WeakWidgetPtr objects pointing to the same widget.
+    // When the widget is created by SharedWidgetPtr then the block is allocated together with the widget, in front of it.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API WidgetControlBlock
+    {
+    #ifdef TGUI_ATOMIC_REFCOUNT
+        typedef std::atomic<unsigned int> RefCount;
+    #else
+        typedef unsigned int RefCount;
+    #endif
+
+        WidgetControlBlock(Widget* widgetPtr, bool embeddedWidget, WidgetArena* widgetArena = nullptr, std::size_t allocatedSize = 0) :
+        strongCount   (1),
+        weakCount     (1),
+        widget        (widgetPtr),
+        embedded      (embeddedWidget),
+        arena         (widgetArena),
+        allocationSize(allocatedSize)
+        {
+        }
+
+        void addStrongRef()
+        {
+            ++strongCount;
+        }
+
+        // Used by WeakWidgetPtr, which may only get a new reference when the widget still exists
+        bool addStrongRefIfAlive()
+        {
+        #ifdef TGUI_ATOMIC_REFCOUNT
+            unsigned int count = strongCount.load();
+            while (count != 0)
+            {
+                if (strongCount.compare_exchange_weak(count, count + 1))
+                    return true;
+            }
+            return false;
+        #else
+            if (strongCount == 0)
+                return false;
+
+            ++strongCount;
+            return true;
+        #endif
+        }
+
+        void releaseStrongRef()
+        {
+            if (--strongCount == 0)
+                destroyWidget();
+        }
+
+        void addWeakRef()
+        {
+            ++weakCount;
+        }
+
+        void releaseWeakRef()
+        {
+            if (--weakCount == 0)
+                deallocate();
+        }
+
+        // Returns the offset of a widget of type T when it is allocated together with the control block
+        template <class T>
+        static std::size_t getEmbeddedOffset()
+        {
+            return (sizeof(WidgetControlBlock) + alignof(T) - 1) / alignof(T) * alignof(T);
+        }
+
+        // Destroys the widget when the last SharedWidgetPtr is gone
+        void destroyWidget();
+
+        // Frees the memory of the control block (and of the widget when it was allocated together with it)
+        void deallocate();
+
+        RefCount strongCount;
+
+        // Amount of WeakWidgetPtr objects, plus one as long as there is a SharedWidgetPtr
+        RefCount weakCount;
+
+        Widget* widget;
+
+        // Was the widget allocated together with this control block?
+        bool embedded;
+
+        // The arena from which the control block and widget were allocated, nullptr when they were allocated with new
+        WidgetArena* arena;
+        std::size_t  allocationSize;
+    };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -72,6 +175,15 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        SharedWidgetPtr(SharedWidgetPtr<T>&& other) TGUI_NOEXCEPT;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        template <class U>
+        SharedWidgetPtr(SharedWidgetPtr<U>&& other) TGUI_NOEXCEPT;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         ~SharedWidgetPtr();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -85,10 +197,23 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        SharedWidgetPtr<T>& operator=(SharedWidgetPtr<T>&& other) TGUI_NOEXCEPT;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        template <class U>
+        SharedWidgetPtr<T>& operator=(SharedWidgetPtr<U>&& other) TGUI_NOEXCEPT;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         void init();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        void init(WidgetArena* arena);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         void reset();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -187,7 +312,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        unsigned int* getRefCount() const;
+        unsigned int getRefCount() const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -197,7 +322,82 @@ namespace tgui
       private:
 
         T* m_WidgetPtr;
-        unsigned int* m_RefCount;
+        WidgetControlBlock* m_ControlBlock;
+
+        template <class U>
+        friend class SharedWidgetPtr;
+
+        template <class U>
+        friend class WeakWidgetPtr;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Pointer to a widget that doesn't keep the widget alive.
+    ///
+    /// Use lock() to get a SharedWidgetPtr to the widget, which will be empty when the widget no longer exists.
+    /// It can also be constructed from the raw widget pointer inside a Callback, as long as the widget exists at that moment.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class T>
+    class WeakWidgetPtr
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WeakWidgetPtr();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WeakWidgetPtr(std::nullptr_t);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        explicit WeakWidgetPtr(T* widget);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        template <class U>
+        WeakWidgetPtr(const SharedWidgetPtr<U>& widget);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WeakWidgetPtr(const WeakWidgetPtr<T>& copy);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WeakWidgetPtr(WeakWidgetPtr<T>&& other) TGUI_NOEXCEPT;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ~WeakWidgetPtr();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WeakWidgetPtr<T>& operator=(const WeakWidgetPtr<T>& copy);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WeakWidgetPtr<T>& operator=(WeakWidgetPtr<T>&& other) TGUI_NOEXCEPT;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void reset();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool expired() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        SharedWidgetPtr<T> lock() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        T* m_WidgetPtr;
+        WidgetControlBlock* m_ControlBlock;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
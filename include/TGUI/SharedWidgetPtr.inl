@@ -27,9 +27,12 @@
 #define TGUI_SHARED_WIDGET_PTR_INL
 
 #include <cassert>
+#include <new>
+#include <utility>
 
 #include <TGUI/Container.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/WidgetArena.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -39,7 +42,8 @@ namespace tgui
 
     template <class T>
     SharedWidgetPtr<T>::SharedWidgetPtr() :
-    m_WidgetPtr(nullptr)
+    m_WidgetPtr   (nullptr),
+    m_ControlBlock(nullptr)
     {
         init();
     }
@@ -48,8 +52,8 @@ namespace tgui
 
     template <class T>
     SharedWidgetPtr<T>::SharedWidgetPtr(std::nullptr_t) :
-    m_WidgetPtr(nullptr),
-    m_RefCount (nullptr)
+    m_WidgetPtr   (nullptr),
+    m_ControlBlock(nullptr)
     {
     }
 
@@ -57,9 +61,10 @@ namespace tgui
 
     template <class T>
     SharedWidgetPtr<T>::SharedWidgetPtr(Gui& gui, const sf::String& widgetName) :
-    m_WidgetPtr(nullptr)
+    m_WidgetPtr   (nullptr),
+    m_ControlBlock(nullptr)
     {
-        init();
+        init(gui.m_Container.getWidgetArena());
         gui.m_Container.add(*this, widgetName);
     }
 
@@ -67,49 +72,58 @@ namespace tgui
 
     template <class T>
     SharedWidgetPtr<T>::SharedWidgetPtr(Container& container, const sf::String& widgetName) :
-    m_WidgetPtr(nullptr)
+    m_WidgetPtr   (nullptr),
+    m_ControlBlock(nullptr)
     {
-        init();
+        init(container.getWidgetArena());
         container.add(*this, widgetName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     template <class T>
-    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<T>& copy)
+    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<T>& copy) :
+    m_WidgetPtr   (copy.m_WidgetPtr),
+    m_ControlBlock(copy.m_ControlBlock)
     {
-        if (copy.get() != nullptr)
-        {
-            m_WidgetPtr = copy.get();
-
-            m_RefCount = copy.getRefCount();
-            *m_RefCount += 1;
-        }
-        else
-        {
-            m_WidgetPtr = nullptr;
-            m_RefCount = nullptr;
-        }
+        if (m_ControlBlock != nullptr)
+            m_ControlBlock->addStrongRef();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     template <class T>
     template <class U>
-    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<U>& copy)
+    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<U>& copy) :
+    m_WidgetPtr   (static_cast<T*>(copy.m_WidgetPtr)),
+    m_ControlBlock(copy.m_ControlBlock)
     {
-        if (copy.get() != nullptr)
-        {
-            m_WidgetPtr = static_cast<T*>(copy.get());
+        if (m_ControlBlock != nullptr)
+            m_ControlBlock->addStrongRef();
+    }
 
-            m_RefCount = copy.getRefCount();
-            *m_RefCount += 1;
-        }
-        else
-        {
-            m_WidgetPtr = nullptr;
-            m_RefCount = nullptr;
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    SharedWidgetPtr<T>::SharedWidgetPtr(SharedWidgetPtr<T>&& other) TGUI_NOEXCEPT :
+    m_WidgetPtr   (other.m_WidgetPtr),
+    m_ControlBlock(other.m_ControlBlock)
+    {
+        // The reference is taken over, so the count doesn't change
+        other.m_WidgetPtr = nullptr;
+        other.m_ControlBlock = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    template <class U>
+    SharedWidgetPtr<T>::SharedWidgetPtr(SharedWidgetPtr<U>&& other) TGUI_NOEXCEPT :
+    m_WidgetPtr   (static_cast<T*>(other.m_WidgetPtr)),
+    m_ControlBlock(other.m_ControlBlock)
+    {
+        other.m_WidgetPtr = nullptr;
+        other.m_ControlBlock = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -127,20 +141,10 @@ namespace tgui
     {
         if (this != &copy)
         {
-            reset();
+            SharedWidgetPtr<T> temp(copy);
 
-            if (copy.get() != nullptr)
-            {
-                m_WidgetPtr = copy.get();
-
-                m_RefCount = copy.getRefCount();
-                *m_RefCount += 1;
-            }
-            else
-            {
-                m_WidgetPtr = nullptr;
-                m_RefCount = nullptr;
-            }
+            std::swap(m_WidgetPtr,    temp.m_WidgetPtr);
+            std::swap(m_ControlBlock, temp.m_ControlBlock);
         }
 
         return *this;
@@ -152,19 +156,28 @@ namespace tgui
     template <class U>
     SharedWidgetPtr<T>& SharedWidgetPtr<T>::operator=(const SharedWidgetPtr<U>& copy)
     {
-        reset();
+        SharedWidgetPtr<T> temp(copy);
 
-        if (copy.get() != nullptr)
-        {
-            m_WidgetPtr = static_cast<T*>(copy.get());
+        std::swap(m_WidgetPtr,    temp.m_WidgetPtr);
+        std::swap(m_ControlBlock, temp.m_ControlBlock);
 
-            m_RefCount = copy.getRefCount();
-            *m_RefCount += 1;
-        }
-        else
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    SharedWidgetPtr<T>& SharedWidgetPtr<T>::operator=(SharedWidgetPtr<T>&& other) TGUI_NOEXCEPT
+    {
+        if (this != &other)
         {
-            m_WidgetPtr = nullptr;
-            m_RefCount = nullptr;
+            reset();
+
+            m_WidgetPtr = other.m_WidgetPtr;
+            m_ControlBlock = other.m_ControlBlock;
+
+            other.m_WidgetPtr = nullptr;
+            other.m_ControlBlock = nullptr;
         }
 
         return *this;
@@ -172,15 +185,50 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    template <class T>
+    template <class U>
+    SharedWidgetPtr<T>& SharedWidgetPtr<T>::operator=(SharedWidgetPtr<U>&& other) TGUI_NOEXCEPT
+    {
+        reset();
+
+        m_WidgetPtr = static_cast<T*>(other.m_WidgetPtr);
+        m_ControlBlock = other.m_ControlBlock;
+
+        other.m_WidgetPtr = nullptr;
+        other.m_ControlBlock = nullptr;
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     template <class T>
     void SharedWidgetPtr<T>::init()
+    {
+        init(nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    void SharedWidgetPtr<T>::init(WidgetArena* arena)
     {
         reset();
 
-        m_RefCount = new unsigned int;
-        *m_RefCount = 1;
+        // The control block and the widget are allocated at once
+        const std::size_t offset = WidgetControlBlock::getEmbeddedOffset<T>();
+        const std::size_t size = offset + sizeof(T);
+
+        char* memory;
+        if (arena != nullptr)
+            memory = static_cast<char*>(arena->allocate(size));
+        else
+            memory = static_cast<char*>(::operator new(size));
+
+        m_WidgetPtr = new (memory + offset) T();
+        m_ControlBlock = new (memory) WidgetControlBlock(m_WidgetPtr, true, arena, size);
 
-        m_WidgetPtr = new T();
+        m_WidgetPtr->m_ControlBlock = m_ControlBlock;
         m_WidgetPtr->m_Callback.widget = get();
     }
 
@@ -189,18 +237,15 @@ namespace tgui
     template <class T>
     void SharedWidgetPtr<T>::reset()
     {
-        if (m_WidgetPtr != nullptr)
+        if (m_ControlBlock != nullptr)
         {
-            if (*m_RefCount == 1)
-            {
-                delete m_WidgetPtr;
-                delete m_RefCount;
-
-                m_WidgetPtr = nullptr;
-                m_RefCount = nullptr;
-            }
-            else
-                *m_RefCount -= 1;
+            WidgetControlBlock* controlBlock = m_ControlBlock;
+
+            m_WidgetPtr = nullptr;
+            m_ControlBlock = nullptr;
+
+            // This may destroy the widget, so the pointer has to be cleared first
+            controlBlock->releaseStrongRef();
         }
     }
 
@@ -275,9 +320,12 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     template <class T>
-    unsigned int* SharedWidgetPtr<T>::getRefCount() const
+    unsigned int SharedWidgetPtr<T>::getRefCount() const
     {
-        return m_RefCount;
+        if (m_ControlBlock != nullptr)
+            return m_ControlBlock->strongCount;
+        else
+            return 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -289,10 +337,11 @@ namespace tgui
         {
             SharedWidgetPtr<T> pointer = nullptr;
 
-            pointer.m_RefCount = new unsigned int;
-            *pointer.m_RefCount = 1;
-
+            // The widget allocates its own copy, so the control block has to be allocated separately
             pointer.m_WidgetPtr = m_WidgetPtr->clone();
+            pointer.m_ControlBlock = new (::operator new(sizeof(WidgetControlBlock))) WidgetControlBlock(pointer.m_WidgetPtr, false);
+
+            pointer.m_WidgetPtr->m_ControlBlock = pointer.m_ControlBlock;
             pointer.m_WidgetPtr->m_Callback.widget = pointer.get();
             return pointer;
         }
@@ -300,6 +349,156 @@ namespace tgui
             return nullptr;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    WeakWidgetPtr<T>::WeakWidgetPtr() :
+    m_WidgetPtr   (nullptr),
+    m_ControlBlock(nullptr)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    WeakWidgetPtr<T>::WeakWidgetPtr(std::nullptr_t) :
+    m_WidgetPtr   (nullptr),
+    m_ControlBlock(nullptr)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    WeakWidgetPtr<T>::WeakWidgetPtr(T* widget) :
+    m_WidgetPtr   (nullptr),
+    m_ControlBlock(nullptr)
+    {
+        // Widgets that aren't owned by a SharedWidgetPtr (e.g. the internal widgets of a ComboBox) have no control block
+        if ((widget != nullptr) && (widget->m_ControlBlock != nullptr))
+        {
+            m_WidgetPtr = widget;
+            m_ControlBlock = widget->m_ControlBlock;
+            m_ControlBlock->addWeakRef();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    template <class U>
+    WeakWidgetPtr<T>::WeakWidgetPtr(const SharedWidgetPtr<U>& widget) :
+    m_WidgetPtr   (static_cast<T*>(widget.m_WidgetPtr)),
+    m_ControlBlock(widget.m_ControlBlock)
+    {
+        if (m_ControlBlock != nullptr)
+            m_ControlBlock->addWeakRef();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    WeakWidgetPtr<T>::WeakWidgetPtr(const WeakWidgetPtr<T>& copy) :
+    m_WidgetPtr   (copy.m_WidgetPtr),
+    m_ControlBlock(copy.m_ControlBlock)
+    {
+        if (m_ControlBlock != nullptr)
+            m_ControlBlock->addWeakRef();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    WeakWidgetPtr<T>::WeakWidgetPtr(WeakWidgetPtr<T>&& other) TGUI_NOEXCEPT :
+    m_WidgetPtr   (other.m_WidgetPtr),
+    m_ControlBlock(other.m_ControlBlock)
+    {
+        other.m_WidgetPtr = nullptr;
+        other.m_ControlBlock = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    WeakWidgetPtr<T>::~WeakWidgetPtr()
+    {
+        reset();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    WeakWidgetPtr<T>& WeakWidgetPtr<T>::operator=(const WeakWidgetPtr<T>& copy)
+    {
+        if (this != &copy)
+        {
+            WeakWidgetPtr<T> temp(copy);
+
+            std::swap(m_WidgetPtr,    temp.m_WidgetPtr);
+            std::swap(m_ControlBlock, temp.m_ControlBlock);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    WeakWidgetPtr<T>& WeakWidgetPtr<T>::operator=(WeakWidgetPtr<T>&& other) TGUI_NOEXCEPT
+    {
+        if (this != &other)
+        {
+            reset();
+
+            m_WidgetPtr = other.m_WidgetPtr;
+            m_ControlBlock = other.m_ControlBlock;
+
+            other.m_WidgetPtr = nullptr;
+            other.m_ControlBlock = nullptr;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    void WeakWidgetPtr<T>::reset()
+    {
+        if (m_ControlBlock != nullptr)
+        {
+            m_ControlBlock->releaseWeakRef();
+
+            m_WidgetPtr = nullptr;
+            m_ControlBlock = nullptr;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    bool WeakWidgetPtr<T>::expired() const
+    {
+        return (m_ControlBlock == nullptr) || (m_ControlBlock->strongCount == 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    SharedWidgetPtr<T> WeakWidgetPtr<T>::lock() const
+    {
+        SharedWidgetPtr<T> pointer = nullptr;
+
+        if ((m_ControlBlock != nullptr) && m_ControlBlock->addStrongRefIfAlive())
+        {
+            pointer.m_WidgetPtr = m_WidgetPtr;
+            pointer.m_ControlBlock = m_ControlBlock;
+        }
+
+        return pointer;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
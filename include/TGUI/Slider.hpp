@@ -56,6 +56,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Slider(const Slider& copy);
+        Slider(Slider&& other); ///< Move constructor
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -74,6 +75,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Slider& operator= (const Slider& right);
+        Slider& operator= (Slider&& right); ///< Move assignment operator
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,6 +244,13 @@ namespace tgui
         virtual void setTransparency(unsigned char transparency);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // The thumb can be bigger than the track, so it may be drawn outside the size of the slider.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::FloatRect getDrawBounds() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
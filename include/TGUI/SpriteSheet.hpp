@@ -57,6 +57,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SpriteSheet(const SpriteSheet& copy);
+        SpriteSheet(SpriteSheet&& other); ///< Move constructor
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -68,6 +69,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SpriteSheet& operator= (const SpriteSheet& right);
+        SpriteSheet& operator= (SpriteSheet&& right); ///< Move assignment operator
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
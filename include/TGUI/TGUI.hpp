@@ -28,6 +28,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/Tween.hpp>
 #include <TGUI/ClickableWidget.hpp>
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/Label.hpp>
@@ -38,7 +39,9 @@
 #include <TGUI/EditBox.hpp>
 #include <TGUI/Slider.hpp>
 #include <TGUI/Scrollbar.hpp>
+#include <TGUI/ListBoxModel.hpp>
 #include <TGUI/ListBox.hpp>
+#include <TGUI/Table.hpp>
 #include <TGUI/LoadingBar.hpp>
 #include <TGUI/ComboBox.hpp>
 #include <TGUI/TextBox.hpp>
@@ -0,0 +1,798 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TABLE_HPP
+#define TGUI_TABLE_HPP
+
+
+#include <TGUI/Widget.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Scrollbar;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief A list box with multiple columns and a header above them.
+    ///
+    /// The rows are added with addRow, which gets one string per column. Clicking on a header sorts the rows by that
+    /// column, clicking on it again reverses the order. The columns can be resized by dragging the line between them
+    /// in the header.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Table : public Widget, public WidgetBorders
+    {
+      public:
+
+        typedef SharedWidgetPtr<Table> Ptr;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Table();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Copy constructor
+        ///
+        /// \param copy  Instance to copy
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Table(const Table& copy);
+        Table(Table&& other); ///< Move constructor
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual ~Table();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Overload of assignment operator
+        ///
+        /// \param right  Instance to assign
+        ///
+        /// \return Reference to itself
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Table& operator= (const Table& right);
+        Table& operator= (Table&& right); ///< Move assignment operator
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes a copy of the widget by calling the copy constructor.
+        // This function calls new and if you use this function then you are responsible for calling delete.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual Table* clone();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Loads the widget.
+        ///
+        /// \param configFileFilename  Filename of the config file.
+        ///
+        /// The config file must contain a Table section with the needed information.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool load(const std::string& configFileFilename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the filename of the config file that was used to load the widget.
+        ///
+        /// \return Filename of loaded config file.
+        ///         Empty string when no config file was loaded yet.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::string& getLoadedConfigFile() const;
+
+
+        //////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the size of the table.
+        ///
+        /// \param width   The new width of the table
+        /// \param height  The new height of the table, including the header
+        ///
+        //////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSize(float width, float height);
+
+
+        //////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the size of the table
+        ///
+        /// The size returned by this function does not include the borders.
+        ///
+        /// \return Size of the table
+        ///
+        //////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Vector2f getSize() const;
+
+
+        //////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the full size of the table
+        ///
+        /// The size returned by this function includes the borders.
+        ///
+        /// \return Full size of the table
+        ///
+        //////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Vector2f getFullSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the colors used in the table.
+        ///
+        /// \param backgroundColor          The color of the background of the table
+        /// \param textColor                The color of the text
+        /// \param selectedBackgroundColor  The color of the background of the selected row
+        /// \param selectedTextColor        The color of the text in the selected row
+        /// \param borderColor              The color of the borders and of the lines between the headers
+        /// \param headerBackgroundColor    The color of the background of the header
+        /// \param headerTextColor          The color of the text in the header
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void changeColors(const sf::Color& backgroundColor         = sf::Color::White,
+                          const sf::Color& textColor               = sf::Color::Black,
+                          const sf::Color& selectedBackgroundColor = sf::Color(50, 100, 200),
+                          const sf::Color& selectedTextColor       = sf::Color::White,
+                          const sf::Color& borderColor             = sf::Color::Black,
+                          const sf::Color& headerBackgroundColor   = sf::Color(220, 220, 220),
+                          const sf::Color& headerTextColor         = sf::Color::Black);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Set the background color that will be used inside the table.
+        ///
+        /// \param backgroundColor  The color of the background of the table
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBackgroundColor(const sf::Color& backgroundColor);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Set the text color that will be used inside the table.
+        ///
+        /// \param textColor  The color of the text
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTextColor(const sf::Color& textColor);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Set the background color of the selected row.
+        ///
+        /// \param selectedBackgroundColor  The color of the background of the selected row
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Set the text color of the selected row.
+        ///
+        /// \param selectedTextColor  The color of the text in the selected row
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSelectedTextColor(const sf::Color& selectedTextColor);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Set the color of the borders and of the lines between the headers.
+        ///
+        /// \param borderColor  The color of the borders
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBorderColor(const sf::Color& borderColor);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Set the background color of the header.
+        ///
+        /// \param headerBackgroundColor  The color of the background of the header
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setHeaderBackgroundColor(const sf::Color& headerBackgroundColor);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Set the text color of the header.
+        ///
+        /// \param headerTextColor  The color of the text in the header
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setHeaderTextColor(const sf::Color& headerTextColor);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Get the background color that is currently being used inside the table.
+        ///
+        /// \return The color of the background of the table
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Color& getBackgroundColor() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Get the text color that is currently being used inside the table.
+        ///
+        /// \return The color of the text
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Color& getTextColor() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Get the background color of the selected row.
+        ///
+        /// \return The color of the background of the selected row
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Color& getSelectedBackgroundColor() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Get the text color of the selected row.
+        ///
+        /// \return The color of the text in the selected row
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Color& getSelectedTextColor() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Get the border color that is currently being used inside the table.
+        ///
+        /// \return The color of the borders
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Color& getBorderColor() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Get the background color of the header.
+        ///
+        /// \return The color of the background of the header
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Color& getHeaderBackgroundColor() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Get the text color of the header.
+        ///
+        /// \return The color of the text in the header
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Color& getHeaderTextColor() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the font of the text.
+        ///
+        /// When you don't call this function then the global font will be use.
+        /// This global font can be changed with the setGlobalFont function from the parent.
+        ///
+        /// \param font  The new font
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTextFont(const sf::Font& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the font of the text.
+        ///
+        /// \return Pointer to the font that is currently being used
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Font* getTextFont() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Adds a column to the right of the existing columns.
+        ///
+        /// \param caption  The text that is shown in the header of the column
+        /// \param width    The width of the column
+        ///
+        /// The existing rows get an empty cell in the new column.
+        ///
+        /// \return The index of the new column
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int addColumn(const sf::String& caption, unsigned int width = 100);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes all columns, together with all the rows.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeAllColumns();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of columns in the table.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getColumnCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the text in the header of a column.
+        ///
+        /// \param column   The index of the column
+        /// \param caption  The new text of the header
+        ///
+        /// \return
+        ///        - true when the caption was changed
+        ///        - false when the index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setColumnCaption(unsigned int column, const sf::String& caption);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the text in the header of a column.
+        ///
+        /// \param column  The index of the column
+        ///
+        /// \return The caption of the column, or an empty string when the index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getColumnCaption(unsigned int column) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the width of a column.
+        ///
+        /// \param column  The index of the column
+        /// \param width   The new width of the column
+        ///
+        /// The user can also change the width by dragging the line behind the column in the header.
+        ///
+        /// \return
+        ///        - true when the width was changed
+        ///        - false when the index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setColumnWidth(unsigned int column, unsigned int width);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the width of a column.
+        ///
+        /// \param column  The index of the column
+        ///
+        /// \return The width of the column, or 0 when the index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getColumnWidth(unsigned int column) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Adds a row to the table.
+        ///
+        /// \param cells  The text of the cells, one for every column. Missing cells stay empty and extra cells are ignored.
+        ///
+        /// When the table is sorted then the row is displayed at the correct position instead of at the bottom.
+        ///
+        /// \return
+        ///         - The index of the row when it was successfully added.
+        ///         - -1 when the table has no columns.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int addRow(const std::vector<sf::String>& cells);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the text of a cell.
+        ///
+        /// \param row     The index of the row, as returned by addRow
+        /// \param column  The index of the column
+        /// \param value   The new text of the cell
+        ///
+        /// \return
+        ///        - true when the cell was changed
+        ///        - false when the row or column index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setCell(unsigned int row, unsigned int column, const sf::String& value);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the text of a cell.
+        ///
+        /// \param row     The index of the row, as returned by addRow
+        /// \param column  The index of the column
+        ///
+        /// \return The text of the cell, or an empty string when the row or column index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getCell(unsigned int row, unsigned int column) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes a row from the table.
+        ///
+        /// \param row  The index of the row, as returned by addRow
+        ///
+        /// The rows behind it get an index that is one lower.
+        ///
+        /// \return
+        ///        - true when the row was removed
+        ///        - false when the index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool removeRow(unsigned int row);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes all rows from the table, the columns remain.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeAllRows();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of rows in the table.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getRowCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Sorts the rows by the text in one of the columns.
+        ///
+        /// \param column     The index of the column to sort by
+        /// \param ascending  Sort from low to high when true, from high to low when false
+        ///
+        /// Only the order in which the rows are displayed changes, the index of a row stays the same.
+        /// Rows with the same text in the column keep the order in which they were added.
+        ///
+        /// \return
+        ///        - true when the rows were sorted
+        ///        - false when the index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool sortByColumn(unsigned int column, bool ascending = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Displays the rows in the order in which they were added again.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeSorting();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the index of the column by which the rows are sorted.
+        ///
+        /// \return The index of the column, or -1 when the rows are not sorted
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getSortColumn() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the rows are sorted from low to high.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSortedAscending() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Selects a row in the table.
+        ///
+        /// \param row  The index of the row, as returned by addRow
+        ///
+        /// When the row is not visible then the table scrolls to it. Passing -1 deselects the selected row.
+        ///
+        /// \return
+        ///        - true on success
+        ///        - false when the index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setSelectedRow(int row);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Deselects the selected row.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void deselectRow();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Get the index of the selected row.
+        ///
+        /// \return The index of the selected row, or -1 when no row was selected
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getSelectedRow() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the scrollbar of the table.
+        ///
+        /// \param scrollbarConfigFileFilename  Filename of the config file.
+        ///                                     The config file must contain a Scrollbar section with the needed information.
+        ///
+        /// \return
+        ///        - true when the scrollbar was successfully loaded
+        ///        - false when the loading of the scrollbar failed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setScrollbar(const std::string& scrollbarConfigFileFilename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes the scrollbar from the table.
+        ///
+        /// The rows that don't fit inside the table can no longer be reached.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeScrollbar();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the height of the rows and of the header.
+        ///
+        /// \param rowHeight  The size of a single row
+        ///
+        /// This size is also used to calculate the text size.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRowHeight(unsigned int rowHeight);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the height of the rows and of the header.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getRowHeight() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the size of the borders.
+        ///
+        /// \param leftBorder    The width of the left border
+        /// \param topBorder     The height of the top border
+        /// \param rightBorder   The width of the right border
+        /// \param bottomBorder  The height of the bottom border
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBorders(unsigned int leftBorder   = 0,
+                        unsigned int topBorder    = 0,
+                        unsigned int rightBorder  = 0,
+                        unsigned int bottomBorder = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the transparency of the widget.
+        ///
+        /// \param transparency  The transparency of the widget.
+        ///                      0 is completely transparent, while 255 (default) means fully opaque.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setTransparency(unsigned char transparency);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // These functions are used to receive callback from the EventManager.
+        // You normally don't need them, but you can use them to simulate an event.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool mouseOnWidget(float x, float y);
+        virtual void leftMousePressed(float x, float y);
+        virtual void leftMouseReleased(float x, float y);
+        virtual void mouseMoved(float x, float y);
+        virtual void mouseWheelMoved(int delta, int x, int y);
+        virtual void mouseNotOnWidget();
+        virtual void mouseNoLongerDown();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Change a property of the table.
+        ///
+        /// \param property  The property that you would like to change
+        /// \param value     The new value that you like to assign to the property
+        ///
+        /// \return True when the property was changed, false when the property didn't exist
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool setProperty(std::string property, const std::string& value);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Retrieves the value of a certain property.
+        ///
+        /// \param property  The property that you would like to retrieve
+        /// \param value     The value of the property will be stored in this variable
+        ///
+        /// \return True when the property was found, false when the property didn't exist
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool getProperty(std::string property, std::string& value) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns a list of all properties that can be used in setProperty and getProperty.
+        ///
+        /// \return List of properties and their type
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::list< std::pair<std::string, std::string> > getPropertyList() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called when the widget is added to a container.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void initialize(Container *const container);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the widget on the render target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether row 'left' comes before row 'right' in the current sort order. Rows with the same text are
+        // compared by index, so that the order of the rows never depends on how they were sorted.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool rowComesBefore(unsigned int left, unsigned int right) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Puts the row at the correct place in m_RowOrder, after it was added or after its text changed.
+        // The row may not be in m_RowOrder when this function is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertIntoRowOrder(unsigned int row);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width of the area in which the rows are drawn, which excludes the scrollbar.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getContentWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the column whose right side lies close to the given x position (relative to the table), or -1 when the
+        // position isn't on a line between the headers.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getColumnSeparatorAt(float x) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the column at the given x position (relative to the table), or -1 when there is no column there.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getColumnAt(float x) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbar after the amount of rows or the height of the table changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScrollbar();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the quads for the text of the header and for the cells on the rows between firstRow and endRow.
+        // Only the columns that are visible get quads, and text that doesn't fit inside its column is cut off.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTextGeometry(unsigned int firstRow, unsigned int endRow) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Appends a quad for every character of the text to the vertex array. The characters that don't fit in front of
+        // maxX are left out.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addTextGeometry(sf::VertexArray& vertices, const sf::String& text, float x, float y, float maxX, const sf::Color& color) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// Defines specific triggers to Table.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum TableCallbacks
+        {
+            RowSelected         = WidgetCallbacksCount * 1,     ///< A new row was selected
+            HeaderClicked       = WidgetCallbacksCount * 2,     ///< The header of a column was clicked
+            AllTableCallbacks   = WidgetCallbacksCount * 4 - 1, ///< All triggers defined in Table and its base classes
+            TableCallbacksCount = WidgetCallbacksCount * 4
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        // The cells are stored per column, so that sorting by a column only has to look at a single vector
+        struct Column
+        {
+            sf::String caption;
+            unsigned int width;
+            std::vector<sf::String> cells;
+        };
+
+        std::string m_LoadedConfigFile;
+
+        std::vector<Column> m_Columns;
+        unsigned int m_RowCount;
+
+        // The index of the row that is displayed at every position. Sorting only changes this vector, the cells stay where
+        // they are so that the index of a row never changes.
+        std::vector<unsigned int> m_RowOrder;
+        int m_SortColumn;
+        bool m_SortAscending;
+
+        // What is the index of the selected row?
+        int m_SelectedRow;
+
+        // The column that is being resized while the mouse is down, -1 when no column is being resized
+        int m_ResizingColumn;
+
+        // The size must be stored
+        sf::Vector2u m_Size;
+        unsigned int m_RowHeight;
+        unsigned int m_TextSize;
+
+        // When there are too many rows a scrollbar will be shown
+        Scrollbar* m_Scroll;
+
+        // These colors are used to draw the table
+        sf::Color m_BackgroundColor;
+        sf::Color m_TextColor;
+        sf::Color m_SelectedBackgroundColor;
+        sf::Color m_SelectedTextColor;
+        sf::Color m_BorderColor;
+        sf::Color m_HeaderBackgroundColor;
+        sf::Color m_HeaderTextColor;
+
+        // The font used to draw the text
+        const sf::Font* m_TextFont;
+
+        // The quads of the characters in the header and on the visible rows. They are only recreated when other rows
+        // become visible or when something changes that affects the text.
+        mutable sf::VertexArray m_HeaderVertices;
+        mutable sf::VertexArray m_CellVertices;
+        mutable bool m_TextGeometryNeedsUpdate;
+        mutable unsigned int m_GeometryFirstRow;
+        mutable unsigned int m_GeometryEndRow;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TABLE_HPP
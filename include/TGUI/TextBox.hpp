@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/TextHistory.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -58,6 +59,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TextBox(const TextBox& copy);
+        TextBox(TextBox&& other); ///< Move constructor
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,6 +78,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TextBox& operator= (const TextBox& right);
+        TextBox& operator= (TextBox&& right); ///< Move assignment operator
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -154,6 +157,10 @@ namespace tgui
         ///
         /// \param text  Text that will be added to the text that is already in the text box
         ///
+        /// Only the last line and the added text are split into lines again, so that the text box can be used as a log view.
+        /// When the text box is read-only then the selection is kept and the text box only scrolls down when the bottom of
+        /// the text was already visible.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void addText(const sf::String& text);
 
@@ -231,6 +238,81 @@ namespace tgui
         unsigned int getMaximumCharacters() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the maximum amount of lines.
+        ///
+        /// \param maxLines  The new line limit.
+        ///                  Set it to 0 to disable the limit.
+        ///
+        /// When there are more lines in the text then the oldest lines are removed from the front of the text.
+        /// Only lines that end with a newline character are counted, lines that are split because they are too long aren't.
+        /// Lines are removed in batches, so a few lines less than the limit may remain.
+        /// Changes that were made to the removed lines can no longer be undone, the other changes can.
+        ///
+        /// This line limit is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaximumLines(unsigned int maxLines = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the maximum line limit.
+        ///
+        /// \return The line limit.
+        ///         The function will return 0 when there is no limit.
+        ///
+        /// There is no line limit by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getMaximumLines() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Reverts the last change that was made to the text.
+        ///
+        /// \return True when a change was undone, false when there was nothing to undo
+        ///
+        /// Characters that are typed after each other are undone together, one word at a time.
+        /// The user can also undo a change by pressing Ctrl+Z.
+        ///
+        /// Changing the text with setText forgets all changes that were made before.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool undo();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Makes the last change that was undone again.
+        ///
+        /// \return True when a change was redone, false when there was nothing to redo
+        ///
+        /// The user can also redo a change by pressing Ctrl+Y or Ctrl+Shift+Z.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool redo();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the amount of memory that may be used to remember the changes that can be undone.
+        ///
+        /// \param bytes  The maximum amount of memory in bytes. Set it to 0 to disable undo.
+        ///
+        /// Only the characters that were changed are stored. When the limit is reached then the oldest changes are forgotten.
+        /// The limit is 1 MB by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setUndoMemoryLimit(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of memory that may be used to remember the changes that can be undone.
+        ///
+        /// \return The maximum amount of memory in bytes
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getUndoMemoryLimit() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the border width and border height of the text box.
         ///
@@ -498,6 +580,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void mouseNoLongerDown();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void widgetFocused();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -552,6 +639,13 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the selected characters with the contents of the clipboard. This function is called after pressing ctrl+V,
+        // as soon as the contents of the clipboard are available.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pasteText(const sf::String& contents);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // To keep the drawing as fast as possible, all the calculation are done in front by this function.
         // It is called when the text changes, when scrolling, ...
@@ -560,10 +654,70 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function is called by updateDisplayedText and will split the text into five pieces so that the text can
-        // be easily drawn.
+        // Splits the text into lines again, starting from the given line in the displayed text. The lines in front of it
+        // are kept, so appending text only requires the last line to be split again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rewrapText(unsigned int line);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces characters of the text and only splits the text into lines again from the line in front of the change.
+        // Used when undoing and redoing, which then don't have to split the whole text again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void replaceText(unsigned int position, unsigned int removedChars, const sf::String& inserted);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the scrollbar so that the line with the selection point becomes visible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scrollToSelectionPoint();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the oldest lines when there are more lines than the line limit.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateSelectionTexts(float maxLineWidth);
+        void removeExcessLines();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds out which lines are visible (based on the value of the scrollbar) and marks the quads to be recreated when these
+        // lines differ from the ones that have quads. This is called when scrolling, so the text isn't split into lines again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleLines();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rebuilds the quads of the characters on the visible lines. This is delayed until the text box is drawn, so that
+        // adding text many times in a row doesn't recreate the quads every time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTextGeometry() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the colors of the characters that were selected or deselected, the rectangles behind the selected text
+        // and the position of the selection point. The displayed text is not split into lines again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSelection();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the rectangles behind the part of the selection that lies on the visible lines.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSelectionRects() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gives the displayed characters between begin and end the selected or the normal text color, depending on whether
+        // they lie inside the colored selection.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateCharacterColors(unsigned int begin, unsigned int end);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the position of a character in the displayed text. Only the line of the character is laid out when the
+        // character lies outside the visible lines.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2f findCharacterPos(unsigned int index) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -578,6 +732,12 @@ namespace tgui
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the blinking selection point has to be toggled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time getTimeUntilNextUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -616,6 +776,9 @@ namespace tgui
         // The maximum characters (0 by default, which means no limit)
         unsigned int m_MaxChars;
 
+        // The maximum lines (0 by default, which means no limit)
+        unsigned int m_MaxLines;
+
         // What is known about the visible lines?
         unsigned int m_TopLine;
         unsigned int m_VisibleLines;
@@ -635,22 +798,43 @@ namespace tgui
         // The width in pixels of the flickering selection pointer
         unsigned int m_SelectionPointWidth;
 
-        // Should the text be resplit into the five texts?
-        bool m_SelectionTextsNeedUpdate;
+        // Should the quads of the characters be recreated?
+        mutable bool m_TextGeometryNeedsUpdate;
 
         // The colors that are used by the text box
         sf::Color m_BackgroundColor;
         sf::Color m_SelectedTextBgrColor;
         sf::Color m_BorderColor;
 
-        // The sfml Text widgets
-        sf::Text m_TextBeforeSelection;
-        sf::Text m_TextSelection1;
-        sf::Text m_TextSelection2;
-        sf::Text m_TextAfterSelection1;
-        sf::Text m_TextAfterSelection2;
+        // The colors of the text
+        sf::Color m_TextColor;
+        sf::Color m_SelectedTextColor;
+
+        // Holds the font and the character size. It is used to calculate the layout of the text.
+        sf::Text m_TextTemplate;
 
-        std::vector<float> m_MultilineSelectionRectWidth;
+        // The index in the displayed text where every line starts
+        std::vector<unsigned int> m_LineStarts;
+
+        // The indices in m_Text in front of which a newline was added to split the line
+        std::vector<unsigned int> m_WrapPositions;
+
+        // The lines that have quads and the index of their first character in the displayed text
+        unsigned int m_GeometryFirstLine;
+        unsigned int m_GeometryEndLine;
+        mutable unsigned int m_GeometryFirstChar;
+
+        // One quad per character on the visible lines (whitespace characters get an empty quad) and the position of these
+        // characters. The last position lies behind the last visible character.
+        mutable sf::VertexArray           m_TextVertices;
+        mutable std::vector<sf::Vector2f> m_CharacterPositions;
+
+        // The part of the displayed text that currently has the selected text color
+        unsigned int m_SelectionColoredStart;
+        unsigned int m_SelectionColoredEnd;
+
+        // The rectangles that are drawn behind the selected text
+        mutable sf::VertexArray m_SelectionRects;
 
         // The scrollbar
         Scrollbar* m_Scroll;
@@ -660,6 +844,9 @@ namespace tgui
 
         bool m_readOnly;
 
+        // The changes to the text that can be undone and redone
+        TextHistory m_UndoHistory;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -0,0 +1,192 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TEXT_HISTORY_HPP
+#define TGUI_TEXT_HISTORY_HPP
+
+#include <deque>
+
+#include <TGUI/Global.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Used internally by EditBox and TextBox to remember the changes to their text, so that they can be undone and redone.
+    // Only the characters that were removed and inserted are stored, never the whole text.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextHistory
+    {
+      public:
+
+        // The kind of change, which decides which changes are merged together
+        enum ChangeType
+        {
+            Typing,     // A character was typed. Consecutive typed characters are merged until a new word starts.
+            Backspace,  // A character in front of the selection point was removed. Consecutive ones in a word are merged.
+            Delete,     // A character behind the selection point was removed. Consecutive ones in a word are merged.
+            Other       // Any other change. Text inserted at the place where this change removed text is merged with it.
+        };
+
+        // A single change: the removed characters were replaced by the inserted ones at the given position
+        struct Change
+        {
+            ChangeType   type;
+            unsigned int position;
+            sf::String   removed;
+            sf::String   inserted;
+
+            // The selection before the change was made
+            unsigned int selectionStart;
+            unsigned int selectionEnd;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextHistory();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers a change to the text. The changes that were undone can no longer be redone afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addChange(ChangeType type, unsigned int position, const sf::String& removed, const sf::String& inserted,
+                       unsigned int selectionStart, unsigned int selectionEnd);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers the change between the old and the new text. Only the part between the characters that both texts have in
+        // common at their front and back is stored.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addChange(ChangeType type, const sf::String& oldText, const sf::String& newText,
+                       unsigned int selectionStart, unsigned int selectionEnd);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the change that has to be reverted, or a nullptr when there is nothing to undo.
+        // The change can be redone afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Change* undo();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the change that has to be made again, or a nullptr when there is nothing to redo.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Change* redo();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Forgets all changes. This has to be called when the text is changed without adding the change to the history.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Has to be called when the first characters of the text were removed without adding the change to the history.
+        // The positions of the remembered changes are moved along. The changes that can't be reverted without the removed
+        // characters are forgotten, together with all changes that were made before them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFront(unsigned int chars);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that the next change isn't merged with the last one. This has to be called when the user moves the
+        // selection point, so that typing somewhere else is undone separately.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stopMerging();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the amount of memory that the stored changes may use. The oldest changes are forgotten when the history
+        // becomes bigger. When the limit is 0 then no changes are remembered.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMemoryLimit(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of memory that the stored changes may use.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getMemoryLimit() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tries to add the change to the last change instead of storing it separately.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool mergeChange(ChangeType type, unsigned int position, const sf::String& removed, const sf::String& inserted);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the second character begins a new word when it follows the first one.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isWordStart(sf::Uint32 prevChar, sf::Uint32 curChar);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of memory that is used to store the change.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getMemoryUsage(const Change& change);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the positions of the changes in the list when the first characters of the text were removed, and forgets the
+        // changes that touch the removed characters together with the ones that would be reverted after them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFront(std::deque<Change>& changes, unsigned int chars);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Forgets the oldest changes until the history fits inside the memory limit.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void limitMemoryUsage();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // The last change is at the back of both lists
+        std::deque<Change> m_UndoChanges;
+        std::deque<Change> m_RedoChanges;
+
+        // Can a new change still be merged with the last change? This is no longer the case after undoing or redoing,
+        // or after the selection point was moved.
+        bool m_MergeAllowed;
+
+        std::size_t m_MemoryUsage;
+        std::size_t m_MemoryLimit;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_HISTORY_HPP
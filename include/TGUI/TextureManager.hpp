@@ -29,6 +29,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <list>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -36,11 +37,24 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // Remembers for every pixel of an image whether it is transparent, using a single bit per pixel.
+    // This is all that is needed for hit-testing, so the pixels themselves don't have to be kept once they are uploaded.
+    struct AlphaMask
+    {
+        void create(const sf::Image& image);
+        bool isTransparentPixel(unsigned int x, unsigned int y) const;
+
+        sf::Vector2u            size;
+        std::vector<sf::Uint8>  bits;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     struct TextureData
     {
-        TextureData() : image(nullptr) {}
+        TextureData() : mask(nullptr) {}
 
-        sf::Image*    image;
+        AlphaMask*    mask;
         sf::Texture   texture;
         sf::IntRect   rect;
         std::string   filename;
@@ -72,6 +86,27 @@ namespace tgui
     {
       public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Information about the memory used by the textures.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Stats
+        {
+            unsigned int textures;           ///< Amount of textures in memory, including the unused ones
+            unsigned int unusedTextures;     ///< Amount of textures that are no longer used but are kept for when they are needed again
+            std::size_t  textureBytes;       ///< Amount of bytes used by all textures in memory
+            std::size_t  unusedTextureBytes; ///< Amount of bytes used by the unused textures
+            std::size_t  maskBytes;          ///< Amount of bytes used to store which pixels are transparent
+            unsigned int evictions;          ///< Amount of unused textures that were removed from memory
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextureManager();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Loads a texture.
         ///
@@ -100,22 +135,94 @@ namespace tgui
         ///
         /// \param textureToRemove  The texture that should be removed.
         ///
-        /// When no other texture is using the same image then the image will be removed from memory.
+        /// When no other texture is using the same image then the image will be removed from memory, unless the memory budget
+        /// allows keeping it loaded for when it is needed again.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void removeTexture(Texture& textureToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the amount of memory that the textures may use.
+        ///
+        /// \param bytes  The maximum amount of bytes used by all textures together
+        ///
+        /// Textures that are no longer used are kept in memory as long as the total stays within the budget, so that screens
+        /// that are opened again don't have to reload their images. When the budget is exceeded, the textures that were
+        /// unused for the longest time are removed first. Textures that are still in use are never removed.
+        ///
+        /// The budget is 0 by default, which means that textures are removed as soon as they are no longer used.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMemoryBudget(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of memory that the textures may use.
+        ///
+        /// \return The maximum amount of bytes used by all textures together
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getMemoryBudget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes all textures that are no longer used from memory.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeUnusedTextures();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of memory used by the textures of some images.
+        ///
+        /// \param filenamePrefix  Only images whose filename starts with this string are counted. Passing the folder of a theme
+        ///                        gives the memory used by that theme, while an empty string counts all images.
+        ///
+        /// \return The amount of bytes used by the textures, including the unused ones that are still in memory
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getMemoryUsage(const std::string& filenamePrefix = "") const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns information about the memory used by the textures.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Stats getStats() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
         struct ImageMapData
         {
-            sf::Image image;
+            AlphaMask mask;
             std::list<TextureData> data;
         };
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of bytes used by the texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getTextureBytes(const TextureData& data);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes unused textures, starting with the one that was unused the longest, until the textures fit in the budget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void evictUnusedTextures(std::size_t budget);
+
+
         std::map<std::string, ImageMapData> m_ImageMap;
+
+        // The textures without users that are still in memory, the one that was used most recently is in front
+        std::list<TextureData*> m_UnusedTextures;
+
+        std::size_t  m_MemoryBudget;
+        std::size_t  m_TextureBytes;
+        std::size_t  m_UnusedTextureBytes;
+        unsigned int m_Evictions;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
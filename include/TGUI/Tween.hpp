@@ -0,0 +1,190 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_TWEEN_HPP
+#define TGUI_TWEEN_HPP
+
+#include <vector>
+#include <functional>
+
+#include <TGUI/Global.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Struct that describes a gradual change of a widget property.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API Tween
+    {
+        /// The curves that can be used to go from the start value to the end value
+        enum Easing
+        {
+            Linear,              ///< Constant speed
+            QuadraticIn,         ///< Starts slow and speeds up
+            QuadraticOut,        ///< Starts fast and slows down
+            QuadraticInOut,      ///< Starts slow, speeds up and slows down again near the end
+            CubicIn,             ///< Like QuadraticIn, but with a stronger acceleration
+            CubicOut,            ///< Like QuadraticOut, but with a stronger deceleration
+            CubicInOut,          ///< Like QuadraticInOut, but with a stronger acceleration and deceleration
+            SineInOut,           ///< Smooth start and end, following a sine curve
+            BackOut,             ///< Shoots slightly past the end value before settling on it
+            BounceOut            ///< Bounces a few times on the end value
+        };
+
+        /// The widget properties that can be tweened
+        enum Property
+        {
+            Position,            ///< The position of the widget (setPosition)
+            Size,                ///< The size of the widget (setSize)
+            Transparency,        ///< The transparency of the widget (setTransparency)
+            Color                ///< A color of the widget, changed through a function that you provide
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Tween();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Apply an easing curve to a linear progress.
+        ///
+        /// \param easing    The easing curve to use
+        /// \param progress  Linear progress of the tween, between 0 and 1
+        ///
+        /// \return The eased progress. This is 0 at the start and 1 at the end, but can leave this range in between.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static float ease(Easing easing, float progress);
+
+
+        // The widget that is being changed
+        Widget* widget;
+
+        // Which property of the widget is being changed and how
+        Property property;
+        Easing   easing;
+
+        // The value at the start and at the end of the tween (only the first two values are used for positions and sizes,
+        // only the first value is used for the transparency and all four values are used for colors)
+        float startValue[4];
+        float endValue[4];
+
+        // The time that already passed and the total time that the tween lasts
+        sf::Time elapsed;
+        sf::Time duration;
+
+        // The function that changes the color (only used for color tweens)
+        std::function<void(const sf::Color&)> setColor;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Used internally by containers to update the tweens of their widgets all at once.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Tweener
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Tweener();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Starts a new tween. When the same property of the same widget is already being tweened then the old tween is
+        // replaced by the new one. A color tween will then continue from the color that was reached by the old tween.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void add(const Tween& tween);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stops all the tweens of the given widget. The properties keep the value that they have at this moment.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void remove(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stops all tweens.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeAll();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the properties of all widgets based on the elapsed time. Tweens that reach their end are removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(const sf::Time& elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether there are still tweens running.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEmpty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the value of the tween at its current elapsed time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void getCurrentValue(const Tween& tween, float value[4]);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes the current value of the tween to the widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void apply(const Tween& tween);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the tween at the given index. The slot is kept at the back of the list so that it can be reused.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recycle(unsigned int index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // The running tweens are stored at the front of the list, the finished ones behind them are reused by new tweens
+        std::vector<Tween> m_Tweens;
+        unsigned int m_ActiveTweens;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TWEEN_HPP
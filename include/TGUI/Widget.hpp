@@ -31,6 +31,7 @@
 #include <TGUI/ConfigFile.hpp>
 #include <TGUI/Callback.hpp>
 #include <TGUI/Transformable.hpp>
+#include <TGUI/Tween.hpp>
 #include <TGUI/SharedWidgetPtr.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -63,6 +64,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget(const Widget& copy);
+        Widget(Widget&& other); ///< Move constructor
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -81,6 +83,7 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget& operator= (const Widget& right);
+        Widget& operator= (Widget&& right); ///< Move assignment operator
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -89,6 +92,23 @@ namespace tgui
         virtual Widget* clone() = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Set the position of the widget
+        ///
+        /// This function completely overwrites the previous position.
+        /// See the move function to apply an offset based on the previous position instead.
+        /// The default position of a transformable widget is (0, 0).
+        ///
+        /// \param x X coordinate of the new position
+        /// \param y Y coordinate of the new position
+        ///
+        /// \see move, getPosition
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setPosition(float x, float y);
+        using Transformable::setPosition;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Get the absolute position of the widget on the screen
         ///
@@ -255,6 +275,83 @@ namespace tgui
         unsigned char getTransparency() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Gradually move the widget from its current position to a new position.
+        ///
+        /// \param position  The position that the widget should have at the end
+        /// \param duration  How long it takes to reach the new position
+        /// \param easing    The curve that determines how fast the widget moves at each moment
+        ///
+        /// When the position of the widget is already being tweened, then the old tween is replaced by this one.
+        /// When the widget has no parent, the position is changed immediately.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void tweenPosition(const sf::Vector2f& position, sf::Time duration, Tween::Easing easing = Tween::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Gradually change the size of the widget.
+        ///
+        /// \param size      The size that the widget should have at the end
+        /// \param duration  How long it takes to reach the new size
+        /// \param easing    The curve that determines how fast the size changes at each moment
+        ///
+        /// When the size of the widget is already being tweened, then the old tween is replaced by this one.
+        /// When the widget has no parent, the size is changed immediately.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void tweenSize(const sf::Vector2f& size, sf::Time duration, Tween::Easing easing = Tween::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Gradually change the transparency of the widget, e.g. to fade it in or out.
+        ///
+        /// \param transparency  The transparency that the widget should have at the end
+        /// \param duration      How long it takes to reach the new transparency
+        /// \param easing        The curve that determines how fast the transparency changes at each moment
+        ///
+        /// When the transparency of the widget is already being tweened, then the old tween is replaced by this one.
+        /// When the widget has no parent, the transparency is changed immediately.
+        ///
+        /// \see setTransparency
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void tweenTransparency(unsigned char transparency, sf::Time duration, Tween::Easing easing = Tween::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Gradually change a color of the widget.
+        ///
+        /// \param startColor  The color at the start of the tween
+        /// \param endColor    The color that should be reached at the end
+        /// \param duration    How long it takes to reach the end color
+        /// \param setColor    Function that passes the color to the widget
+        /// \param easing      The curve that determines how fast the color changes at each moment
+        ///
+        /// Usage example:
+        /// \code
+        /// label->tweenColor(sf::Color::Black, sf::Color::Red, sf::milliseconds(300),
+        ///                   std::bind(&tgui::Label::setTextColor, label.get(), std::placeholders::_1));
+        /// \endcode
+        ///
+        /// A widget only has one color tween at a time. When a color is already being tweened, then the old tween is
+        /// replaced by this one and the start color is ignored: the new tween continues from the color that was reached.
+        /// When the widget has no parent, the end color is set immediately.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void tweenColor(const sf::Color& startColor, const sf::Color& endColor, sf::Time duration,
+                        const std::function<void(const sf::Color&)>& setColor, Tween::Easing easing = Tween::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Stop all tweens of the widget.
+        ///
+        /// The properties that were being tweened keep the value that they have at this moment.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stopTweens();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Places the widget before all other widgets.
         ///
@@ -296,12 +393,28 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function is called right after the elapsed time is changed.
-        // The elapsed time is only changed when the widget has set m_AnimatedWidget to true.
+        /// \internal
+        // Returns the area in which the widget draws, relative to the position of its parent.
+        // The container uses this to skip widgets that lie completely outside of the visible area.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::FloatRect getDrawBounds() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called right after the elapsed time is changed, once the time returned by
+        // getTimeUntilNextUpdate has passed. The elapsed time is only changed while the widget is animating.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns how long it will take before the widget has to be updated again. This is only called while the
+        // widget is animating. By default the widget is updated every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time getTimeUntilNextUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // The widgets use this function to send their callbacks to their parent and/or to a callback function.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -408,6 +521,33 @@ namespace tgui
         virtual void initialize(Container *const container);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the parent that this widget has to receive the elapsed time (through the update function) from now on.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void startAnimation();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the parent that this widget no longer has to receive the elapsed time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stopAnimation();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes the tween to the parent, which will update it together with the tweens of the other widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void startTween(Tween& tween, sf::Time duration, Tween::Easing easing);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the gui that the looks of the widget changed and that the window has to be redrawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       public:
 
@@ -457,7 +597,8 @@ namespace tgui
         // Can the widget be focused?
         bool m_AllowFocus;
 
-        // Keep track of the elapsed time.
+        // Keep track of the elapsed time. This is only done while the widget is animating (between the calls to
+        // startAnimation and stopAnimation), and the flag is not copied together with the widget.
         bool m_AnimatedWidget;
         sf::Time m_AnimationTimeElapsed;
 
@@ -467,10 +608,19 @@ namespace tgui
         // This is set to true for widgets that store other widgets inside them
         bool m_ContainerWidget;
 
+        // The reference counts when the widget is owned by a SharedWidgetPtr, nullptr otherwise
+        WidgetControlBlock* m_ControlBlock;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container;
+
+        template <class T>
+        friend class SharedWidgetPtr;
+
+        template <class T>
+        friend class WeakWidgetPtr;
     };
 
 
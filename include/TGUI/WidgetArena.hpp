@@ -0,0 +1,133 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_WIDGET_ARENA_HPP
+#define TGUI_WIDGET_ARENA_HPP
+
+
+#include <TGUI/Config.hpp>
+
+#include <SFML/System/NonCopyable.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#ifdef TGUI_ATOMIC_REFCOUNT
+    #include <mutex>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Memory pool from which a container allocates the widgets (together with their control block) that are created for it.
+    //
+    // Memory is taken from large chunks, and freed blocks are kept in a list per size so that they can be reused by the next
+    // widget of the same size. When none of the widgets are alive anymore, the whole arena is rewound at once, without
+    // returning the chunks to the system. The chunks are only freed when both the owning container and all widgets are gone.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API WidgetArena : public sf::NonCopyable
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the arena. The owner holds a reference to it which has to be released with release().
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WidgetArena();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns memory for a widget and its control block. The memory is aligned like memory returned by operator new.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void* allocate(std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gives back memory that was returned by allocate. The size must be the same as the one passed to allocate.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void deallocate(void* memory, std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes all chunks available again from the start when nothing is allocated from the arena anymore.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recycle();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Releases the reference of the owner. The arena is destroyed once no allocated memory is left.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void release();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // The arena can only destroy itself
+        ~WidgetArena();
+
+        // Returns the index in the free lists for an allocation of the given size
+        static std::size_t getSizeIndex(std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        struct Chunk
+        {
+            char*       memory;
+            std::size_t size;
+        };
+
+        std::vector<Chunk> m_Chunks;
+
+        // The chunk from which new memory is taken and the amount of bytes already taken from it
+        unsigned int m_CurrentChunk;
+        std::size_t  m_ChunkOffset;
+
+        // The size of the next chunk, chunks grow until they reach the maximum size
+        std::size_t m_NextChunkSize;
+
+        // The freed blocks, indexed by their rounded size. Each free block stores a pointer to the next one.
+        std::vector<void*> m_FreeLists;
+
+        // One reference for the owner and one for every allocated block
+        unsigned int m_References;
+
+    #ifdef TGUI_ATOMIC_REFCOUNT
+        std::mutex m_Mutex;
+    #endif
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_WIDGET_ARENA_HPP
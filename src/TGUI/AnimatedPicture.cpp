@@ -25,21 +25,251 @@
 
 #include <TGUI/AnimatedPicture.hpp>
 
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // When the frames are streamed, a thread loads the images of the next few frames while the animation is playing.
+    // The widget takes the image of a frame from it when the frame has to be displayed and uploads it to a single texture.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct AnimatedPicture::StreamData
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Starts the thread, which immediately starts loading the first frames.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        StreamData(const std::vector<std::string>& frameFilenames, unsigned int framesAhead, bool loop);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stops the thread and waits until it has finished.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~StreamData();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The function that runs on the thread. It keeps loading the frames that will be needed soon.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void run();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the frame lies in the range of frames that has to be loaded ahead. The mutex must be locked.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isFrameNeeded(unsigned int frame) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the first needed frame that hasn't been loaded yet, or -1 when all of them are loaded. The mutex must be locked.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int findFrameToLoad() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the image of the frame from the loaded frames and passes it to the image parameter, which stays empty when
+        // the image couldn't be loaded. The frames before it are no longer needed. When the thread hasn't loaded the frame yet,
+        // false is returned and the thread loads it first, unless wait is true in which case the function waits for it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool takeFrame(unsigned int frame, bool wait, std::unique_ptr<sf::Image>& image);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes whether the first frames are loaded again when the end of the animation is near.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLooping(bool loop);
+
+
+        std::vector<std::string> filenames;
+        unsigned int preloadedFrames;
+
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable condition;
+
+        // The state that is shared between the thread and the widget, protected by the mutex.
+        // The loaded frames are those between nextFrame and nextFrame + preloadedFrames.
+        bool running;
+        bool looping;
+        unsigned int nextFrame;
+        std::map< unsigned int, std::unique_ptr<sf::Image> > loadedFrames;
+
+        // The texture of the displayed frame, only accessed by the widget
+        sf::Texture texture;
+        sf::Sprite  sprite;
+
+        // The last frame that was taken from the thread, and the time since the widget last failed to take a frame.
+        // The widget is waiting for the thread while this frame differs from the current frame.
+        int       takenFrame;
+        sf::Clock retryClock;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnimatedPicture::StreamData::StreamData(const std::vector<std::string>& frameFilenames, unsigned int framesAhead, bool loop) :
+    filenames      (frameFilenames),
+    preloadedFrames(TGUI_MAXIMUM(framesAhead, 1u)),
+    running        (true),
+    looping        (loop),
+    nextFrame      (0),
+    takenFrame     (-1)
+    {
+        thread = std::thread(&StreamData::run, this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnimatedPicture::StreamData::~StreamData()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = false;
+        }
+
+        condition.notify_all();
+        thread.join();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimatedPicture::StreamData::run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (running)
+        {
+            int frame = findFrameToLoad();
+            if (frame < 0)
+            {
+                // Wait until a frame is displayed or until the looping changes
+                condition.wait(lock);
+                continue;
+            }
+
+            // Load the image without blocking the widget. An empty pointer tells the widget that the image couldn't be loaded.
+            lock.unlock();
+            std::unique_ptr<sf::Image> image(new sf::Image());
+            if (!image->loadFromFile(filenames[frame]))
+                image.reset();
+            lock.lock();
+
+            // The animation might have jumped to another frame in the meantime
+            if (isFrameNeeded(frame))
+            {
+                loadedFrames[frame] = std::move(image);
+                condition.notify_all();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AnimatedPicture::StreamData::isFrameNeeded(unsigned int frame) const
+    {
+        // Without looping, nothing is needed anymore after the last frame was displayed
+        if (nextFrame >= filenames.size())
+            return false;
+
+        if (frame >= nextFrame)
+            return frame - nextFrame < preloadedFrames;
+        else if (looping)
+            return frame + filenames.size() - nextFrame < preloadedFrames;
+        else
+            return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int AnimatedPicture::StreamData::findFrameToLoad() const
+    {
+        if (nextFrame >= filenames.size())
+            return -1;
+
+        const unsigned int frameCount = TGUI_MINIMUM(preloadedFrames, filenames.size());
+        for (unsigned int i = 0; i < frameCount; ++i)
+        {
+            unsigned int frame = nextFrame + i;
+            if (frame >= filenames.size())
+            {
+                if (!looping)
+                    break;
+
+                frame -= filenames.size();
+            }
+
+            if (loadedFrames.find(frame) == loadedFrames.end())
+                return static_cast<int>(frame);
+        }
+
+        return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AnimatedPicture::StreamData::takeFrame(unsigned int frame, bool wait, std::unique_ptr<sf::Image>& image)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        // Forget the frames that were skipped, and let the thread load the frames behind the requested one
+        nextFrame = frame;
+        for (auto it = loadedFrames.begin(); it != loadedFrames.end();)
+        {
+            if (isFrameNeeded(it->first))
+                ++it;
+            else
+                it = loadedFrames.erase(it);
+        }
+        condition.notify_all();
+
+        // The requested frame is the first one that the thread loads when it isn't loaded yet
+        if (wait)
+            condition.wait(lock, [this, frame]() { return loadedFrames.find(frame) != loadedFrames.end(); });
+        else if (loadedFrames.find(frame) == loadedFrames.end())
+            return false;
+
+        // The frame is evicted once it is displayed
+        auto it = loadedFrames.find(frame);
+        image = std::move(it->second);
+        loadedFrames.erase(it);
+
+        if (looping && (frame + 1 == filenames.size()))
+            nextFrame = 0;
+        else
+            nextFrame = frame + 1;
+
+        condition.notify_all();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimatedPicture::StreamData::setLooping(bool loop)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            looping = loop;
+        }
+
+        condition.notify_all();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     AnimatedPicture::AnimatedPicture() :
     m_Textures       (),
     m_FrameDuration  (),
     m_CurrentFrame   (-1),
     m_Playing        (false),
-    m_Looping        (false)
+    m_Looping        (false),
+    m_Stream         (nullptr)
     {
         m_Callback.widgetType = Type_AnimatedPicture;
-        m_AnimatedWidget = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,13 +279,46 @@ namespace tgui
     m_FrameDuration(copy.m_FrameDuration),
     m_CurrentFrame (copy.m_CurrentFrame),
     m_Playing      (copy.m_Playing),
-    m_Looping      (copy.m_Looping)
+    m_Looping      (copy.m_Looping),
+    m_Stream       (nullptr)
     {
         for (unsigned int i = 0; i < copy.m_Textures.size(); ++i)
         {
             m_Textures.push_back(Texture());
             TGUI_TextureManager.copyTexture(copy.m_Textures[i], m_Textures.back());
         }
+
+        // The copy keeps playing when the original was playing
+        m_AnimatedWidget = m_Playing;
+
+        // A copy of a streamed animation gets its own thread, which starts at the frame that the original is displaying.
+        // The copy displays the texture of the original until its own thread has loaded that frame.
+        if (copy.m_Stream != nullptr)
+        {
+            m_Stream = new StreamData(copy.m_Stream->filenames, copy.m_Stream->preloadedFrames, m_Looping);
+            m_Stream->texture = copy.m_Stream->texture;
+            m_Stream->sprite.setTexture(m_Stream->texture, true);
+            m_Stream->sprite.setColor(copy.m_Stream->sprite.getColor());
+            showStreamedFrame(m_CurrentFrame, false);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnimatedPicture::AnimatedPicture(AnimatedPicture&& other) :
+    ClickableWidget(std::move(other)),
+    m_Textures     (std::move(other.m_Textures)),
+    m_FrameDuration(std::move(other.m_FrameDuration)),
+    m_CurrentFrame (other.m_CurrentFrame),
+    m_Playing      (other.m_Playing),
+    m_Looping      (other.m_Looping),
+    m_Stream       (other.m_Stream)
+    {
+        // The streaming thread keeps running, it now belongs to this animation
+        other.m_Stream = nullptr;
+
+        // The animation keeps playing when the original was playing
+        m_AnimatedWidget = m_Playing || isWaitingForStreamedFrame();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -69,6 +332,10 @@ namespace tgui
         // Clear the vectors
         m_Textures.clear();
         m_FrameDuration.clear();
+
+        // Stop the thread when the frames were streamed
+        if (m_Stream != nullptr)
+            delete m_Stream;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,6 +357,37 @@ namespace tgui
             std::swap(m_CurrentFrame,    temp.m_CurrentFrame);
             std::swap(m_Playing,         temp.m_Playing);
             std::swap(m_Looping,         temp.m_Looping);
+            std::swap(m_Stream,          temp.m_Stream);
+
+            if (m_Playing || isWaitingForStreamedFrame())
+                startAnimation();
+            else
+                stopAnimation();
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnimatedPicture& AnimatedPicture::operator= (AnimatedPicture&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            this->ClickableWidget::operator=(std::move(right));
+
+            std::swap(m_Textures,        right.m_Textures);
+            std::swap(m_FrameDuration,   right.m_FrameDuration);
+            std::swap(m_CurrentFrame,    right.m_CurrentFrame);
+            std::swap(m_Playing,         right.m_Playing);
+            std::swap(m_Looping,         right.m_Looping);
+            std::swap(m_Stream,          right.m_Stream);
+
+            if (m_Playing || isWaitingForStreamedFrame())
+                startAnimation();
+            else
+                stopAnimation();
         }
 
         return *this;
@@ -106,10 +404,18 @@ namespace tgui
 
     bool AnimatedPicture::addFrame(const std::string& filename, sf::Time frameDuration)
     {
+        invalidate();
+
         // Check if the filename is empty
         if (filename.empty())
             return false;
 
+        if (m_Stream != nullptr)
+        {
+            TGUI_OUTPUT("TGUI warning: Can't add a frame to an AnimatedPicture while its frames are streamed.");
+            return false;
+        }
+
         Texture tempTexture;
 
         // Try to load the texture from the file
@@ -140,8 +446,126 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool AnimatedPicture::addFrames(const std::string& filename, unsigned int rows, unsigned int columns, sf::Time frameDuration, unsigned int frameCount)
+    {
+        // Check if the parameters are valid
+        if (filename.empty() || (rows == 0) || (columns == 0))
+            return false;
+
+        // The image has to be loaded to know the size of the cells.
+        // It stays loaded until the frames got their own reference to it, so that the file is only decoded once.
+        Texture sheet;
+        if (!TGUI_TextureManager.getTexture(getResourcePath() + filename, sheet))
+            return false;
+
+        const unsigned int cellWidth = sheet.getSize().x / columns;
+        const unsigned int cellHeight = sheet.getSize().y / rows;
+
+        if ((frameCount == 0) || (frameCount > rows * columns))
+            frameCount = rows * columns;
+
+        std::vector<sf::IntRect> frameRects;
+        frameRects.reserve(frameCount);
+        for (unsigned int i = 0; i < frameCount; ++i)
+            frameRects.push_back(sf::IntRect((i % columns) * cellWidth, (i / columns) * cellHeight, cellWidth, cellHeight));
+
+        bool success = addFrames(filename, frameRects, frameDuration);
+
+        TGUI_TextureManager.removeTexture(sheet);
+        return success;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AnimatedPicture::addFrames(const std::string& filename, const std::vector<sf::IntRect>& frameRects, sf::Time frameDuration)
+    {
+        invalidate();
+
+        // Check if the filename is empty
+        if (filename.empty() || frameRects.empty())
+            return false;
+
+        if (m_Stream != nullptr)
+        {
+            TGUI_OUTPUT("TGUI warning: Can't add frames to an AnimatedPicture while its frames are streamed.");
+            return false;
+        }
+
+        Texture sheet;
+
+        // Try to load the texture from the file. When it was already loaded then the texture is reused.
+        if (!TGUI_TextureManager.getTexture(getResourcePath() + filename, sheet))
+            return false;
+
+        // If this is the first frame then set it as the current displayed frame
+        if (m_Textures.empty())
+        {
+            m_CurrentFrame = 0;
+
+            // Remember the size of the first frame
+            m_Size = sf::Vector2f(static_cast<float>(frameRects[0].width), static_cast<float>(frameRects[0].height));
+        }
+
+        // Every frame holds a reference to the same texture, but only displays its own part of it
+        m_Textures.reserve(m_Textures.size() + frameRects.size());
+        m_FrameDuration.reserve(m_FrameDuration.size() + frameRects.size());
+        for (unsigned int i = 0; i < frameRects.size(); ++i)
+        {
+            if (i == 0)
+                m_Textures.push_back(sheet);
+            else
+            {
+                m_Textures.push_back(Texture());
+                TGUI_TextureManager.copyTexture(sheet, m_Textures.back());
+            }
+
+            m_Textures.back().sprite.setTextureRect(frameRects[i]);
+            m_Textures.back().sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
+
+            m_FrameDuration.push_back(frameDuration);
+        }
+
+        return m_Loaded = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AnimatedPicture::loadStreamedFrames(const std::vector<std::string>& filenames, sf::Time frameDuration, unsigned int preloadedFrames)
+    {
+        // Remove the frames that were added before
+        removeAllFrames();
+
+        if (filenames.empty())
+            return false;
+
+        std::vector<std::string> paths;
+        paths.reserve(filenames.size());
+        for (auto it = filenames.cbegin(); it != filenames.cend(); ++it)
+            paths.push_back(getResourcePath() + *it);
+
+        m_Stream = new StreamData(paths, preloadedFrames, m_Looping);
+        m_Stream->sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
+
+        // The first frame is needed immediately, and it determines the size of the picture
+        if (!showStreamedFrame(0, true))
+        {
+            delete m_Stream;
+            m_Stream = nullptr;
+            return false;
+        }
+
+        m_FrameDuration.assign(filenames.size(), frameDuration);
+        m_CurrentFrame = 0;
+        m_Size = sf::Vector2f(m_Stream->texture.getSize());
+        return m_Loaded = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void AnimatedPicture::setSize(float width, float height)
     {
+        invalidate();
+
         m_Size.x = width;
         m_Size.y = height;
     }
@@ -150,7 +574,7 @@ namespace tgui
 
     sf::Vector2f AnimatedPicture::getSize() const
     {
-        if (m_Textures.empty() == false)
+        if (getFrames() > 0)
             return sf::Vector2f(m_Size.x, m_Size.y);
         else
             return sf::Vector2f(0, 0);
@@ -160,8 +584,10 @@ namespace tgui
 
     void AnimatedPicture::play()
     {
+        invalidate();
+
         // You can't start playing when no frames were loaded
-        if (m_Textures.empty())
+        if (getFrames() == 0)
             return;
 
         // Start playing
@@ -169,49 +595,70 @@ namespace tgui
 
         // Reset the elapsed time
         m_AnimationTimeElapsed = sf::Time();
+        startAnimation();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void AnimatedPicture::pause()
     {
+        invalidate();
+
         m_Playing = false;
+
+        // The widget is still updated when it is waiting for the thread to load the frame that should be displayed
+        if (!isWaitingForStreamedFrame())
+            stopAnimation();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void AnimatedPicture::stop()
     {
+        invalidate();
+
         m_Playing = false;
+        stopAnimation();
 
-        if (m_Textures.empty())
+        if (getFrames() == 0)
             m_CurrentFrame = -1;
         else
+        {
             m_CurrentFrame = 0;
+
+            if ((m_Stream != nullptr) && (m_Stream->takenFrame != 0))
+                showStreamedFrame(0, false);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool AnimatedPicture::setFrame(unsigned int frame)
     {
+        invalidate();
+
         // Check if there are no frames
-        if (m_Textures.empty() == true)
+        if (getFrames() == 0)
         {
             m_CurrentFrame = -1;
             return false;
         }
 
         // Make sure the number isn't too high
-        if (frame >= m_Textures.size())
+        bool validFrame = true;
+        if (frame >= getFrames())
         {
             // Display the last frame
-            m_CurrentFrame = m_Textures.size()-1;
-            return false;
+            frame = getFrames()-1;
+            validFrame = false;
         }
 
-        // The frame number isn't too high
         m_CurrentFrame = frame;
-        return true;
+
+        if ((m_Stream != nullptr) && (m_Stream->takenFrame != m_CurrentFrame))
+            showStreamedFrame(frame, false);
+
+        return validFrame;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -238,13 +685,24 @@ namespace tgui
 
     unsigned int AnimatedPicture::getFrames() const
     {
-        return m_Textures.size();
+        if (m_Stream != nullptr)
+            return m_Stream->filenames.size();
+        else
+            return m_Textures.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool AnimatedPicture::removeFrame(unsigned int frame)
     {
+        invalidate();
+
+        if (m_Stream != nullptr)
+        {
+            TGUI_OUTPUT("TGUI warning: Can't remove a frame from an AnimatedPicture while its frames are streamed.");
+            return false;
+        }
+
         // Make sure the number isn't too high
         if (frame >= m_Textures.size())
             return false;
@@ -269,6 +727,8 @@ namespace tgui
 
     void AnimatedPicture::removeAllFrames()
     {
+        invalidate();
+
         // Remove the textures (if we are the only one using it)
         for (unsigned int i=0; i< m_Textures.size(); ++i)
             TGUI_TextureManager.removeTexture(m_Textures[i]);
@@ -277,6 +737,13 @@ namespace tgui
         m_Textures.clear();
         m_FrameDuration.clear();
 
+        // Stop the thread when the frames were streamed
+        if (m_Stream != nullptr)
+        {
+            delete m_Stream;
+            m_Stream = nullptr;
+        }
+
         // Reset the animation
         stop();
         m_Loaded = false;
@@ -286,7 +753,12 @@ namespace tgui
 
     void AnimatedPicture::setLooping(bool loop)
     {
+        invalidate();
+
         m_Looping = loop;
+
+        if (m_Stream != nullptr)
+            m_Stream->setLooping(loop);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -307,10 +779,15 @@ namespace tgui
 
     void AnimatedPicture::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         for (unsigned int i = 0; i < m_Textures.size(); ++i)
             m_Textures[i].sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
+
+        if (m_Stream != nullptr)
+            m_Stream->sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,18 +799,21 @@ namespace tgui
         if (property == "playing")
         {
             if ((value == "true") || (value == "True"))
+            {
                 m_Playing = true;
+                startAnimation();
+            }
             else if ((value == "false") || (value == "False"))
-                m_Playing = false;
+                pause();
             else
                 TGUI_OUTPUT("TGUI error: Failed to parse 'Playing' property.");
         }
         else if (property == "looping")
         {
             if ((value == "true") || (value == "True"))
-                m_Looping = true;
+                setLooping(true);
             else if ((value == "false") || (value == "False"))
-                m_Looping = false;
+                setLooping(false);
             else
                 TGUI_OUTPUT("TGUI error: Failed to parse 'Looping' property.");
         }
@@ -405,9 +885,17 @@ namespace tgui
 
     void AnimatedPicture::update()
     {
-        // Only continue when you are playing
+        // Only continue when you are playing, or when the displayed streamed frame still has to be loaded
         if (m_Playing == false)
+        {
+            if (isWaitingForStreamedFrame())
+                showStreamedFrame(m_CurrentFrame, false);
+
+            if (!isWaitingForStreamedFrame())
+                stopAnimation();
+
             return;
+        }
 
         // Check if the next frame should be displayed
         while (m_AnimationTimeElapsed > m_FrameDuration[m_CurrentFrame])
@@ -419,7 +907,7 @@ namespace tgui
                 m_AnimationTimeElapsed -= m_FrameDuration[m_CurrentFrame];
 
                 // Make the next frame visible
-                if (static_cast<unsigned int>(m_CurrentFrame + 1) < m_Textures.size())
+                if (static_cast<unsigned int>(m_CurrentFrame + 1) < getFrames())
                     ++m_CurrentFrame;
                 else
                 {
@@ -431,6 +919,7 @@ namespace tgui
                         // Looping is disabled so stop the animation
                         m_Playing = false;
                         m_AnimationTimeElapsed = sf::Time();
+                        stopAnimation();
                     }
 
                     // The animation has finished, send a callback if needed
@@ -445,21 +934,94 @@ namespace tgui
             else // The frame has to remain visible
                 m_AnimationTimeElapsed = sf::Time();
         }
+
+        // When the frames are streamed then only the last frame has to be loaded, the skipped frames are just forgotten.
+        // When the thread hasn't loaded it yet then the previous frame remains visible and the next update tries again.
+        if (isWaitingForStreamedFrame())
+            showStreamedFrame(m_CurrentFrame, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time AnimatedPicture::getTimeUntilNextUpdate() const
+    {
+        // A frame without a duration remains visible until the animation is changed from the outside
+        sf::Time timeUntilNextUpdate = sf::microseconds(std::numeric_limits<sf::Int64>::max());
+        if (m_Playing && (m_FrameDuration[m_CurrentFrame] != sf::Time()))
+            timeUntilNextUpdate = m_FrameDuration[m_CurrentFrame] - m_AnimationTimeElapsed;
+
+        // While the thread is loading the frame that should be displayed, the widget checks every 10ms whether it is available
+        if (isWaitingForStreamedFrame())
+        {
+            const sf::Time timeUntilRetry = sf::milliseconds(10) - m_Stream->retryClock.getElapsedTime();
+            if (timeUntilRetry < timeUntilNextUpdate)
+                timeUntilNextUpdate = timeUntilRetry;
+        }
+
+        return timeUntilNextUpdate;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void AnimatedPicture::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        if (m_Loaded)
+        if (m_Stream != nullptr)
+        {
+            states.transform *= getTransform();
+            states.transform.scale(m_Size.x / m_Stream->texture.getSize().x, m_Size.y / m_Stream->texture.getSize().y);
+            target.draw(m_Stream->sprite, states);
+        }
+        else if (m_Loaded)
         {
             states.transform *= getTransform();
-            states.transform.scale(m_Size.x / m_Textures[m_CurrentFrame].getSize().x, m_Size.y / m_Textures[m_CurrentFrame].getSize().y);
+            // Frames from a sheet only display a part of their texture
+            const sf::IntRect& frameRect = m_Textures[m_CurrentFrame].sprite.getTextureRect();
+            states.transform.scale(m_Size.x / frameRect.width, m_Size.y / frameRect.height);
             target.draw(m_Textures[m_CurrentFrame], states);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AnimatedPicture::showStreamedFrame(unsigned int frame, bool wait)
+    {
+        // Keep displaying the current texture and try again later when the thread hasn't loaded the frame yet
+        std::unique_ptr<sf::Image> image;
+        if (!m_Stream->takeFrame(frame, wait, image))
+        {
+            m_Stream->retryClock.restart();
+            startAnimation();
+            return true;
+        }
+
+        // A frame that failed to load isn't requested again, the previous frame then simply remains visible
+        m_Stream->takenFrame = frame;
+        if (!image)
+        {
+            TGUI_OUTPUT("TGUI error: Failed to load " + m_Stream->filenames[frame] + ".");
+            return false;
+        }
+
+        // The existing texture is reused when the frames have the same size
+        if (m_Stream->texture.getSize() == image->getSize())
+            m_Stream->texture.update(*image);
+        else
+        {
+            m_Stream->texture.loadFromImage(*image);
+            m_Stream->sprite.setTexture(m_Stream->texture, true);
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AnimatedPicture::isWaitingForStreamedFrame() const
+    {
+        return (m_Stream != nullptr) && (m_Stream->takenFrame != m_CurrentFrame);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
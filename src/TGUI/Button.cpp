@@ -69,6 +69,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Button::Button(Button&& other) :
+    ClickableWidget     (std::move(other)),
+    m_LoadedConfigFile  (std::move(other.m_LoadedConfigFile)),
+    m_SplitImage        (other.m_SplitImage),
+    m_SeparateHoverImage(other.m_SeparateHoverImage),
+    m_Text              (std::move(other.m_Text)),
+    m_TextSize          (other.m_TextSize)
+    {
+        // Take over the textures, the other widget will no longer release them
+        std::swap(m_TextureNormal_L, other.m_TextureNormal_L);
+        std::swap(m_TextureNormal_M, other.m_TextureNormal_M);
+        std::swap(m_TextureNormal_R, other.m_TextureNormal_R);
+        std::swap(m_TextureHover_L, other.m_TextureHover_L);
+        std::swap(m_TextureHover_M, other.m_TextureHover_M);
+        std::swap(m_TextureHover_R, other.m_TextureHover_R);
+        std::swap(m_TextureDown_L, other.m_TextureDown_L);
+        std::swap(m_TextureDown_M, other.m_TextureDown_M);
+        std::swap(m_TextureDown_R, other.m_TextureDown_R);
+        std::swap(m_TextureFocused_L, other.m_TextureFocused_L);
+        std::swap(m_TextureFocused_M, other.m_TextureFocused_M);
+        std::swap(m_TextureFocused_R, other.m_TextureFocused_R);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Button::~Button()
     {
         if (m_TextureNormal_L.data != nullptr)   TGUI_TextureManager.removeTexture(m_TextureNormal_L);
@@ -122,6 +147,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Button& Button::operator= (Button&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            this->ClickableWidget::operator=(std::move(right));
+
+            std::swap(m_LoadedConfigFile,   right.m_LoadedConfigFile);
+            std::swap(m_TextureNormal_L,    right.m_TextureNormal_L);
+            std::swap(m_TextureNormal_M,    right.m_TextureNormal_M);
+            std::swap(m_TextureNormal_R,    right.m_TextureNormal_R);
+            std::swap(m_TextureHover_L,     right.m_TextureHover_L);
+            std::swap(m_TextureHover_M,     right.m_TextureHover_M);
+            std::swap(m_TextureHover_R,     right.m_TextureHover_R);
+            std::swap(m_TextureDown_L,      right.m_TextureDown_L);
+            std::swap(m_TextureDown_M,      right.m_TextureDown_M);
+            std::swap(m_TextureDown_R,      right.m_TextureDown_R);
+            std::swap(m_TextureFocused_L,   right.m_TextureFocused_L);
+            std::swap(m_TextureFocused_M,   right.m_TextureFocused_M);
+            std::swap(m_TextureFocused_R,   right.m_TextureFocused_R);
+            std::swap(m_SplitImage,         right.m_SplitImage);
+            std::swap(m_SeparateHoverImage, right.m_SeparateHoverImage);
+            std::swap(m_Text,               right.m_Text);
+            std::swap(m_TextSize,           right.m_TextSize);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Button* Button::clone()
     {
         return new Button(*this);
@@ -409,7 +465,7 @@ namespace tgui
 
     void Button::setPosition(float x, float y)
     {
-        Transformable::setPosition(x, y);
+        Widget::setPosition(x, y);
 
         if (m_SplitImage)
         {
@@ -458,6 +514,8 @@ namespace tgui
 
     void Button::setSize(float width, float height)
     {
+        invalidate();
+
         // Don't do anything when the button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -519,6 +577,8 @@ namespace tgui
 
     void Button::setText(const sf::String& text)
     {
+        invalidate();
+
         // Don't do anything when the button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -560,6 +620,8 @@ namespace tgui
 
     void Button::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_Text.setFont(font);
 
         // Call setText to reposition the text
@@ -577,6 +639,8 @@ namespace tgui
 
     void Button::setTextColor(const sf::Color& color)
     {
+        invalidate();
+
         m_Text.setColor(color);
     }
 
@@ -591,6 +655,8 @@ namespace tgui
 
     void Button::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Change the text size
         m_TextSize = size;
 
@@ -610,6 +676,8 @@ namespace tgui
 
     void Button::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         if (m_SplitImage)
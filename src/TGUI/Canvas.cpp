@@ -81,7 +81,7 @@ namespace tgui
 
     void Canvas::setPosition(float x, float y)
     {
-        Transformable::setPosition(x, y);
+        Widget::setPosition(x, y);
 
         m_sprite.setPosition(x, y);
     }
@@ -90,11 +90,14 @@ namespace tgui
 
     void Canvas::setSize(float width, float height)
     {
+        invalidate();
+
         m_renderTexture.create(static_cast<unsigned int>(width), static_cast<unsigned int>(height));
         m_sprite.setTexture(m_renderTexture.getTexture(), true);
 
         m_renderTexture.clear();
         m_renderTexture.display();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,6 +111,8 @@ namespace tgui
 
     void Canvas::clear(const sf::Color& color)
     {
+        invalidate();
+
         m_renderTexture.clear(color);
     }
 
@@ -130,6 +135,7 @@ namespace tgui
     void Canvas::display()
     {
         m_renderTexture.display();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -83,6 +83,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ChatBox::ChatBox(ChatBox&& other) :
+        Widget                (std::move(other)),
+        WidgetBorders         (other),
+        m_LoadedConfigFile    (std::move(other.m_LoadedConfigFile)),
+        m_LineSpacing         (other.m_LineSpacing),
+        m_TextSize            (other.m_TextSize),
+        m_TextColor           (other.m_TextColor),
+        m_BorderColor         (other.m_BorderColor),
+        m_MaxLines            (other.m_MaxLines),
+        m_FullTextHeight      (other.m_FullTextHeight),
+        m_LinesStartFromBottom(other.m_LinesStartFromBottom)
+    {
+        // Take over the panel containing the lines and the scrollbar, and leave an empty panel behind
+        m_Panel = other.m_Panel;
+        other.m_Panel = new Panel();
+
+        m_Scroll = other.m_Scroll;
+        other.m_Scroll = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ChatBox::~ChatBox()
     {
         delete m_Panel;
@@ -125,6 +147,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ChatBox& ChatBox::operator= (ChatBox&& right)
+    {
+        if (this != &right)
+        {
+            this->Widget::operator=(std::move(right));
+            this->WidgetBorders::operator=(right);
+
+            std::swap(m_LoadedConfigFile,     right.m_LoadedConfigFile);
+            std::swap(m_LineSpacing,          right.m_LineSpacing);
+            std::swap(m_TextSize,             right.m_TextSize);
+            std::swap(m_TextColor,            right.m_TextColor);
+            std::swap(m_BorderColor,          right.m_BorderColor);
+            std::swap(m_MaxLines,             right.m_MaxLines);
+            std::swap(m_FullTextHeight,       right.m_FullTextHeight);
+            std::swap(m_LinesStartFromBottom, right.m_LinesStartFromBottom);
+            std::swap(m_Panel,                right.m_Panel);
+            std::swap(m_Scroll,               right.m_Scroll);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ChatBox* ChatBox::clone()
     {
         return new ChatBox(*this);
@@ -237,6 +283,8 @@ namespace tgui
 
     void ChatBox::setSize(float width, float height)
     {
+        invalidate();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -292,6 +340,8 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text)
     {
+        invalidate();
+
         addLine(text, m_TextColor, m_TextSize);
     }
 
@@ -299,6 +349,8 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text, const sf::Color& color)
     {
+        invalidate();
+
         addLine(text, color, m_TextSize);
     }
 
@@ -306,6 +358,8 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text, unsigned int textSize)
     {
+        invalidate();
+
         addLine(text, m_TextColor, textSize);
     }
 
@@ -313,6 +367,8 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const sf::Font* font)
     {
+        invalidate();
+
         auto& widgets = m_Panel->getWidgets();
 
         // Remove the top line if you exceed the maximum
@@ -384,6 +440,8 @@ namespace tgui
 
     bool ChatBox::removeLine(unsigned int lineIndex)
     {
+        invalidate();
+
         if (lineIndex < m_Panel->getWidgets().size())
         {
             tgui::Label::Ptr label = m_Panel->getWidgets()[lineIndex];
@@ -404,6 +462,8 @@ namespace tgui
 
     void ChatBox::removeAllLines()
     {
+        invalidate();
+
         m_Panel->removeAllWidgets();
 
         m_FullTextHeight = 0;
@@ -425,6 +485,8 @@ namespace tgui
 
     void ChatBox::setLineLimit(unsigned int maxLines)
     {
+        invalidate();
+
         m_MaxLines = maxLines;
 
         if ((m_MaxLines > 0) && (m_MaxLines < m_Panel->getWidgets().size()))
@@ -446,6 +508,8 @@ namespace tgui
 
     void ChatBox::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_Panel->setGlobalFont(font);
 
         m_FullTextHeight = 0;
@@ -479,6 +543,8 @@ namespace tgui
 
     void ChatBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Store the new text size
         m_TextSize = size;
 
@@ -498,6 +564,8 @@ namespace tgui
 
     void ChatBox::setTextColor(const sf::Color& color)
     {
+        invalidate();
+
         m_TextColor = color;
     }
 
@@ -512,6 +580,8 @@ namespace tgui
 
     void ChatBox::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        invalidate();
+
         m_LeftBorder   = leftBorder;
         m_TopBorder    = topBorder;
         m_RightBorder  = rightBorder;
@@ -522,6 +592,8 @@ namespace tgui
 
     void ChatBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_Panel->setBackgroundColor(backgroundColor);
     }
 
@@ -529,6 +601,8 @@ namespace tgui
 
     void ChatBox::setBorderColor(const sf::Color& borderColor)
     {
+        invalidate();
+
         m_BorderColor = borderColor;
     }
 
@@ -550,6 +624,8 @@ namespace tgui
 
     void ChatBox::setLineSpacing(unsigned int lineSpacing)
     {
+        invalidate();
+
         m_LineSpacing = lineSpacing;
 
         updateDisplayedText();
@@ -559,6 +635,8 @@ namespace tgui
 
     void ChatBox::setLinesStartFromBottom(bool startFromBottom)
     {
+        invalidate();
+
         m_LinesStartFromBottom = startFromBottom;
 
         updateDisplayedText();
@@ -568,6 +646,8 @@ namespace tgui
 
     bool ChatBox::setScrollbar(const std::string& scrollbarConfigFileFilename)
     {
+        invalidate();
+
         // Do nothing when the string is empty
         if (scrollbarConfigFileFilename.empty() == true)
             return false;
@@ -602,6 +682,8 @@ namespace tgui
 
     void ChatBox::removeScrollbar()
     {
+        invalidate();
+
         // Delete the scrollbar
         delete m_Scroll;
         m_Scroll = nullptr;
@@ -611,6 +693,8 @@ namespace tgui
 
     void ChatBox::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         m_Panel->setTransparency(transparency);
@@ -164,6 +164,8 @@ namespace tgui
 
     void Checkbox::check()
     {
+        invalidate();
+
         if (m_Checked == false)
         {
             m_Checked = true;
@@ -182,6 +184,8 @@ namespace tgui
 
     void Checkbox::uncheck()
     {
+        invalidate();
+
         if (m_Checked)
         {
             m_Checked = false;
@@ -92,6 +92,44 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ChildWindow::ChildWindow(ChildWindow&& other) :
+    Container            (std::move(other)),
+    WidgetBorders        (other),
+    m_LoadedConfigFile   (std::move(other.m_LoadedConfigFile)),
+    m_Size               (other.m_Size),
+    m_BackgroundColor    (other.m_BackgroundColor),
+    m_BackgroundTexture  (other.m_BackgroundTexture),
+    m_TitleText          (std::move(other.m_TitleText)),
+    m_TitleBarHeight     (other.m_TitleBarHeight),
+    m_SplitImage         (other.m_SplitImage),
+    m_DraggingPosition   (other.m_DraggingPosition),
+    m_DistanceToSide     (other.m_DistanceToSide),
+    m_TitleAlignment     (other.m_TitleAlignment),
+    m_BorderColor        (other.m_BorderColor),
+    m_MouseDownOnTitleBar(other.m_MouseDownOnTitleBar),
+    m_KeepInParent       (other.m_KeepInParent)
+    {
+        // Take over the textures, the other widget will no longer release them
+        std::swap(m_IconTexture, other.m_IconTexture);
+        std::swap(m_TextureTitleBar_L, other.m_TextureTitleBar_L);
+        std::swap(m_TextureTitleBar_M, other.m_TextureTitleBar_M);
+        std::swap(m_TextureTitleBar_R, other.m_TextureTitleBar_R);
+
+        // Take over the button and leave an empty one behind
+        m_CloseButton = other.m_CloseButton;
+        other.m_CloseButton = new Button();
+
+        // Set the bakground sprite, if there is a background texture
+        if (other.m_BackgroundTexture)
+        {
+            m_BackgroundSprite.setTexture(*m_BackgroundTexture, true);
+            m_BackgroundSprite.setScale(m_Size.x / m_BackgroundTexture->getSize().x, m_Size.y / m_BackgroundTexture->getSize().y);
+            m_BackgroundSprite.setColor(sf::Color(255, 255, 255, m_Opacity));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ChildWindow::~ChildWindow()
     {
         if (m_TextureTitleBar_L.data != nullptr)   TGUI_TextureManager.removeTexture(m_TextureTitleBar_L);
@@ -147,6 +185,40 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ChildWindow& ChildWindow::operator= (ChildWindow&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            this->Container::operator=(std::move(right));
+            this->WidgetBorders::operator=(right);
+
+            std::swap(m_LoadedConfigFile,    right.m_LoadedConfigFile);
+            std::swap(m_Size,                right.m_Size);
+            std::swap(m_BackgroundColor,     right.m_BackgroundColor);
+            std::swap(m_BackgroundTexture,   right.m_BackgroundTexture);
+            std::swap(m_BackgroundSprite,    right.m_BackgroundSprite);
+            std::swap(m_IconTexture,         right.m_IconTexture);
+            std::swap(m_TitleText,           right.m_TitleText);
+            std::swap(m_TitleBarHeight,      right.m_TitleBarHeight);
+            std::swap(m_SplitImage,          right.m_SplitImage);
+            std::swap(m_DraggingPosition,    right.m_DraggingPosition);
+            std::swap(m_DistanceToSide,      right.m_DistanceToSide);
+            std::swap(m_TitleAlignment,      right.m_TitleAlignment);
+            std::swap(m_BorderColor,         right.m_BorderColor);
+            std::swap(m_MouseDownOnTitleBar, right.m_MouseDownOnTitleBar);
+            std::swap(m_TextureTitleBar_L,   right.m_TextureTitleBar_L);
+            std::swap(m_TextureTitleBar_M,   right.m_TextureTitleBar_M);
+            std::swap(m_TextureTitleBar_R,   right.m_TextureTitleBar_R);
+            std::swap(m_CloseButton,         right.m_CloseButton);
+            std::swap(m_KeepInParent,        right.m_KeepInParent);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ChildWindow* ChildWindow::clone()
     {
         return new ChildWindow(*this);
@@ -369,6 +441,8 @@ namespace tgui
 
     void ChildWindow::setSize(float width, float height)
     {
+        invalidate();
+
         // A negative size is not allowed for this widget
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -421,6 +495,8 @@ namespace tgui
 
     void ChildWindow::setBackgroundTexture(sf::Texture *const texture)
     {
+        invalidate();
+
         // Store the texture
         m_BackgroundTexture = texture;
 
@@ -443,6 +519,8 @@ namespace tgui
 
     void ChildWindow::setTitleBarHeight(unsigned int height)
     {
+        invalidate();
+
         // Don't continue when the child window has not been loaded yet
         if (m_Loaded == false)
             return;
@@ -490,6 +568,8 @@ namespace tgui
 
     void ChildWindow::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_BackgroundColor = backgroundColor;
     }
 
@@ -504,6 +584,8 @@ namespace tgui
 
     void ChildWindow::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Container::setTransparency(transparency);
 
         m_BackgroundSprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -521,6 +603,8 @@ namespace tgui
 
     void ChildWindow::setTitle(const sf::String& title)
     {
+        invalidate();
+
         m_TitleText.setString(title);
     }
 
@@ -535,6 +619,8 @@ namespace tgui
 
     void ChildWindow::setTitleColor(const sf::Color& color)
     {
+        invalidate();
+
         m_TitleText.setColor(color);
     }
 
@@ -549,6 +635,8 @@ namespace tgui
 
     void ChildWindow::setBorderColor(const sf::Color& borderColor)
     {
+        invalidate();
+
         m_BorderColor = borderColor;
     }
 
@@ -563,6 +651,8 @@ namespace tgui
 
     void ChildWindow::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        invalidate();
+
         // Set the new border size
         m_LeftBorder   = leftBorder;
         m_TopBorder    = topBorder;
@@ -591,6 +681,8 @@ namespace tgui
 
     void ChildWindow::setDistanceToSide(unsigned int distanceToSide)
     {
+        invalidate();
+
         m_DistanceToSide = distanceToSide;
     }
 
@@ -605,6 +697,8 @@ namespace tgui
 
     void ChildWindow::setTitleAlignment(TitleAlignment alignment)
     {
+        invalidate();
+
         m_TitleAlignment = alignment;
     }
 
@@ -619,6 +713,8 @@ namespace tgui
 
     void ChildWindow::setIcon(const std::string& filename)
     {
+        invalidate();
+
         // If a texture has already been loaded then remove it first
         if (m_IconTexture.data)
             TGUI_TextureManager.removeTexture(m_IconTexture);
@@ -637,6 +733,8 @@ namespace tgui
 
     void ChildWindow::removeIcon()
     {
+        invalidate();
+
         if (m_IconTexture.data)
             TGUI_TextureManager.removeTexture(m_IconTexture);
     }
@@ -652,6 +750,8 @@ namespace tgui
 
     void ChildWindow::keepInParent(bool enabled)
     {
+        invalidate();
+
         m_KeepInParent = enabled;
     }
 
@@ -676,21 +776,21 @@ namespace tgui
         if (m_KeepInParent)
         {
             if (y < 0)
-                Transformable::setPosition(getPosition().x, 0);
+                Widget::setPosition(getPosition().x, 0);
             else if (y > m_Parent->getSize().y - m_TitleBarHeight)
-                Transformable::setPosition(getPosition().x, m_Parent->getSize().y - m_TitleBarHeight);
+                Widget::setPosition(getPosition().x, m_Parent->getSize().y - m_TitleBarHeight);
             else
-                Transformable::setPosition(getPosition().x, y);
+                Widget::setPosition(getPosition().x, y);
 
             if (x < 0)
-                Transformable::setPosition(0, getPosition().y);
+                Widget::setPosition(0, getPosition().y);
             else if (x > m_Parent->getSize().x - getSize().x)
-                Transformable::setPosition(m_Parent->getSize().x - getSize().x, getPosition().y);
+                Widget::setPosition(m_Parent->getSize().x - getSize().x, getPosition().y);
             else
-                Transformable::setPosition(x, getPosition().y);
+                Widget::setPosition(x, getPosition().y);
         }
         else
-            Transformable::setPosition(x, y);
+            Widget::setPosition(x, y);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -704,9 +804,7 @@ namespace tgui
         // Check if the mouse is on top of the title bar
         if (getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x + m_LeftBorder + m_RightBorder, static_cast<float>(m_TitleBarHeight))).contains(x, y))
         {
-            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
-
+            setHoveredWidget(nullptr);
             return true;
         }
         else
@@ -721,8 +819,7 @@ namespace tgui
                     mouseLeftWidget();
 
                     // Tell the widgets inside the child window that the mouse is no longer on top of them
-                    for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                        m_Widgets[i]->mouseNotOnWidget();
+                    setHoveredWidget(nullptr);
 
                     m_CloseButton->mouseNotOnWidget();
                     m_MouseHover = false;
@@ -834,8 +931,7 @@ namespace tgui
             }
 
             // Tell the widgets that the mouse is no longer down
-            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNoLongerDown();
+            releasePressedWidgets(nullptr);
 
             // Reset the position of the button
             m_CloseButton->setPosition(0, 0);
@@ -854,8 +950,7 @@ namespace tgui
             &&  (getTransform().transformRect(sf::FloatRect(static_cast<float>(m_LeftBorder), static_cast<float>(m_TitleBarHeight + m_TopBorder), m_Size.x, m_Size.y)).contains(x, y) == false))
             {
                 // Tell the widgets about that the mouse was released
-                for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                    m_Widgets[i]->mouseNoLongerDown();
+                releasePressedWidgets(nullptr);
 
                 // Don't send the event to the widgets
                 return;
@@ -1278,7 +1373,7 @@ namespace tgui
         glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
 
         // Draw the widgets in the child window
-        drawWidgetContainer(&target, states);
+        drawWidgetContainer(&target, states, sf::IntRect(scissorLeft, scissorTop, scissorRight - scissorLeft, scissorBottom - scissorTop));
 
         // Reset the old clipping area
         glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
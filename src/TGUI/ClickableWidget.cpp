@@ -47,6 +47,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ClickableWidget::ClickableWidget(ClickableWidget&& other) :
+    Widget(std::move(other)),
+    m_Size(other.m_Size)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ClickableWidget::~ClickableWidget()
     {
     }
@@ -69,6 +77,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ClickableWidget& ClickableWidget::operator= (ClickableWidget&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            this->Widget::operator=(std::move(right));
+
+            std::swap(m_Size, right.m_Size);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ClickableWidget* ClickableWidget::clone()
     {
         return new ClickableWidget(*this);
@@ -78,6 +101,8 @@ namespace tgui
 
     void ClickableWidget::setSize(float width, float height)
     {
+        invalidate();
+
         m_Size.x = width;
         m_Size.y = height;
     }
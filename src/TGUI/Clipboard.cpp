@@ -29,17 +29,716 @@
 
 #ifdef SFML_SYSTEM_WINDOWS
     #include <windows.h>
+#elif defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD)
+    #include <SFML/System/Utf.hpp>
+    #include <X11/Xlib.h>
+    #include <X11/Xatom.h>
+    #include <sys/select.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <chrono>
+    #include <climits>
+    #include <iterator>
+    #include <memory>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // The X11 clipboard runs on its own thread with its own connection to the X server. Other applications can then get the
+    // contents at any time, without the clipboard having to see the events of the SFML window.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct Clipboard::X11Data
+    {
+        // A transfer of the contents to another application that is sent in parts (the INCR protocol)
+        struct OutgoingTransfer
+        {
+            Window requestor;
+            Atom   property;
+            Atom   type;
+            std::shared_ptr<const std::string> data;
+            std::size_t offset;
+        };
+
+        // Ignores the errors of the requests that are made during its lifetime, e.g. when the other application disappears
+        // in the middle of a transfer. The error handler of the application is replaced while the trap exists, errors on
+        // other connections are passed on to it.
+        struct ErrorTrap
+        {
+            explicit ErrorTrap(X11Data& data);
+            ~ErrorTrap();
+
+            // Waits until the X server has handled the requests, and returns whether any of them failed
+            bool failed();
+
+            X11Data& x11;
+            std::lock_guard<std::mutex> lock;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Takes over the connection to the X server and the wake-up pipe, and starts the thread. The contents are shared with
+        // the Clipboard.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        X11Data(Display* connection, const int pipeDescriptors[2], sf::String& clipboardContents);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stops the thread and closes the connection.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~X11Data();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes the thread handle the new requests from the Clipboard functions.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wakeUp();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Asks the thread to get the contents from the application that owns the clipboard. Returns false when this application
+        // is the owner itself, the contents are then already known.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool requestTransfer();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The function that runs on the thread. It handles the X11 events until the clipboard is destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void run();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sends the contents to another application that asks for them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void handleSelectionRequest(const XSelectionRequestEvent& request);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sends the next part of a transfer after the other application has read the previous part.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void continueOutgoingTransfer(Window requestor, Atom property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reads the property in which the owner of the clipboard has placed (a part of) the contents.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void readProperty();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Decodes received UTF-8 text and adds it to the received contents. A character that is split between two parts of
+        // the transfer is kept until the rest of it arrives.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void appendUtf8(const char* begin, const char* end);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the Clipboard that the transfer is over. Nothing happens when the Clipboard already gave up on the transfer.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishIncomingTransfer(bool success);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the contents encoded as UTF-8. The encoded text is shared by all transfers until the contents change.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<const std::string> getUtf8Contents();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The error handler while an ErrorTrap exists. Errors of the requests inside the trap are ignored, all other errors
+        // are passed on to the error handler of the application.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static int handleError(Display* connection, XErrorEvent* error);
+
+
+        Display* display;
+        Window   window;
+
+        Atom clipboard;
+        Atom targets;
+        Atom utf8String;
+        Atom text;
+        Atom incr;
+        Atom property;
+
+        // The maximum amount of bytes that is sent at once, bigger contents are sent with INCR
+        std::size_t maxChunkSize;
+
+        // The thread sleeps until an event arrives or until something is written to this pipe
+        int wakeUpPipe[2];
+
+        // The first request of the active ErrorTrap and whether one of its requests failed, only accessed by the thread
+        unsigned long errorTrapSerial;
+        bool errorTrapped;
+
+        // The error handler is shared by the whole application, so only one ErrorTrap can exist at a time
+        static std::mutex errorTrapMutex;
+        static X11Data* trappingClipboard;
+        static XErrorHandler previousErrorHandler;
+
+        std::thread thread;
+        std::mutex mutex;
+
+        // The contents of the Clipboard object, only accessed while the mutex is locked
+        sf::String& contents;
+        std::shared_ptr<const std::string> utf8Contents;
+
+        // The state that is shared between the thread and the Clipboard functions, protected by the mutex
+        bool running;
+        bool ownershipRequested;
+        bool ownsSelection;
+        bool transferRequested;
+        bool transferActive;
+        bool transferFinished;
+        bool transferSucceeded;
+
+        // When the owner of the clipboard last responded, the Clipboard gives up on the transfer when this is too long ago
+        std::chrono::steady_clock::time_point transferActivityTime;
+
+        // The contents that are being received from another application, only accessed by the thread until the transfer ends
+        Atom requestedTarget;
+        bool receivingIncr;
+        sf::String receivedContents;
+        std::string utf8Remainder;
+        std::basic_string<sf::Uint32> decodedText;
+
+        std::vector<OutgoingTransfer> outgoingTransfers;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::mutex Clipboard::X11Data::errorTrapMutex;
+    Clipboard::X11Data* Clipboard::X11Data::trappingClipboard = nullptr;
+    XErrorHandler Clipboard::X11Data::previousErrorHandler = nullptr;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Clipboard::X11Data::ErrorTrap::ErrorTrap(X11Data& data) :
+    x11 (data),
+    lock(errorTrapMutex)
+    {
+        x11.errorTrapSerial = XNextRequest(x11.display);
+        x11.errorTrapped = false;
+
+        trappingClipboard = &x11;
+        previousErrorHandler = XSetErrorHandler(&X11Data::handleError);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Clipboard::X11Data::ErrorTrap::~ErrorTrap()
+    {
+        // Wait until the X server has handled the requests, so that their errors arrive while the trap still exists
+        XSync(x11.display, False);
+
+        XSetErrorHandler(previousErrorHandler);
+        trappingClipboard = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Clipboard::X11Data::ErrorTrap::failed()
+    {
+        XSync(x11.display, False);
+        return x11.errorTrapped;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Clipboard::X11Data::X11Data(Display* connection, const int pipeDescriptors[2], sf::String& clipboardContents) :
+    display           (connection),
+    window            (0),
+    clipboard         (XInternAtom(connection, "CLIPBOARD", False)),
+    targets           (XInternAtom(connection, "TARGETS", False)),
+    utf8String        (XInternAtom(connection, "UTF8_STRING", False)),
+    text              (XInternAtom(connection, "TEXT", False)),
+    incr              (XInternAtom(connection, "INCR", False)),
+    property          (XInternAtom(connection, "TGUI_CLIPBOARD", False)),
+    maxChunkSize      (0),
+    errorTrapSerial   (0),
+    errorTrapped      (false),
+    contents          (clipboardContents),
+    running           (true),
+    ownershipRequested(false),
+    ownsSelection     (false),
+    transferRequested (false),
+    transferActive    (false),
+    transferFinished  (false),
+    transferSucceeded (false),
+    requestedTarget   (None),
+    receivingIncr     (false)
+    {
+        // Writing to the pipe must never block, the thread will wake up anyway when the pipe is full
+        for (unsigned int i = 0; i < 2; ++i)
+        {
+            wakeUpPipe[i] = pipeDescriptors[i];
+            fcntl(wakeUpPipe[i], F_SETFL, fcntl(wakeUpPipe[i], F_GETFL) | O_NONBLOCK);
+        }
+
+        // The window is never shown, it only exists to own the selection and to receive the contents
+        window = XCreateSimpleWindow(display, DefaultRootWindow(display), 0, 0, 1, 1, 0, 0, 0);
+        XSelectInput(display, window, PropertyChangeMask);
+
+        // The request size is counted in units of four bytes, a quarter of it is left for the rest of the request
+        std::size_t maxRequestSize = XExtendedMaxRequestSize(display);
+        if (maxRequestSize == 0)
+            maxRequestSize = XMaxRequestSize(display);
+
+        maxChunkSize = TGUI_MINIMUM(maxRequestSize, static_cast<std::size_t>(256 * 1024));
+
+        thread = std::thread(&X11Data::run, this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Clipboard::X11Data::~X11Data()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = false;
+        }
+
+        wakeUp();
+        thread.join();
+
+        close(wakeUpPipe[0]);
+        close(wakeUpPipe[1]);
+
+        XDestroyWindow(display, window);
+        XCloseDisplay(display);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipboard::X11Data::wakeUp()
+    {
+        // When the pipe is full then the thread is already going to wake up
+        const char byte = 0;
+        ssize_t written = write(wakeUpPipe[1], &byte, 1);
+        (void)written;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Clipboard::X11Data::requestTransfer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            // When the contents come from this application then they don't have to be requested
+            if (ownsSelection || ownershipRequested)
+                return false;
+
+            // When a previous request is still busy then the contents that it receives will be used
+            if (!transferActive)
+            {
+                transferRequested = true;
+                transferActivityTime = std::chrono::steady_clock::now();
+            }
+        }
+
+        wakeUp();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipboard::X11Data::run()
+    {
+        const int connectionNumber = ConnectionNumber(display);
+        const int highestDescriptor = TGUI_MAXIMUM(connectionNumber, wakeUpPipe[0]);
+
+        while (true)
+        {
+            // Handle the requests from the Clipboard functions
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!running)
+                    break;
+
+                if (ownershipRequested)
+                {
+                    ownershipRequested = false;
+                    utf8Contents.reset();
+
+                    XSetSelectionOwner(display, clipboard, window, CurrentTime);
+                    ownsSelection = (XGetSelectionOwner(display, clipboard) == window);
+                }
+
+                // Forget about the parts that were still expected when the Clipboard gave up on the transfer
+                if (!transferActive)
+                    receivingIncr = false;
+
+                if (transferRequested && !transferActive)
+                {
+                    transferRequested = false;
+                    transferActive = true;
+                    receivingIncr = false;
+                    receivedContents.clear();
+                    utf8Remainder.clear();
+
+                    requestedTarget = utf8String;
+                    XConvertSelection(display, clipboard, utf8String, property, window, CurrentTime);
+                }
+            }
+
+            XFlush(display);
+
+            // Handle the events that arrived
+            while (XPending(display))
+            {
+                XEvent event;
+                XNextEvent(display, &event);
+
+                switch (event.type)
+                {
+                    case SelectionClear:
+                    {
+                        // Another application has put something on the clipboard
+                        std::lock_guard<std::mutex> lock(mutex);
+                        ownsSelection = false;
+                        utf8Contents.reset();
+                        break;
+                    }
+
+                    case SelectionRequest:
+                    {
+                        handleSelectionRequest(event.xselectionrequest);
+                        break;
+                    }
+
+                    case SelectionNotify:
+                    {
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            if (!transferActive)
+                                break;
+                        }
+
+                        if (event.xselection.property != None)
+                            readProperty();
+                        else if (requestedTarget == utf8String)
+                        {
+                            // The owner doesn't support UTF-8, so ask for Latin-1 text instead
+                            requestedTarget = XA_STRING;
+                            XConvertSelection(display, clipboard, XA_STRING, property, window, CurrentTime);
+                        }
+                        else
+                            finishIncomingTransfer(false);
+
+                        break;
+                    }
+
+                    case PropertyNotify:
+                    {
+                        if ((event.xproperty.window == window) && (event.xproperty.atom == property))
+                        {
+                            // The next part of the contents has arrived
+                            if (receivingIncr && (event.xproperty.state == PropertyNewValue))
+                                readProperty();
+                        }
+                        else if (event.xproperty.state == PropertyDelete)
+                        {
+                            // The other application has read the previous part that we sent
+                            continueOutgoingTransfer(event.xproperty.window, event.xproperty.atom);
+                        }
+
+                        break;
+                    }
+                }
+            }
+
+            // Sleep until an event arrives or until the Clipboard functions have a new request
+            fd_set descriptors;
+            FD_ZERO(&descriptors);
+            FD_SET(connectionNumber, &descriptors);
+            FD_SET(wakeUpPipe[0], &descriptors);
+
+            if (select(highestDescriptor + 1, &descriptors, nullptr, nullptr, nullptr) <= 0)
+                continue;
+
+            if (FD_ISSET(wakeUpPipe[0], &descriptors))
+            {
+                char buffer[64];
+                while (read(wakeUpPipe[0], buffer, sizeof(buffer)) > 0)
+                    continue;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipboard::X11Data::handleSelectionRequest(const XSelectionRequestEvent& request)
+    {
+        XSelectionEvent reply;
+        reply.type      = SelectionNotify;
+        reply.display   = request.display;
+        reply.requestor = request.requestor;
+        reply.selection = request.selection;
+        reply.target    = request.target;
+        reply.time      = request.time;
+
+        // Old clients don't pass a property, the target is then used instead
+        reply.property = (request.property != None) ? request.property : request.target;
+
+        // The requestor may disappear at any time
+        ErrorTrap errorTrap(*this);
+
+        if (request.target == targets)
+        {
+            Atom supportedTargets[] = { targets, utf8String, text, XA_STRING };
+            XChangeProperty(display, request.requestor, reply.property, XA_ATOM, 32, PropModeReplace,
+                            reinterpret_cast<unsigned char*>(supportedTargets), sizeof(supportedTargets) / sizeof(Atom));
+        }
+        else if ((request.target == utf8String) || (request.target == text) || (request.target == XA_STRING))
+        {
+            std::shared_ptr<const std::string> data;
+            Atom type;
+            if (request.target == XA_STRING)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                auto latin1 = std::make_shared<std::string>();
+                latin1->reserve(contents.getSize());
+                sf::Utf32::toLatin1(contents.begin(), contents.end(), std::back_inserter(*latin1), '?');
+
+                data = latin1;
+                type = XA_STRING;
+            }
+            else
+            {
+                data = getUtf8Contents();
+                type = utf8String;
+            }
+
+            if (data->size() > maxChunkSize)
+            {
+                // Big contents are sent in parts, the other application deletes the property each time it has read a part
+                long size = static_cast<long>(data->size());
+                XSelectInput(display, request.requestor, PropertyChangeMask);
+                XChangeProperty(display, request.requestor, reply.property, incr, 32, PropModeReplace,
+                                reinterpret_cast<unsigned char*>(&size), 1);
+
+                // Don't wait for the requestor to read the parts when it is already gone
+                if (!errorTrap.failed())
+                {
+                    OutgoingTransfer transfer;
+                    transfer.requestor = request.requestor;
+                    transfer.property  = reply.property;
+                    transfer.type      = type;
+                    transfer.data      = data;
+                    transfer.offset    = 0;
+                    outgoingTransfers.push_back(transfer);
+                }
+            }
+            else
+            {
+                XChangeProperty(display, request.requestor, reply.property, type, 8, PropModeReplace,
+                                reinterpret_cast<const unsigned char*>(data->data()), static_cast<int>(data->size()));
+            }
+        }
+        else // The requested format isn't supported
+            reply.property = None;
+
+        XSendEvent(display, request.requestor, False, NoEventMask, reinterpret_cast<XEvent*>(&reply));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipboard::X11Data::continueOutgoingTransfer(Window requestor, Atom transferProperty)
+    {
+        for (auto it = outgoingTransfers.begin(); it != outgoingTransfers.end(); ++it)
+        {
+            if ((it->requestor != requestor) || (it->property != transferProperty))
+                continue;
+
+            // The requestor may disappear at any time
+            ErrorTrap errorTrap(*this);
+
+            // Send the next part straight from the shared buffer. An empty part tells that the transfer is complete.
+            std::size_t size = TGUI_MINIMUM(maxChunkSize, it->data->size() - it->offset);
+            XChangeProperty(display, requestor, transferProperty, it->type, 8, PropModeReplace,
+                            reinterpret_cast<const unsigned char*>(it->data->data() + it->offset), static_cast<int>(size));
+
+            // The transfer also ends when the requestor is gone
+            if ((size == 0) || errorTrap.failed())
+            {
+                XSelectInput(display, requestor, NoEventMask);
+                outgoingTransfers.erase(it);
+            }
+            else
+                it->offset += size;
+
+            return;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipboard::X11Data::readProperty()
+    {
+        Atom type;
+        int format;
+        unsigned long items;
+        unsigned long bytesAfter;
+        unsigned char* data = nullptr;
+
+        // Deleting the property tells the owner that the next part can be sent
+        if (XGetWindowProperty(display, window, property, 0, LONG_MAX / 4, True, AnyPropertyType,
+                               &type, &format, &items, &bytesAfter, &data) != Success)
+        {
+            finishIncomingTransfer(false);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            transferActivityTime = std::chrono::steady_clock::now();
+        }
+
+        if (type == incr)
+        {
+            // The contents will arrive in parts
+            receivingIncr = true;
+        }
+        else if ((format == 8) && (items > 0))
+        {
+            const char* begin = reinterpret_cast<const char*>(data);
+            if (requestedTarget == utf8String)
+                appendUtf8(begin, begin + items);
+            else
+            {
+                decodedText.clear();
+                sf::Utf8::fromLatin1(begin, begin + items, std::back_inserter(decodedText));
+                receivedContents += sf::String(decodedText);
+            }
+
+            // Without INCR all contents arrive at once
+            if (!receivingIncr)
+                finishIncomingTransfer(true);
+        }
+        else // An empty part marks the end of the contents
+            finishIncomingTransfer(true);
+
+        if (data != nullptr)
+            XFree(data);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipboard::X11Data::appendUtf8(const char* begin, const char* end)
+    {
+        // Complete the character that was split at the end of the previous part
+        while (!utf8Remainder.empty() && (begin != end))
+        {
+            utf8Remainder += *begin++;
+
+            unsigned char lead = static_cast<unsigned char>(utf8Remainder[0]);
+            std::size_t length = (lead < 0xE0) ? 2 : ((lead < 0xF0) ? 3 : 4);
+            if (utf8Remainder.size() == length)
+            {
+                decodedText.clear();
+                sf::Utf8::toUtf32(utf8Remainder.begin(), utf8Remainder.end(), std::back_inserter(decodedText));
+                receivedContents += sf::String(decodedText);
+                utf8Remainder.clear();
+            }
+        }
+
+        // Keep the last character for later when it isn't complete yet
+        const char* last = end;
+        while ((last != begin) && (end - last < 3) && ((static_cast<unsigned char>(*(last - 1)) & 0xC0) == 0x80))
+            --last;
+
+        if (last != begin)
+        {
+            --last;
+
+            unsigned char lead = static_cast<unsigned char>(*last);
+            std::ptrdiff_t length = (lead < 0xC0) ? 1 : ((lead < 0xE0) ? 2 : ((lead < 0xF0) ? 3 : 4));
+            if (end - last < length)
+            {
+                utf8Remainder.assign(last, end);
+                end = last;
+            }
+        }
+
+        // Decode the part directly, the buffer is reused for every part
+        decodedText.clear();
+        sf::Utf8::toUtf32(begin, end, std::back_inserter(decodedText));
+        receivedContents += sf::String(decodedText);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipboard::X11Data::finishIncomingTransfer(bool success)
+    {
+        receivingIncr = false;
+        utf8Remainder.clear();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (transferActive)
+        {
+            transferActive = false;
+            transferFinished = true;
+            transferSucceeded = success;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<const std::string> Clipboard::X11Data::getUtf8Contents()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (!utf8Contents)
+        {
+            auto utf8 = std::make_shared<std::string>();
+            utf8->reserve(contents.getSize());
+            sf::Utf32::toUtf8(contents.begin(), contents.end(), std::back_inserter(*utf8));
+            utf8Contents = utf8;
+        }
+
+        return utf8Contents;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int Clipboard::X11Data::handleError(Display* connection, XErrorEvent* error)
+    {
+        // The handler is called on the thread of the connection on which the error occurred, which is the thread of the
+        // clipboard when the error belongs to the trap. The members of the trap can then be accessed without locking.
+        if ((trappingClipboard != nullptr) && (connection == trappingClipboard->display)
+         && (error->serial >= trappingClipboard->errorTrapSerial))
+        {
+            trappingClipboard->errorTrapped = true;
+            return 0;
+        }
+
+        if (previousErrorHandler != nullptr)
+            return previousErrorHandler(connection, error);
+        else
+            return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#endif
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Clipboard::Clipboard() :
         m_windowHandle     (),
         m_isWindowHandleSet(false)
+    #if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD)
+        ,
+        m_x11              (nullptr),
+        m_x11Unavailable   (false)
+    #endif
     {
     }
 
@@ -47,6 +746,9 @@ namespace tgui
 
     Clipboard::~Clipboard()
     {
+    #if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD)
+        delete m_x11;
+    #endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -73,6 +775,10 @@ namespace tgui
                 CloseClipboard();
             }
         }
+    #elif defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD)
+        // Don't wait for the contents of another application, they are taken over by the update function when they arrive
+        if (connectToX11())
+            m_x11->requestTransfer();
     #endif
 
         return m_contents;
@@ -80,8 +786,113 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Clipboard::requestContents(const std::function<void(const sf::String&)>& function)
+    {
+    #if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD)
+        if (connectToX11() && m_x11->requestTransfer())
+        {
+            m_pendingRequests.push_back(function);
+            return;
+        }
+    #endif
+
+        function(get());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipboard::update()
+    {
+    #if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD)
+        if (m_x11 == nullptr)
+            return;
+
+        bool transferEnded = false;
+        bool transferAbandoned = false;
+        {
+            std::lock_guard<std::mutex> lock(m_x11->mutex);
+
+            if (m_x11->transferFinished)
+            {
+                // Take over the received text without copying it
+                if (m_x11->transferSucceeded)
+                    std::swap(m_contents, m_x11->receivedContents);
+
+                m_x11->receivedContents.clear();
+                m_x11->transferFinished = false;
+                transferEnded = true;
+            }
+            else if (m_x11->transferActive && (std::chrono::steady_clock::now() - m_x11->transferActivityTime > std::chrono::seconds(1)))
+            {
+                // The other application stopped responding, so the last known contents are used instead
+                m_x11->transferActive = false;
+                transferEnded = true;
+                transferAbandoned = true;
+            }
+        }
+
+        if (!transferEnded)
+            return;
+
+        // Let the thread forget about the parts that it was still expecting
+        if (transferAbandoned)
+            m_x11->wakeUp();
+
+        // The functions are taken out of the list first, because they are allowed to request the contents again
+        std::vector< std::function<void(const sf::String&)> > requests;
+        requests.swap(m_pendingRequests);
+
+        for (auto it = requests.cbegin(); it != requests.cend(); ++it)
+            (*it)(m_contents);
+    #endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Clipboard::getTimeUntilUpdate(sf::Time& time) const
+    {
+    #if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD)
+        if ((m_x11 == nullptr) || m_pendingRequests.empty())
+            return false;
+
+        std::lock_guard<std::mutex> lock(m_x11->mutex);
+
+        if (m_x11->transferFinished)
+        {
+            time = sf::Time();
+            return true;
+        }
+
+        // Check regularly whether the contents arrived, until the update function gives up on the transfer
+        const auto timeSinceActivity = std::chrono::steady_clock::now() - m_x11->transferActivityTime;
+        sf::Int64 microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::seconds(1) - timeSinceActivity).count();
+        microseconds = TGUI_MINIMUM(microseconds, 10000);
+
+        time = sf::microseconds(TGUI_MAXIMUM(microseconds, 0));
+        return true;
+    #else
+        (void)time;
+        return false;
+    #endif
+    }
+
     void Clipboard::set(const sf::String& contents)
     {
+    #if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD)
+        if (connectToX11())
+        {
+            // The thread will claim the selection, the contents are only converted when another application asks for them
+            {
+                std::lock_guard<std::mutex> lock(m_x11->mutex);
+                m_contents = contents;
+                m_x11->ownershipRequested = true;
+            }
+
+            m_x11->wakeUp();
+            return;
+        }
+    #endif
+
         m_contents = contents;
 
     #ifdef SFML_SYSTEM_WINDOWS
@@ -120,6 +931,41 @@ namespace tgui
         m_isWindowHandleSet = true;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD)
+    bool Clipboard::connectToX11()
+    {
+        if (m_x11 != nullptr)
+            return true;
+
+        // Don't keep trying when there is no X server
+        if (m_x11Unavailable)
+            return false;
+
+        Display* display = XOpenDisplay(nullptr);
+        if (display == nullptr)
+        {
+            TGUI_OUTPUT("TGUI warning: Failed to connect to the X server, the clipboard will only work inside the application.");
+            m_x11Unavailable = true;
+            return false;
+        }
+
+        // The thread sleeps until there is an event on the connection or until the Clipboard functions write to this pipe
+        int wakeUpPipe[2];
+        if (pipe(wakeUpPipe) != 0)
+        {
+            TGUI_OUTPUT("TGUI warning: Failed to create a pipe for the clipboard, it will only work inside the application.");
+            XCloseDisplay(display);
+            m_x11Unavailable = true;
+            return false;
+        }
+
+        m_x11 = new X11Data(display, wakeUpPipe, m_contents);
+        return true;
+    }
+#endif
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
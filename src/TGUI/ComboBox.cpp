@@ -78,6 +78,32 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ComboBox::ComboBox(ComboBox&& other) :
+    Widget              (std::move(other)),
+    WidgetBorders       (other),
+    m_LoadedConfigFile  (std::move(other.m_LoadedConfigFile)),
+    m_SeparateHoverImage(other.m_SeparateHoverImage),
+    m_NrOfItemsToDisplay(other.m_NrOfItemsToDisplay),
+    m_ListBox           (std::move(other.m_ListBox))
+    {
+        // The list box has to send its callbacks to this combo box now
+        m_ListBox->unbindAllCallback();
+        m_ListBox->bindCallback(&ComboBox::newItemSelectedCallbackFunction, this, ListBox::ItemSelected);
+        m_ListBox->bindCallback(&ComboBox::listBoxUnfocusedCallbackFunction, this, ListBox::Unfocused);
+
+        // Leave an empty list box behind, so that the functions of the other combo box can still be called
+        other.m_ListBox = ListBox::Ptr();
+        other.m_ListBox->hide();
+
+        // Take over the textures, the other widget will no longer release them
+        std::swap(m_TextureArrowUpNormal, other.m_TextureArrowUpNormal);
+        std::swap(m_TextureArrowUpHover, other.m_TextureArrowUpHover);
+        std::swap(m_TextureArrowDownNormal, other.m_TextureArrowDownNormal);
+        std::swap(m_TextureArrowDownHover, other.m_TextureArrowDownHover);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ComboBox::~ComboBox()
     {
         if (m_TextureArrowUpNormal.data != nullptr)    TGUI_TextureManager.removeTexture(m_TextureArrowUpNormal);
@@ -111,6 +137,40 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ComboBox& ComboBox::operator= (ComboBox&& right)
+    {
+        if (this != &right)
+        {
+            this->Widget::operator=(std::move(right));
+            this->WidgetBorders::operator=(right);
+
+            std::swap(m_LoadedConfigFile,       right.m_LoadedConfigFile);
+            std::swap(m_SeparateHoverImage,     right.m_SeparateHoverImage);
+            std::swap(m_NrOfItemsToDisplay,     right.m_NrOfItemsToDisplay);
+            std::swap(m_ListBox,                right.m_ListBox);
+            std::swap(m_TextureArrowUpNormal,   right.m_TextureArrowUpNormal);
+            std::swap(m_TextureArrowUpHover,    right.m_TextureArrowUpHover);
+            std::swap(m_TextureArrowDownNormal, right.m_TextureArrowDownNormal);
+            std::swap(m_TextureArrowDownHover,  right.m_TextureArrowDownHover);
+
+            // The list boxes were exchanged, so they have to send their callbacks to their new combo box
+            m_ListBox->unbindAllCallback();
+            m_ListBox->bindCallback(&ComboBox::newItemSelectedCallbackFunction, this, ListBox::ItemSelected);
+            m_ListBox->bindCallback(&ComboBox::listBoxUnfocusedCallbackFunction, this, ListBox::Unfocused);
+
+            if (right.m_ListBox != nullptr)
+            {
+                right.m_ListBox->unbindAllCallback();
+                right.m_ListBox->bindCallback(&ComboBox::newItemSelectedCallbackFunction, &right, ListBox::ItemSelected);
+                right.m_ListBox->bindCallback(&ComboBox::listBoxUnfocusedCallbackFunction, &right, ListBox::Unfocused);
+            }
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ComboBox* ComboBox::clone()
     {
         return new ComboBox(*this);
@@ -270,6 +330,8 @@ namespace tgui
 
     void ComboBox::setSize(float width, float height)
     {
+        invalidate();
+
         // Don't set the scale when loading failed
         if (m_Loaded == false)
             return;
@@ -283,9 +345,9 @@ namespace tgui
 
         // Set the size of the list box
         if (m_NrOfItemsToDisplay > 0)
-            m_ListBox->setSize(width, static_cast<float>(m_ListBox->getItemHeight() * (TGUI_MINIMUM(m_NrOfItemsToDisplay, TGUI_MAXIMUM(m_ListBox->getItems().size(), 1)))));
+            m_ListBox->setSize(width, static_cast<float>(m_ListBox->getItemHeight() * (TGUI_MINIMUM(m_NrOfItemsToDisplay, TGUI_MAXIMUM(m_ListBox->getItemCount(), 1)))));
         else
-            m_ListBox->setSize(width, static_cast<float>(m_ListBox->getItemHeight() * TGUI_MAXIMUM(m_ListBox->getItems().size(), 1)));
+            m_ListBox->setSize(width, static_cast<float>(m_ListBox->getItemHeight() * TGUI_MAXIMUM(m_ListBox->getItemCount(), 1)));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -310,9 +372,11 @@ namespace tgui
 
     void ComboBox::setItemsToDisplay(unsigned int nrOfItemsInList)
     {
+        invalidate();
+
         m_NrOfItemsToDisplay = nrOfItemsInList;
 
-        if (m_NrOfItemsToDisplay < m_ListBox->m_Items.size())
+        if (m_NrOfItemsToDisplay < m_ListBox->getItemCount())
             m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_NrOfItemsToDisplay * m_ListBox->getItemHeight()));
     }
 
@@ -336,6 +400,8 @@ namespace tgui
 
     void ComboBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_ListBox->setBackgroundColor(backgroundColor);
     }
 
@@ -343,6 +409,8 @@ namespace tgui
 
     void ComboBox::setTextColor(const sf::Color& textColor)
     {
+        invalidate();
+
         m_ListBox->setTextColor(textColor);
     }
 
@@ -350,6 +418,8 @@ namespace tgui
 
     void ComboBox::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
     {
+        invalidate();
+
         m_ListBox->setSelectedBackgroundColor(selectedBackgroundColor);
     }
 
@@ -357,6 +427,8 @@ namespace tgui
 
     void ComboBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
+        invalidate();
+
         m_ListBox->setSelectedTextColor(selectedTextColor);
     }
 
@@ -364,6 +436,8 @@ namespace tgui
 
     void ComboBox::setBorderColor(const sf::Color& borderColor)
     {
+        invalidate();
+
         m_ListBox->setBorderColor(borderColor);
     }
 
@@ -406,6 +480,8 @@ namespace tgui
 
     void ComboBox::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_ListBox->setTextFont(font);
     }
 
@@ -420,6 +496,8 @@ namespace tgui
 
     void ComboBox::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        invalidate();
+
         // Set the new border size
         m_LeftBorder   = leftBorder;
         m_TopBorder    = topBorder;
@@ -440,13 +518,15 @@ namespace tgui
 
     int ComboBox::addItem(const sf::String& item, int id)
     {
-        // An item can only be added when the combo box was loaded correctly
-        if (m_Loaded == false)
-            return false;
+        invalidate();
+
+        // An item can only be added when the combo box was loaded correctly and doesn't get its items from a model
+        if ((m_Loaded == false) || (m_ListBox->getModel() != nullptr))
+            return -1;
 
         // Make room to add another item, until there are enough items
-        if ((m_NrOfItemsToDisplay == 0) || (m_NrOfItemsToDisplay > m_ListBox->getItems().size()))
-            m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_ListBox->getItemHeight() * (m_ListBox->getItems().size() + 1)));
+        if ((m_NrOfItemsToDisplay == 0) || (m_NrOfItemsToDisplay > m_ListBox->getItemCount()))
+            m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_ListBox->getItemHeight() * (m_ListBox->getItemCount() + 1)));
 
         // Add the item
         return m_ListBox->addItem(item, id);
@@ -454,8 +534,45 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    unsigned int ComboBox::setItems(std::vector<sf::String> itemNames, std::vector<int> ids)
+    {
+        removeAllItems();
+
+        return addItems(std::move(itemNames), std::move(ids));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ComboBox::addItems(std::vector<sf::String> itemNames, std::vector<int> ids)
+    {
+        invalidate();
+
+        // Items can only be added when the combo box was loaded correctly and doesn't get its items from a model
+        if ((m_Loaded == false) || (m_ListBox->getModel() != nullptr))
+            return 0;
+
+        // Make room for all new items at once, the list box refuses items that don't fit when there is no scrollbar
+        unsigned int nrOfItems = m_ListBox->getItemCount() + itemNames.size();
+        if ((m_NrOfItemsToDisplay > 0) && (nrOfItems > m_NrOfItemsToDisplay))
+            nrOfItems = m_NrOfItemsToDisplay;
+
+        m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_ListBox->getItemHeight() * TGUI_MAXIMUM(nrOfItems, 1)));
+
+        unsigned int ret = m_ListBox->addItems(std::move(itemNames), std::move(ids));
+
+        // Shrink the list size again when not all items could be added
+        if ((m_NrOfItemsToDisplay == 0) || (m_ListBox->getItemCount() < m_NrOfItemsToDisplay))
+            m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_ListBox->getItemHeight() * TGUI_MAXIMUM(m_ListBox->getItemCount(), 1)));
+
+        return ret;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ComboBox::setSelectedItem(const sf::String& itemName)
     {
+        invalidate();
+
         return m_ListBox->setSelectedItem(itemName);
     }
 
@@ -463,13 +580,26 @@ namespace tgui
 
     bool ComboBox::setSelectedItem(int index)
     {
+        invalidate();
+
         return m_ListBox->setSelectedItem(index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ComboBox::setSelectedItemById(int id)
+    {
+        invalidate();
+
+        return m_ListBox->setSelectedItemById(id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ComboBox::deselectItem()
     {
+        invalidate();
+
         m_ListBox->deselectItem();
     }
 
@@ -477,11 +607,13 @@ namespace tgui
 
     bool ComboBox::removeItem(unsigned int index)
     {
+        invalidate();
+
         bool ret = m_ListBox->removeItem(index);
 
         // Shrink the list size
-        if ((m_NrOfItemsToDisplay == 0) || (m_ListBox->getItems().size() < m_NrOfItemsToDisplay))
-            m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_ListBox->getItemHeight() * TGUI_MAXIMUM(m_ListBox->getItems().size(), 1)));
+        if ((m_NrOfItemsToDisplay == 0) || (m_ListBox->getItemCount() < m_NrOfItemsToDisplay))
+            m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_ListBox->getItemHeight() * TGUI_MAXIMUM(m_ListBox->getItemCount(), 1)));
 
         return ret;
     }
@@ -490,11 +622,13 @@ namespace tgui
 
     bool ComboBox::removeItem(const sf::String& itemName)
     {
+        invalidate();
+
         bool ret = m_ListBox->removeItem(itemName);
 
         // Shrink the list size
-        if ((m_NrOfItemsToDisplay == 0) || (m_ListBox->getItems().size() < m_NrOfItemsToDisplay))
-            m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_ListBox->getItemHeight() * TGUI_MAXIMUM(m_ListBox->getItems().size(), 1)));
+        if ((m_NrOfItemsToDisplay == 0) || (m_ListBox->getItemCount() < m_NrOfItemsToDisplay))
+            m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_ListBox->getItemHeight() * TGUI_MAXIMUM(m_ListBox->getItemCount(), 1)));
 
         return ret;
     }
@@ -503,11 +637,13 @@ namespace tgui
 
     unsigned int ComboBox::removeItemsById(int id)
     {
+        invalidate();
+
         unsigned int ret = m_ListBox->removeItemsById(id);
 
         // Shrink the list size
-        if ((m_NrOfItemsToDisplay == 0) || (m_ListBox->getItems().size() < m_NrOfItemsToDisplay))
-            m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_ListBox->getItemHeight() * TGUI_MAXIMUM(m_ListBox->getItems().size(), 1)));
+        if ((m_NrOfItemsToDisplay == 0) || (m_ListBox->getItemCount() < m_NrOfItemsToDisplay))
+            m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_ListBox->getItemHeight() * TGUI_MAXIMUM(m_ListBox->getItemCount(), 1)));
 
         return ret;
     }
@@ -516,6 +652,8 @@ namespace tgui
 
     void ComboBox::removeAllItems()
     {
+        invalidate();
+
         m_ListBox->removeAllItems();
         m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_ListBox->getItemHeight()));
     }
@@ -543,6 +681,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    unsigned int ComboBox::getItemCount() const
+    {
+        return m_ListBox->getItemCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     sf::String ComboBox::getSelectedItem() const
     {
         return m_ListBox->getSelectedItem();
@@ -566,6 +711,8 @@ namespace tgui
 
     bool ComboBox::changeItem(unsigned int index, const sf::String& newValue)
     {
+        invalidate();
+
         return m_ListBox->changeItem(index, newValue);
     }
 
@@ -587,6 +734,8 @@ namespace tgui
 
     bool ComboBox::setScrollbar(const std::string& scrollbarConfigFileFilename)
     {
+        invalidate();
+
         return m_ListBox->setScrollbar(scrollbarConfigFileFilename);
     }
 
@@ -594,6 +743,8 @@ namespace tgui
 
     void ComboBox::removeScrollbar()
     {
+        invalidate();
+
         m_ListBox->removeScrollbar();
     }
 
@@ -601,6 +752,8 @@ namespace tgui
 
     void ComboBox::setMaximumItems(unsigned int maximumItems)
     {
+        invalidate();
+
         m_ListBox->setMaximumItems(maximumItems);
     }
 
@@ -613,8 +766,57 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ComboBox::setSorted(bool sorted)
+    {
+        invalidate();
+
+        m_ListBox->setSorted(sorted);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ComboBox::isSorted() const
+    {
+        return m_ListBox->isSorted();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ComboBox::setModel(ListBoxModel* model)
+    {
+        m_ListBox->setModel(model);
+
+        // Resize the list to the new amount of items
+        modelChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListBoxModel* ComboBox::getModel() const
+    {
+        return m_ListBox->getModel();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ComboBox::modelChanged()
+    {
+        invalidate();
+
+        m_ListBox->modelChanged();
+
+        if ((m_NrOfItemsToDisplay == 0) || (m_ListBox->getItemCount() < m_NrOfItemsToDisplay))
+            m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_ListBox->getItemHeight() * TGUI_MAXIMUM(m_ListBox->getItemCount(), 1)));
+        else
+            m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_ListBox->getItemHeight() * m_NrOfItemsToDisplay));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ComboBox::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         m_ListBox->setTransparency(m_Opacity);
@@ -698,7 +900,7 @@ namespace tgui
             if (delta < 0)
             {
                 // select the next item
-                if (static_cast<unsigned int>(m_ListBox->getSelectedItemIndex() + 1) < m_ListBox->m_Items.size())
+                if (static_cast<unsigned int>(m_ListBox->getSelectedItemIndex() + 1) < m_ListBox->getItemCount())
                     m_ListBox->setSelectedItem(static_cast<unsigned int>(m_ListBox->getSelectedItemIndex()+1));
             }
             else // You are scrolling up
@@ -765,13 +967,10 @@ namespace tgui
         }
         else if (property == "items")
         {
-            removeAllItems();
-
             std::vector<sf::String> items;
             decodeList(value, items);
 
-            for (auto it = items.cbegin(); it != items.cend(); ++it)
-                addItem(*it);
+            setItems(std::move(items));
         }
         else if (property == "selecteditem")
         {
@@ -824,7 +1023,7 @@ namespace tgui
         else if (property == "maximumitems")
             value = to_string(getMaximumItems());
         else if (property == "items")
-            encodeList(m_ListBox->getItems(), value);
+            m_ListBox->getProperty(property, value);
         else if (property == "selecteditem")
             value = to_string(getSelectedItemIndex());
         else if (property == "callback")
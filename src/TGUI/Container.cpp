@@ -26,6 +26,8 @@
 #include <stack>
 #include <cmath>
 #include <cassert>
+#include <limits>
+#include <algorithm>
 
 #include <TGUI/TGUI.hpp>
 
@@ -36,10 +38,15 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container() :
-        m_FocusedWidget(nullptr)
+        m_FocusedWidget         (nullptr),
+        m_HoveredWidget         (nullptr),
+        m_UpdatingAnimations    (false),
+        m_WidgetFlagsNeedUpdate (true),
+        m_CacheWidgetBounds     (false),
+        m_WidgetBoundsNeedUpdate(true),
+        m_WidgetArena           (nullptr)
     {
         m_ContainerWidget = true;
-        m_AnimatedWidget = true;
         m_AllowFocus = true;
     }
 
@@ -48,8 +55,14 @@ namespace tgui
     Container::Container(const Container& containerToCopy) :
         Widget                   (containerToCopy),
         m_FocusedWidget          (nullptr),
+        m_HoveredWidget          (nullptr),
         m_GlobalFont             (containerToCopy.m_GlobalFont),
-        m_GlobalCallbackFunctions(containerToCopy.m_GlobalCallbackFunctions)
+        m_GlobalCallbackFunctions(containerToCopy.m_GlobalCallbackFunctions),
+        m_UpdatingAnimations     (false),
+        m_WidgetFlagsNeedUpdate  (true),
+        m_CacheWidgetBounds      (containerToCopy.m_CacheWidgetBounds),
+        m_WidgetBoundsNeedUpdate (true),
+        m_WidgetArena            (nullptr)
     {
         // Copy all the widgets
         for (unsigned int i = 0; i < containerToCopy.m_Widgets.size(); ++i)
@@ -58,14 +71,56 @@ namespace tgui
             m_ObjName.push_back(containerToCopy.m_ObjName[i]);
 
             m_Widgets.back()->m_Parent = this;
+            if (m_Widgets.back()->m_AnimatedWidget)
+                addAnimatedWidget(m_Widgets.back().get());
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Container::Container(Container&& containerToMove) :
+        Widget                   (std::move(containerToMove)),
+        m_Widgets                (std::move(containerToMove.m_Widgets)),
+        m_ObjName                (std::move(containerToMove.m_ObjName)),
+        m_FocusedWidget          (containerToMove.m_FocusedWidget),
+        m_PressedWidgets         (std::move(containerToMove.m_PressedWidgets)),
+        m_HoveredWidget          (containerToMove.m_HoveredWidget),
+        m_GlobalFont             (containerToMove.m_GlobalFont),
+        m_GlobalCallbackFunctions(std::move(containerToMove.m_GlobalCallbackFunctions)),
+        m_AnimatedWidgets        (std::move(containerToMove.m_AnimatedWidgets)),
+        m_UpdatingAnimations     (false),
+        m_WidgetFlagsNeedUpdate  (true),
+        m_CacheWidgetBounds      (containerToMove.m_CacheWidgetBounds),
+        m_WidgetBoundsNeedUpdate (true),
+        m_WidgetArena            (nullptr)
+    {
+        containerToMove.m_FocusedWidget = nullptr;
+        containerToMove.m_HoveredWidget = nullptr;
+
+        // The tweens are swapped so that the other tweener doesn't keep its count of active tweens
+        std::swap(m_Tweener, containerToMove.m_Tweener);
+
+        // The widgets now belong to this container. They stay in the arena of the other container, which is kept alive
+        // for as long as these widgets exist.
+        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+            m_Widgets[i]->m_Parent = this;
+
+        if (!m_AnimatedWidgets.empty())
+            startAnimation();
+
+        // The other container has nothing left to animate
+        containerToMove.stopAnimation();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Container::~Container()
     {
         removeAllWidgets();
+
+        // Widgets that are still used elsewhere keep the arena alive until they are destroyed
+        if (m_WidgetArena != nullptr)
+            m_WidgetArena->release();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -81,6 +136,7 @@ namespace tgui
             m_FocusedWidget = nullptr;
             m_GlobalFont = right.m_GlobalFont;
             m_GlobalCallbackFunctions = right.m_GlobalCallbackFunctions;
+            m_CacheWidgetBounds = right.m_CacheWidgetBounds;
 
             // Remove all the old widgets
             removeAllWidgets();
@@ -92,6 +148,8 @@ namespace tgui
                 m_ObjName.push_back(right.m_ObjName[i]);
 
                 m_Widgets.back()->m_Parent = this;
+                if (m_Widgets.back()->m_AnimatedWidget)
+                    addAnimatedWidget(m_Widgets.back().get());
             }
         }
 
@@ -100,6 +158,48 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Container& Container::operator= (Container&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            Widget::operator=(std::move(right));
+
+            // Copy the font and take over the callback functions
+            m_FocusedWidget = nullptr;
+            m_GlobalFont = right.m_GlobalFont;
+            m_GlobalCallbackFunctions = std::move(right.m_GlobalCallbackFunctions);
+            m_CacheWidgetBounds = right.m_CacheWidgetBounds;
+
+            // Remove all the old widgets
+            removeAllWidgets();
+
+            // Take over the widgets, the other container is left empty
+            std::swap(m_Widgets,         right.m_Widgets);
+            std::swap(m_ObjName,         right.m_ObjName);
+            std::swap(m_FocusedWidget,   right.m_FocusedWidget);
+            std::swap(m_PressedWidgets,  right.m_PressedWidgets);
+            std::swap(m_HoveredWidget,   right.m_HoveredWidget);
+            std::swap(m_AnimatedWidgets, right.m_AnimatedWidgets);
+            std::swap(m_Tweener,         right.m_Tweener);
+
+            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+                m_Widgets[i]->m_Parent = this;
+
+            if (!m_AnimatedWidgets.empty())
+                startAnimation();
+
+            // The other container has nothing left to animate
+            right.stopAnimation();
+            right.m_WidgetFlagsNeedUpdate = true;
+            right.m_WidgetBoundsNeedUpdate = true;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::setGlobalFont(const std::string& filename)
     {
         return m_GlobalFont.loadFromFile(getResourcePath() + filename);
@@ -142,6 +242,14 @@ namespace tgui
         widgetPtr->initialize(this);
         m_Widgets.push_back(widgetPtr);
         m_ObjName.push_back(widgetName);
+
+        // The widget may already have been animating before it was added
+        if (widgetPtr->m_AnimatedWidget)
+            addAnimatedWidget(widgetPtr.get());
+
+        m_WidgetFlagsNeedUpdate = true;
+        m_WidgetBoundsNeedUpdate = true;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -172,6 +280,13 @@ namespace tgui
         Widget::Ptr newWidget = oldWidget.clone();
         m_Widgets.push_back(newWidget);
         m_ObjName.push_back(newWidgetName);
+
+        if (newWidget->m_AnimatedWidget)
+            addAnimatedWidget(newWidget.get());
+
+        m_WidgetFlagsNeedUpdate = true;
+        m_WidgetBoundsNeedUpdate = true;
+        invalidate();
         return newWidget;
     }
 
@@ -196,12 +311,35 @@ namespace tgui
                 if (m_FocusedWidget == widget)
                     unfocusWidgets();
 
+                // The widget no longer receives the elapsed time from this container
+                if (widget->m_AnimatedWidget)
+                    removeAnimatedWidget(widget);
+
+                removeTweens(widget);
+
+                if (m_HoveredWidget == widget)
+                    m_HoveredWidget = nullptr;
+
+                // The widget no longer has to be told when the mouse is released
+                for (unsigned int j = 0; j < m_PressedWidgets.size(); ++j)
+                {
+                    if (m_PressedWidgets[j].get() == widget)
+                    {
+                        m_PressedWidgets.erase(m_PressedWidgets.begin() + j);
+                        break;
+                    }
+                }
+
                 // Remove the widget
                 m_Widgets.erase(m_Widgets.begin() + i);
 
                 // Also emove the name it from the list
                 m_ObjName.erase(m_ObjName.begin() + i);
 
+                m_WidgetFlagsNeedUpdate = true;
+                m_WidgetBoundsNeedUpdate = true;
+                invalidate();
+
                 break;
             }
         }
@@ -212,11 +350,29 @@ namespace tgui
     void Container::removeAllWidgets()
     {
         // Clear the lists
+        m_PressedWidgets.clear();
         m_Widgets.clear();
         m_ObjName.clear();
 
-        // There are no more widgets, so none of the widgets can be focused
+        // None of the widgets can still be animating. The list is emptied before the widgets are destroyed,
+        // because containers inside this one will try to remove themselves from it when they get destroyed.
+        std::vector<Widget::Ptr> animatedWidgets;
+        animatedWidgets.swap(m_AnimatedWidgets);
+        m_Tweener.removeAll();
+        stopAnimation();
+
+        // There are no more widgets, so none of the widgets can be focused or hovered
         m_FocusedWidget = nullptr;
+        m_HoveredWidget = nullptr;
+
+        // When none of the widgets are used elsewhere then the memory of the arena can be reused from the start
+        animatedWidgets.clear();
+        if (m_WidgetArena != nullptr)
+            m_WidgetArena->recycle();
+
+        m_WidgetFlagsNeedUpdate = true;
+        m_WidgetBoundsNeedUpdate = true;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -463,6 +619,10 @@ namespace tgui
                 m_Widgets.erase(m_Widgets.begin() + i);
                 m_ObjName.erase(m_ObjName.begin() + i);
 
+                m_WidgetFlagsNeedUpdate = true;
+                m_WidgetBoundsNeedUpdate = true;
+                invalidate();
+
                 break;
             }
         }
@@ -488,6 +648,10 @@ namespace tgui
                 m_Widgets.erase(m_Widgets.begin() + i + 1);
                 m_ObjName.erase(m_ObjName.begin() + i + 1);
 
+                m_WidgetFlagsNeedUpdate = true;
+                m_WidgetBoundsNeedUpdate = true;
+                invalidate();
+
                 break;
             }
         }
@@ -495,6 +659,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::cacheWidgetBounds(bool cache)
+    {
+        m_CacheWidgetBounds = cache;
+        m_WidgetBoundsNeedUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidateWidgetBounds()
+    {
+        m_WidgetBoundsNeedUpdate = true;
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::setTransparency(unsigned char transparency)
     {
         Widget::setTransparency(transparency);
@@ -695,6 +875,7 @@ namespace tgui
                 else COMPARE_WIDGET(5, "grid:", Grid)
                 else COMPARE_WIDGET(6, "panel:", Panel)
                 else COMPARE_WIDGET(6, "label:", Label)
+                else COMPARE_WIDGET(6, "table:", Table)
                 else COMPARE_WIDGET(7, "button:", Button)
                 else COMPARE_WIDGET(7, "slider:", Slider)
                 else COMPARE_WIDGET(8, "picture:", Picture)
@@ -771,6 +952,7 @@ namespace tgui
                     case Type_Grid:             m_File << tabs << "Grid: "; break;
                     case Type_Panel:            m_File << tabs << "Panel: "; break;
                     case Type_Label:            m_File << tabs << "Label: "; break;
+                    case Type_Table:            m_File << tabs << "Table: "; break;
                     case Type_Button:           m_File << tabs << "Button: "; break;
                     case Type_Slider:           m_File << tabs << "Slider: "; break;
                     case Type_Picture:          m_File << tabs << "Picture: "; break;
@@ -952,8 +1134,7 @@ namespace tgui
         {
             mouseLeftWidget();
 
-            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
+            setHoveredWidget(nullptr);
 
             m_MouseHover = false;
         }
@@ -965,8 +1146,7 @@ namespace tgui
     {
         Widget::mouseNoLongerDown();
 
-        for (unsigned int i=0; i<m_Widgets.size(); ++i)
-            m_Widgets[i]->mouseNoLongerDown();
+        releasePressedWidgets(nullptr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -988,38 +1168,158 @@ namespace tgui
 
     void Container::update()
     {
-        // Loop through all widgets
-        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+        // Widgets can start or stop animating while being updated. Widgets that stop are only cleared from the list until the
+        // loop is over, and widgets that start are added behind the ones that were animating when this frame started.
+        m_UpdatingAnimations = true;
+        const unsigned int animatedWidgetCount = m_AnimatedWidgets.size();
+        for (unsigned int i = 0; (i < animatedWidgetCount) && (i < m_AnimatedWidgets.size()); ++i)
         {
-            // Check if the widget is a container or a widget that uses the time
-            if (m_Widgets[i]->m_AnimatedWidget)
+            // Skip the widget when it stopped animating in the meantime. The widget is kept alive while it is being updated,
+            // even when it gets removed from the container.
+            const Widget::Ptr widget = m_AnimatedWidgets[i];
+            if (widget == nullptr)
+                continue;
+
+            // Update the elapsed time, but only wake up the widget when it has something to do
+            widget->m_AnimationTimeElapsed += m_AnimationTimeElapsed;
+            if (widget->getTimeUntilNextUpdate() <= sf::Time())
             {
-                // Update the elapsed time
-                m_Widgets[i]->m_AnimationTimeElapsed += m_AnimationTimeElapsed;
-                m_Widgets[i]->update();
+                widget->update();
+                invalidate();
             }
         }
+        m_UpdatingAnimations = false;
+
+        // Remove the widgets that stopped animating during the loop
+        m_AnimatedWidgets.erase(std::remove(m_AnimatedWidgets.begin(), m_AnimatedWidgets.end(), nullptr), m_AnimatedWidgets.end());
+        if (m_AnimatedWidgets.empty() && m_Tweener.isEmpty())
+            stopAnimation();
+
+        // Change the properties of all tweened widgets at once
+        if (!m_Tweener.isEmpty())
+        {
+            m_Tweener.update(m_AnimationTimeElapsed);
+            invalidate();
+
+            if (m_Tweener.isEmpty() && m_AnimatedWidgets.empty())
+                stopAnimation();
+        }
 
         m_AnimationTimeElapsed = sf::Time();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time Container::getTimeUntilNextUpdate() const
+    {
+        // Tweens change every frame
+        if (!m_Tweener.isEmpty())
+            return sf::Time();
+
+        sf::Time timeUntilNextUpdate = sf::microseconds(std::numeric_limits<sf::Int64>::max());
+        for (unsigned int i = 0; i < m_AnimatedWidgets.size(); ++i)
+        {
+            // Skip the widgets that stopped animating while the container is being updated
+            if (m_AnimatedWidgets[i] == nullptr)
+                continue;
+
+            sf::Time time = m_AnimatedWidgets[i]->getTimeUntilNextUpdate();
+            if (time < timeUntilNextUpdate)
+                timeUntilNextUpdate = time;
+        }
+
+        // Part of the time may already have passed without being passed to the widgets
+        return timeUntilNextUpdate - m_AnimationTimeElapsed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addAnimatedWidget(Widget* widget)
+    {
+        // Make sure the widget isn't in the list yet
+        for (unsigned int i = 0; i < m_AnimatedWidgets.size(); ++i)
+        {
+            if (m_AnimatedWidgets[i].get() == widget)
+                return;
+        }
+
+        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+        {
+            if (m_Widgets[i].get() == widget)
+            {
+                m_AnimatedWidgets.push_back(m_Widgets[i]);
+
+                // This container has to receive the elapsed time as well now
+                startAnimation();
+                break;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeAnimatedWidget(Widget* widget)
+    {
+        for (unsigned int i = 0; i < m_AnimatedWidgets.size(); ++i)
+        {
+            if (m_AnimatedWidgets[i].get() == widget)
+            {
+                // While the list is being looped through in update, the widget is only cleared and removed afterwards
+                if (m_UpdatingAnimations)
+                    m_AnimatedWidgets[i] = nullptr;
+                else
+                    m_AnimatedWidgets.erase(m_AnimatedWidgets.begin() + i);
+
+                break;
+            }
+        }
+
+        // There is no need to update this container anymore when none of its widgets are animating
+        if (m_AnimatedWidgets.empty() && m_Tweener.isEmpty())
+            stopAnimation();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addTween(const Tween& tween)
+    {
+        m_Tweener.add(tween);
+
+        // This container has to receive the elapsed time to update the tween
+        startAnimation();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeTweens(const Widget* widget)
+    {
+        m_Tweener.remove(widget);
+
+        if (m_AnimatedWidgets.empty() && m_Tweener.isEmpty())
+            stopAnimation();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::handleEvent(sf::Event& event)
     {
         // Check if a mouse button has moved
         if (event.type == sf::Event::MouseMoved)
         {
-            // Loop through all widgets
-            for (unsigned int i=0; i<m_Widgets.size(); ++i)
+            // Loop through the widgets on which the mouse went down
+            for (unsigned int i=0; i<m_PressedWidgets.size(); ++i)
             {
-                // Check if the mouse went down on the widget
-                if (m_Widgets[i]->m_MouseDown)
+                if (m_PressedWidgets[i]->m_MouseDown)
                 {
                     // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
-                    if ((m_Widgets[i]->m_DraggableWidget) || (m_Widgets[i]->m_ContainerWidget))
+                    if ((m_PressedWidgets[i]->m_DraggableWidget) || (m_PressedWidgets[i]->m_ContainerWidget))
                     {
-                        m_Widgets[i]->mouseMoved(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y));
+                        Widget::Ptr widget = m_PressedWidgets[i];
+                        widget->mouseMoved(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y));
+
+                        if (widget->m_MouseHover)
+                            setHoveredWidget(widget.get());
+
                         return true;
                     }
                 }
@@ -1063,6 +1363,14 @@ namespace tgui
                     }
 
                     widget->leftMousePressed(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y));
+
+                    // Remember that the widget has to be told when the mouse is released
+                    if (isWidgetPressed(*widget)
+                     && (std::find(m_PressedWidgets.begin(), m_PressedWidgets.end(), widget) == m_PressedWidgets.end()))
+                    {
+                        m_PressedWidgets.push_back(widget);
+                    }
+
                     return true;
                 }
                 else // The mouse didn't went down on a widget, so unfocus the focused widget
@@ -1083,12 +1391,8 @@ namespace tgui
                 if (widget != nullptr)
                     widget->leftMouseReleased(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y));
 
-                // Tell all the other widgets that the mouse has gone up
-                for (std::vector<Widget::Ptr>::iterator it = m_Widgets.begin(); it != m_Widgets.end(); ++it)
-                {
-                    if (*it != widget)
-                        (*it)->mouseNoLongerDown();
-                }
+                // Tell the other widgets on which the mouse went down that the mouse has gone up
+                releasePressedWidgets(widget.get());
 
                 if (widget != nullptr)
                     return true;
@@ -1302,47 +1606,190 @@ namespace tgui
 
     Widget::Ptr Container::mouseOnWhichWidget(float x, float y)
     {
-        bool widgetFound = false;
         Widget::Ptr widget = nullptr;
 
-        // Loop through all widgets
-        for (std::vector<Widget::Ptr>::reverse_iterator it = m_Widgets.rbegin(); it != m_Widgets.rend(); ++it)
+        updateWidgetFlags();
+
+        // Loop through all widgets, starting with the one in front
+        for (int i = static_cast<int>(m_Widgets.size()) - 1; i >= 0; --i)
         {
             // Check if the widget is visible and enabled
-            if (((*it)->m_Visible) && ((*it)->m_Enabled))
+            if (m_WidgetFlags[i] & WidgetFlagReceivesMouse)
             {
-                if (widgetFound == false)
+                // Return the widget if the mouse is on top of it
+                if (m_Widgets[i]->mouseOnWidget(x, y))
                 {
-                    // Return the widget if the mouse is on top of it
-                    if ((*it)->mouseOnWidget(x, y))
-                    {
-                        widget = *it;
-                        widgetFound = true;
-                    }
+                    widget = m_Widgets[i];
+                    break;
                 }
-                else // The widget was already found, so tell the other widgets that the mouse can't be on them
-                    (*it)->mouseNotOnWidget();
             }
         }
 
+        // The widgets in front of the found widget already noticed that the mouse isn't on them while being checked.
+        // Of the widgets behind it, only the one that was below the mouse before has to be told that the mouse left it.
+        setHoveredWidget(widget.get());
         return widget;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
+    void Container::setHoveredWidget(Widget* widget)
     {
-        // Draw all widgets when they are visible
+        if (m_HoveredWidget != widget)
+        {
+            Widget* const oldHoveredWidget = m_HoveredWidget;
+            m_HoveredWidget = widget;
+
+            if (oldHoveredWidget != nullptr)
+                oldHoveredWidget->mouseNotOnWidget();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isWidgetPressed(const Widget& widget)
+    {
+        if (widget.m_MouseDown)
+            return true;
+
+        // A container can be pressed because the mouse went down on one of its widgets
+        if (widget.m_ContainerWidget)
+            return !static_cast<const Container&>(widget).m_PressedWidgets.empty();
+        else
+            return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::releasePressedWidgets(const Widget* releasedWidget)
+    {
+        // The list is emptied first, because the widgets may add or remove widgets when they are released
+        std::vector<Widget::Ptr> pressedWidgets;
+        pressedWidgets.swap(m_PressedWidgets);
+
+        for (unsigned int i = 0; i < pressedWidgets.size(); ++i)
+        {
+            if (pressedWidgets[i].get() != releasedWidget)
+                pressedWidgets[i]->mouseNoLongerDown();
+
+            // Some widgets stay pressed until something else happens (e.g. an opened menu that is not yet closed)
+            if (isWidgetPressed(*pressedWidgets[i]))
+                m_PressedWidgets.push_back(pressedWidgets[i]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateWidgetFlags() const
+    {
+        if (!m_WidgetFlagsNeedUpdate)
+            return;
+
+        m_WidgetFlags.resize(m_Widgets.size());
         for (unsigned int i = 0; i < m_Widgets.size(); ++i)
         {
+            unsigned char flags = 0;
             if (m_Widgets[i]->m_Visible)
+            {
+                flags |= WidgetFlagVisible;
+                if (m_Widgets[i]->m_Enabled)
+                    flags |= WidgetFlagReceivesMouse;
+            }
+
+            m_WidgetFlags[i] = flags;
+        }
+
+        m_WidgetFlagsNeedUpdate = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::widgetStateChanged()
+    {
+        m_WidgetFlagsNeedUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states, const sf::IntRect& clippingArea) const
+    {
+        // Convert the corners of the clipping area to the coordinate system of the widgets inside this container
+        const sf::View& view = target->getView();
+        const sf::Transform inverseTransform = states.transform.getInverse();
+        const sf::Vector2i topLeft(clippingArea.left, clippingArea.top);
+        const sf::Vector2i bottomRight(clippingArea.left + clippingArea.width, clippingArea.top + clippingArea.height);
+        const sf::Vector2f corners[4] = {inverseTransform.transformPoint(target->mapPixelToCoords(topLeft, view)),
+                                         inverseTransform.transformPoint(target->mapPixelToCoords(sf::Vector2i(bottomRight.x, topLeft.y), view)),
+                                         inverseTransform.transformPoint(target->mapPixelToCoords(sf::Vector2i(topLeft.x, bottomRight.y), view)),
+                                         inverseTransform.transformPoint(target->mapPixelToCoords(bottomRight, view))};
+
+        sf::Vector2f minimum = corners[0];
+        sf::Vector2f maximum = corners[0];
+        for (unsigned int i = 1; i < 4; ++i)
+        {
+            minimum.x = TGUI_MINIMUM(minimum.x, corners[i].x);
+            minimum.y = TGUI_MINIMUM(minimum.y, corners[i].y);
+            maximum.x = TGUI_MAXIMUM(maximum.x, corners[i].x);
+            maximum.y = TGUI_MAXIMUM(maximum.y, corners[i].y);
+        }
+
+        const sf::FloatRect visibleArea(minimum, maximum - minimum);
+
+        updateWidgetFlags();
+
+        // Refresh the cached bounds when they are no longer correct
+        if (m_CacheWidgetBounds && m_WidgetBoundsNeedUpdate)
+        {
+            m_WidgetBounds.resize(m_Widgets.size());
+            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+                m_WidgetBounds[i] = m_Widgets[i]->getDrawBounds();
+
+            m_WidgetBoundsNeedUpdate = false;
+        }
+
+        // Draw all widgets when they are visible
+        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+        {
+            if (m_WidgetFlags[i] & WidgetFlagVisible)
+            {
+                // Don't draw the widget when it lies completely outside the clipping area
+                if (m_CacheWidgetBounds)
+                {
+                    if (!visibleArea.intersects(m_WidgetBounds[i]))
+                        continue;
+                }
+                else
+                {
+                    if (!visibleArea.intersects(m_Widgets[i]->getDrawBounds()))
+                        continue;
+                }
+
                 m_Widgets[i]->draw(*target, states);
+            }
         }
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetArena* Container::getWidgetArena()
+    {
+        if (m_WidgetArena == nullptr)
+            m_WidgetArena = new WidgetArena();
+
+        return m_WidgetArena;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    GuiContainer::GuiContainer() :
+    m_Window     (nullptr),
+    m_NeedsRedraw(true)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::unbindGlobalCallback()
     {
         m_GlobalCallbackFunctions.erase(++m_GlobalCallbackFunctions.begin(), m_GlobalCallbackFunctions.end());
@@ -1377,6 +1824,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void GuiContainer::invalidate()
+    {
+        m_NeedsRedraw = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::draw(sf::RenderTarget&, sf::RenderStates) const
     {
     }
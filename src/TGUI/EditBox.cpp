@@ -24,6 +24,7 @@
 
 
 #include <cmath>
+#include <algorithm>
 
 #include <SFML/OpenGL.hpp>
 
@@ -42,6 +43,7 @@ namespace tgui
     m_LimitTextWidth        (false),
     m_DisplayedText         (""),
     m_Text                  (""),
+    m_CharacterOffsets      (1, 0),
     m_TextSize              (0),
     m_TextAlignment         (Alignment::Left),
     m_SelChars              (0),
@@ -56,7 +58,6 @@ namespace tgui
     m_SeparateHoverImage    (false)
     {
         m_Callback.widgetType = Type_EditBox;
-        m_AnimatedWidget = true;
         m_DraggableWidget = true;
         m_AllowFocus = true;
 
@@ -75,6 +76,8 @@ namespace tgui
     m_LimitTextWidth        (copy.m_LimitTextWidth),
     m_DisplayedText         (copy.m_DisplayedText),
     m_Text                  (copy.m_Text),
+    m_CharacterWidths       (copy.m_CharacterWidths),
+    m_CharacterOffsets      (copy.m_CharacterOffsets),
     m_TextSize              (copy.m_TextSize),
     m_TextAlignment         (copy.m_TextAlignment),
     m_SelChars              (copy.m_SelChars),
@@ -92,7 +95,8 @@ namespace tgui
     m_TextFull              (copy.m_TextFull),
     m_PossibleDoubleClick   (copy.m_PossibleDoubleClick),
     m_NumbersOnly           (copy.m_NumbersOnly),
-    m_SeparateHoverImage    (copy.m_SeparateHoverImage)
+    m_SeparateHoverImage    (copy.m_SeparateHoverImage),
+    m_UndoHistory           (copy.m_UndoHistory)
     {
         TGUI_TextureManager.copyTexture(copy.m_TextureNormal_L, m_TextureNormal_L);
         TGUI_TextureManager.copyTexture(copy.m_TextureNormal_M, m_TextureNormal_M);
@@ -107,6 +111,50 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    EditBox::EditBox(EditBox&& other) :
+    ClickableWidget         (std::move(other)),
+    WidgetBorders           (other),
+    m_LoadedConfigFile      (std::move(other.m_LoadedConfigFile)),
+    m_SelectionPointVisible (other.m_SelectionPointVisible),
+    m_LimitTextWidth        (other.m_LimitTextWidth),
+    m_DisplayedText         (std::move(other.m_DisplayedText)),
+    m_Text                  (std::move(other.m_Text)),
+    m_CharacterWidths       (std::move(other.m_CharacterWidths)),
+    m_CharacterOffsets      (std::move(other.m_CharacterOffsets)),
+    m_TextSize              (other.m_TextSize),
+    m_TextAlignment         (other.m_TextAlignment),
+    m_SelChars              (other.m_SelChars),
+    m_SelStart              (other.m_SelStart),
+    m_SelEnd                (other.m_SelEnd),
+    m_PasswordChar          (other.m_PasswordChar),
+    m_MaxChars              (other.m_MaxChars),
+    m_SplitImage            (other.m_SplitImage),
+    m_TextCropPosition      (other.m_TextCropPosition),
+    m_SelectedTextBackground(other.m_SelectedTextBackground),
+    m_SelectionPoint        (other.m_SelectionPoint),
+    m_TextBeforeSelection   (std::move(other.m_TextBeforeSelection)),
+    m_TextSelection         (std::move(other.m_TextSelection)),
+    m_TextAfterSelection    (std::move(other.m_TextAfterSelection)),
+    m_TextFull              (std::move(other.m_TextFull)),
+    m_PossibleDoubleClick   (other.m_PossibleDoubleClick),
+    m_NumbersOnly           (other.m_NumbersOnly),
+    m_SeparateHoverImage    (other.m_SeparateHoverImage),
+    m_UndoHistory           (std::move(other.m_UndoHistory))
+    {
+        // Take over the textures, the other widget will no longer release them
+        std::swap(m_TextureNormal_L, other.m_TextureNormal_L);
+        std::swap(m_TextureNormal_M, other.m_TextureNormal_M);
+        std::swap(m_TextureNormal_R, other.m_TextureNormal_R);
+        std::swap(m_TextureHover_L, other.m_TextureHover_L);
+        std::swap(m_TextureHover_M, other.m_TextureHover_M);
+        std::swap(m_TextureHover_R, other.m_TextureHover_R);
+        std::swap(m_TextureFocused_L, other.m_TextureFocused_L);
+        std::swap(m_TextureFocused_M, other.m_TextureFocused_M);
+        std::swap(m_TextureFocused_R, other.m_TextureFocused_R);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     EditBox::~EditBox()
     {
         if (m_TextureNormal_L.data != nullptr)   TGUI_TextureManager.removeTexture(m_TextureNormal_L);
@@ -137,6 +185,8 @@ namespace tgui
             std::swap(m_LimitTextWidth,         temp.m_LimitTextWidth);
             std::swap(m_DisplayedText,          temp.m_DisplayedText);
             std::swap(m_Text,                   temp.m_Text);
+            std::swap(m_CharacterWidths,        temp.m_CharacterWidths);
+            std::swap(m_CharacterOffsets,       temp.m_CharacterOffsets);
             std::swap(m_TextSize,               temp.m_TextSize);
             std::swap(m_TextAlignment,          temp.m_TextAlignment);
             std::swap(m_SelChars,               temp.m_SelChars);
@@ -164,6 +214,56 @@ namespace tgui
             std::swap(m_PossibleDoubleClick,    temp.m_PossibleDoubleClick);
             std::swap(m_NumbersOnly,            temp.m_NumbersOnly);
             std::swap(m_SeparateHoverImage,     temp.m_SeparateHoverImage);
+            std::swap(m_UndoHistory,            temp.m_UndoHistory);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    EditBox& EditBox::operator= (EditBox&& right)
+    {
+        if (this != &right)
+        {
+            this->ClickableWidget::operator=(std::move(right));
+            this->WidgetBorders::operator=(right);
+
+            std::swap(m_LoadedConfigFile,       right.m_LoadedConfigFile);
+            std::swap(m_SelectionPointVisible,  right.m_SelectionPointVisible);
+            std::swap(m_LimitTextWidth,         right.m_LimitTextWidth);
+            std::swap(m_DisplayedText,          right.m_DisplayedText);
+            std::swap(m_Text,                   right.m_Text);
+            std::swap(m_CharacterWidths,        right.m_CharacterWidths);
+            std::swap(m_CharacterOffsets,       right.m_CharacterOffsets);
+            std::swap(m_TextSize,               right.m_TextSize);
+            std::swap(m_TextAlignment,          right.m_TextAlignment);
+            std::swap(m_SelChars,               right.m_SelChars);
+            std::swap(m_SelStart,               right.m_SelStart);
+            std::swap(m_SelEnd,                 right.m_SelEnd);
+            std::swap(m_PasswordChar,           right.m_PasswordChar);
+            std::swap(m_MaxChars,               right.m_MaxChars);
+            std::swap(m_SplitImage,             right.m_SplitImage);
+            std::swap(m_TextCropPosition,       right.m_TextCropPosition);
+            std::swap(m_SelectedTextBackground, right.m_SelectedTextBackground);
+            std::swap(m_SelectionPoint,         right.m_SelectionPoint);
+            std::swap(m_TextBeforeSelection,    right.m_TextBeforeSelection);
+            std::swap(m_TextSelection,          right.m_TextSelection);
+            std::swap(m_TextAfterSelection,     right.m_TextAfterSelection);
+            std::swap(m_TextFull,               right.m_TextFull);
+            std::swap(m_TextureNormal_L,        right.m_TextureNormal_L);
+            std::swap(m_TextureNormal_M,        right.m_TextureNormal_M);
+            std::swap(m_TextureNormal_R,        right.m_TextureNormal_R);
+            std::swap(m_TextureHover_L,         right.m_TextureHover_L);
+            std::swap(m_TextureHover_M,         right.m_TextureHover_M);
+            std::swap(m_TextureHover_R,         right.m_TextureHover_R);
+            std::swap(m_TextureFocused_L,       right.m_TextureFocused_L);
+            std::swap(m_TextureFocused_M,       right.m_TextureFocused_M);
+            std::swap(m_TextureFocused_R,       right.m_TextureFocused_R);
+            std::swap(m_PossibleDoubleClick,    right.m_PossibleDoubleClick);
+            std::swap(m_NumbersOnly,            right.m_NumbersOnly);
+            std::swap(m_SeparateHoverImage,     right.m_SeparateHoverImage);
+            std::swap(m_UndoHistory,            right.m_UndoHistory);
         }
 
         return *this;
@@ -441,7 +541,7 @@ namespace tgui
 
     void EditBox::setPosition(float x, float y)
     {
-        Transformable::setPosition(x, y);
+        Widget::setPosition(x, y);
 
         if (m_SplitImage)
         {
@@ -483,6 +583,8 @@ namespace tgui
 
     void EditBox::setSize(float width, float height)
     {
+        invalidate();
+
         // Don't do anything when the edit box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -543,6 +645,8 @@ namespace tgui
 
     void EditBox::setText(const sf::String& text)
     {
+        invalidate();
+
         // Don't do anything when the edit box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -569,6 +673,9 @@ namespace tgui
             m_TextFull.setCharacterSize(m_TextSize);
         }
 
+        // Remember the old text to find out whether the undo history is still valid
+        const sf::String oldText = m_Text;
+
         // Change the text
         m_Text = text;
         m_DisplayedText = text;
@@ -599,6 +706,9 @@ namespace tgui
         m_TextAfterSelection.setString("");
         m_TextFull.setString(m_DisplayedText);
 
+        // The whole text changed, so all character positions have to be recalculated
+        recalculateCharacterOffsets();
+
         // Calculate the space inside the edit box
         float width;
         if (m_SplitImage)
@@ -613,24 +723,28 @@ namespace tgui
         // Check if there is a text width limit
         if (m_LimitTextWidth)
         {
-            // Now check if the text fits into the EditBox
-            while (m_TextBeforeSelection.findCharacterPos(m_TextBeforeSelection.getString().getSize()).x - m_TextBeforeSelection.getPosition().x > width)
+            // Find out how many characters fit into the EditBox
+            unsigned int visibleChars = m_DisplayedText.getSize();
+            while (m_CharacterOffsets[visibleChars] > width)
+                --visibleChars;
+
+            // Remove the characters that don't fit inside the EditBox
+            if (visibleChars < m_DisplayedText.getSize())
             {
-                // The text doesn't fit inside the EditBox, so the last character must be deleted.
-                m_Text.erase(m_Text.getSize()-1);
-                m_DisplayedText.erase(m_DisplayedText.getSize()-1);
+                const unsigned int removedChars = m_DisplayedText.getSize() - visibleChars;
+                m_Text.erase(visibleChars, sf::String::InvalidPos);
+                m_DisplayedText.erase(visibleChars, sf::String::InvalidPos);
+                removeCharacterOffsets(visibleChars, removedChars);
 
                 // Set the new text
                 m_TextBeforeSelection.setString(m_DisplayedText);
+                m_TextFull.setString(m_DisplayedText);
             }
-
-            // Set the full text again
-            m_TextFull.setString(m_DisplayedText);
         }
         else // There is no text cropping
         {
             // Calculate the text width
-            float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+            float textWidth = m_CharacterOffsets.back();
 
             // If the text can be moved to the right then do so
             if (textWidth > width)
@@ -642,6 +756,10 @@ namespace tgui
                 m_TextCropPosition = 0;
         }
 
+        // The changes to the old text can no longer be undone
+        if (m_Text != oldText)
+            m_UndoHistory.clear();
+
         // Set the selection point behind the last character
         setSelectionPointPosition(m_DisplayedText.getSize());
     }
@@ -657,6 +775,8 @@ namespace tgui
 
     void EditBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Change the text size
         m_TextSize = size;
 
@@ -675,11 +795,14 @@ namespace tgui
 
     void EditBox::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_TextBeforeSelection.setFont(font);
         m_TextSelection.setFont(font);
         m_TextAfterSelection.setFont(font);
         m_TextFull.setFont(font);
 
+        recalculateCharacterOffsets();
         recalculateTextPositions();
     }
 
@@ -694,6 +817,8 @@ namespace tgui
 
     void EditBox::setPasswordCharacter(char passwordChar)
     {
+        invalidate();
+
         // Don't do anything when the edit box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -716,6 +841,8 @@ namespace tgui
 
     void EditBox::setMaximumCharacters(unsigned int maxChars)
     {
+        invalidate();
+
         // Set the new character limit ( 0 to disable the limit )
         m_MaxChars = maxChars;
 
@@ -723,8 +850,11 @@ namespace tgui
         if ((m_MaxChars > 0) && (m_DisplayedText.getSize() > m_MaxChars))
         {
             // Remove all the excess characters
+            const unsigned int removedChars = m_DisplayedText.getSize() - m_MaxChars;
+            m_UndoHistory.addChange(TextHistory::Other, m_MaxChars, m_Text.substring(m_MaxChars, sf::String::InvalidPos), "", m_SelStart, m_SelEnd);
             m_Text.erase(m_MaxChars, sf::String::InvalidPos);
             m_DisplayedText.erase(m_MaxChars, sf::String::InvalidPos);
+            removeCharacterOffsets(m_MaxChars, removedChars);
 
             // If we passed here then the text has changed.
             m_TextBeforeSelection.setString(m_DisplayedText);
@@ -746,8 +876,95 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool EditBox::undo()
+    {
+        // Don't do anything when the edit box wasn't loaded correctly
+        if (m_Loaded == false)
+            return false;
+
+        const TextHistory::Change* change = m_UndoHistory.undo();
+        if (change == nullptr)
+            return false;
+
+        // The text may have been changed in a way that the history didn't see
+        if (change->position + change->inserted.getSize() > m_Text.getSize())
+        {
+            m_UndoHistory.clear();
+            return false;
+        }
+
+        invalidate();
+
+        // Put the removed characters back in place of the inserted ones
+        replaceCharacters(change->position, change->inserted.getSize(), change->removed);
+
+        // Restore the selection from before the change
+        setSelectionPointPosition(change->selectionEnd);
+        m_SelStart = TGUI_MINIMUM(change->selectionStart, m_Text.getSize());
+        if (m_SelStart != m_SelEnd)
+        {
+            unsigned int selectionStart = TGUI_MINIMUM(m_SelStart, m_SelEnd);
+            unsigned int selectionEnd = TGUI_MAXIMUM(m_SelStart, m_SelEnd);
+            m_SelChars = selectionEnd - selectionStart;
+
+            // Change our three texts
+            m_TextBeforeSelection.setString(m_DisplayedText.substring(0, selectionStart));
+            m_TextSelection.setString(m_DisplayedText.substring(selectionStart, m_SelChars));
+            m_TextAfterSelection.setString(m_DisplayedText.substring(selectionEnd));
+
+            recalculateTextPositions();
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool EditBox::redo()
+    {
+        // Don't do anything when the edit box wasn't loaded correctly
+        if (m_Loaded == false)
+            return false;
+
+        const TextHistory::Change* change = m_UndoHistory.redo();
+        if (change == nullptr)
+            return false;
+
+        // The text may have been changed in a way that the history didn't see
+        if (change->position + change->removed.getSize() > m_Text.getSize())
+        {
+            m_UndoHistory.clear();
+            return false;
+        }
+
+        invalidate();
+
+        // Make the change again and place the selection point behind the inserted characters
+        replaceCharacters(change->position, change->removed.getSize(), change->inserted);
+        setSelectionPointPosition(change->position + change->inserted.getSize());
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::setUndoMemoryLimit(std::size_t bytes)
+    {
+        m_UndoHistory.setMemoryLimit(bytes);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t EditBox::getUndoMemoryLimit() const
+    {
+        return m_UndoHistory.getMemoryLimit();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::setAlignment(Alignment::Alignments alignment)
     {
+        invalidate();
+
         m_TextAlignment = alignment;
         setText(m_Text);
     }
@@ -763,6 +980,8 @@ namespace tgui
 
     void EditBox::setBorders(unsigned int borderLeft, unsigned int borderTop, unsigned int borderRight, unsigned int borderBottom)
     {
+        invalidate();
+
         // Set the new border size
         m_LeftBorder   = borderLeft;
         m_TopBorder    = borderTop;
@@ -796,6 +1015,8 @@ namespace tgui
 
     void EditBox::setTextColor(const sf::Color& textColor)
     {
+        invalidate();
+
         m_TextBeforeSelection.setColor(textColor);
         m_TextAfterSelection.setColor(textColor);
     }
@@ -804,6 +1025,8 @@ namespace tgui
 
     void EditBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
+        invalidate();
+
         m_TextSelection.setColor(selectedTextColor);
     }
 
@@ -811,6 +1034,8 @@ namespace tgui
 
     void EditBox::setSelectedTextBackgroundColor(const sf::Color& selectedTextBackgroundColor)
     {
+        invalidate();
+
         m_SelectedTextBackground.setFillColor(selectedTextBackgroundColor);
     }
 
@@ -818,6 +1043,8 @@ namespace tgui
 
     void EditBox::setSelectionPointColor(const sf::Color& selectionPointColor)
     {
+        invalidate();
+
         m_SelectionPoint.setFillColor(selectionPointColor);
     }
 
@@ -869,12 +1096,19 @@ namespace tgui
             if (width < 0)
                 width = 0;
 
-            // Now check if the text fits into the EditBox
-            while (m_TextBeforeSelection.findCharacterPos(m_DisplayedText.getSize()).x - m_TextBeforeSelection.getPosition().x > width)
+            // Find out how many characters fit into the EditBox
+            unsigned int visibleChars = m_DisplayedText.getSize();
+            while (m_CharacterOffsets[visibleChars] > width)
+                --visibleChars;
+
+            // Remove the characters that don't fit inside the EditBox
+            if (visibleChars < m_DisplayedText.getSize())
             {
-                // The text doesn't fit inside the EditBox, so the last character must be deleted.
-                m_Text.erase(m_Text.getSize()-1);
-                m_DisplayedText.erase(m_DisplayedText.getSize()-1);
+                const unsigned int removedChars = m_DisplayedText.getSize() - visibleChars;
+                m_UndoHistory.addChange(TextHistory::Other, visibleChars, m_Text.substring(visibleChars, sf::String::InvalidPos), "", m_SelStart, m_SelEnd);
+                m_Text.erase(visibleChars, sf::String::InvalidPos);
+                m_DisplayedText.erase(visibleChars, sf::String::InvalidPos);
+                removeCharacterOffsets(visibleChars, removedChars);
                 m_TextBeforeSelection.setString(m_DisplayedText);
             }
 
@@ -894,6 +1128,8 @@ namespace tgui
 
     void EditBox::setSelectionPointPosition(unsigned int charactersBeforeSelectionPoint)
     {
+        invalidate();
+
         // The selection point position has to stay inside the string
         if (charactersBeforeSelectionPoint > m_Text.getSize())
             charactersBeforeSelectionPoint = m_Text.getSize();
@@ -924,7 +1160,7 @@ namespace tgui
                 width = 0;
 
             // Find out the position of the selection point
-            float selectionPointPosition = m_TextFull.findCharacterPos(m_SelEnd).x;
+            float selectionPointPosition = m_CharacterOffsets[m_SelEnd];
 
             if (m_SelEnd == m_DisplayedText.getSize())
                 selectionPointPosition += m_TextFull.getCharacterSize() / 10.f;
@@ -945,6 +1181,8 @@ namespace tgui
 
     void EditBox::setSelectionPointWidth(unsigned int width)
     {
+        invalidate();
+
         m_SelectionPoint.setPosition(m_SelectionPoint.getPosition().x + ((m_SelectionPoint.getSize().x - width) / 2.0f), m_SelectionPoint.getPosition().y);
         m_SelectionPoint.setSize(sf::Vector2f(static_cast<float>(width),
                                           m_Size.y - ((m_BottomBorder + m_TopBorder) * (m_Size.y / m_TextureNormal_M.getSize().y))));
@@ -962,6 +1200,8 @@ namespace tgui
 
     void EditBox::setNumbersOnly(bool numbersOnly)
     {
+        invalidate();
+
         m_NumbersOnly = numbersOnly;
 
         // Remove all letters from the edit box if needed
@@ -999,6 +1239,8 @@ namespace tgui
 
     void EditBox::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         if (m_SplitImage)
@@ -1021,6 +1263,9 @@ namespace tgui
 
     void EditBox::leftMousePressed(float x, float y)
     {
+        // Text that is typed after clicking is undone separately
+        m_UndoHistory.stopMerging();
+
         // Calculate the space inside the edit box
         float width;
         if (m_SplitImage)
@@ -1153,19 +1398,19 @@ namespace tgui
                     }
                 }
                 // Check if the mouse is on the right of the text AND there is a possibility to scroll
-                else if ((x - getPosition().x > (m_LeftBorder * scalingX) + width) && (m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x > width))
+                else if ((x - getPosition().x > (m_LeftBorder * scalingX) + width) && (m_CharacterOffsets.back() > width))
                 {
                     // Move the text by a few pixels
                     if (m_TextFull.getCharacterSize() > 10)
                     {
-                        if (m_TextCropPosition + width < m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x + (m_TextFull.getCharacterSize() / 10))
+                        if (m_TextCropPosition + width < m_CharacterOffsets.back() + (m_TextFull.getCharacterSize() / 10))
                             m_TextCropPosition += static_cast<unsigned int>(std::floor(m_TextFull.getCharacterSize() / 10.f + 0.5f));
                         else
-                            m_TextCropPosition = static_cast<unsigned int>(m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x + (m_TextFull.getCharacterSize() / 10) - width);
+                            m_TextCropPosition = static_cast<unsigned int>(m_CharacterOffsets.back() + (m_TextFull.getCharacterSize() / 10) - width);
                     }
                     else
                     {
-                        if (m_TextCropPosition + width < m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x)
+                        if (m_TextCropPosition + width < m_CharacterOffsets.back())
                             ++m_TextCropPosition;
                     }
                 }
@@ -1230,6 +1475,11 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        // Text that is typed after moving the selection point is undone separately
+        if ((event.code == sf::Keyboard::Left) || (event.code == sf::Keyboard::Right)
+         || (event.code == sf::Keyboard::Home) || (event.code == sf::Keyboard::End))
+            m_UndoHistory.stopMerging();
+
         // Check if one of the correct keys was pressed
         if (event.code == sf::Keyboard::Left)
         {
@@ -1313,8 +1563,10 @@ namespace tgui
                     return;
 
                 // Erase the character
+                m_UndoHistory.addChange(TextHistory::Backspace, m_SelEnd-1, m_Text.substring(m_SelEnd-1, 1), "", m_SelStart, m_SelEnd);
                 m_Text.erase(m_SelEnd-1, 1);
                 m_DisplayedText.erase(m_SelEnd-1, 1);
+                removeCharacterOffsets(m_SelEnd-1, 1);
 
                 // Set the selection point back on the correct position
                 setSelectionPointPosition(m_SelEnd - 1);
@@ -1331,7 +1583,7 @@ namespace tgui
                     width = 0;
 
                 // Calculate the text width
-                float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+                float textWidth = m_CharacterOffsets.back();
 
                 // If the text can be moved to the right then do so
                 if (textWidth > width)
@@ -1367,8 +1619,10 @@ namespace tgui
                     return;
 
                 // Erase the character
+                m_UndoHistory.addChange(TextHistory::Delete, m_SelEnd, m_Text.substring(m_SelEnd, 1), "", m_SelStart, m_SelEnd);
                 m_Text.erase(m_SelEnd, 1);
                 m_DisplayedText.erase(m_SelEnd, 1);
+                removeCharacterOffsets(m_SelEnd, 1);
 
                 // Set the selection point back on the correct position
                 setSelectionPointPosition(m_SelEnd);
@@ -1385,7 +1639,7 @@ namespace tgui
                     width = 0;
 
                 // Calculate the text width
-                float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+                float textWidth = m_CharacterOffsets.back();
 
                 // If the text can be moved to the right then do so
                 if (textWidth > width)
@@ -1422,29 +1676,19 @@ namespace tgui
                 }
                 else if (event.code == sf::Keyboard::V)
                 {
-                    auto clipboardContents = TGUI_Clipboard.get();
-
-                    // Only continue pasting if you actually have to do something
-                    if ((m_SelChars > 0) || (clipboardContents.getSize() > 0))
+                    // On X11 the contents may first have to arrive from another application, the widget could be gone by then.
+                    // Widgets that aren't owned by a SharedWidgetPtr can't be tracked, they paste the last known contents.
+                    WeakWidgetPtr<EditBox> editBox(this);
+                    if (editBox.expired())
+                        pasteText(TGUI_Clipboard.get());
+                    else
                     {
-                        deleteSelectedCharacters();
-
-                        unsigned int oldCaretPos = m_SelEnd;
-
-                        if (m_Text.getSize() > m_SelEnd)
-                            setText(m_Text.substring(0, m_SelEnd) + TGUI_Clipboard.get() + m_Text.substring(m_SelEnd, m_Text.getSize() - m_SelEnd));
-                        else
-                            setText(m_Text + clipboardContents);
-
-                        setSelectionPointPosition(oldCaretPos + clipboardContents.getSize());
-
-                        // Add the callback (if the user requested it)
-                        if (m_CallbackFunctions[TextChanged].empty() == false)
-                        {
-                            m_Callback.trigger = TextChanged;
-                            m_Callback.text    = m_Text;
-                            addCallback();
-                        }
+                        TGUI_Clipboard.requestContents([editBox](const sf::String& contents)
+                            {
+                                EditBox::Ptr widget = editBox.lock();
+                                if (widget != nullptr)
+                                    widget->pasteText(contents);
+                            });
                     }
                 }
                 else if (event.code == sf::Keyboard::X)
@@ -1454,6 +1698,8 @@ namespace tgui
                 }
                 else if (event.code == sf::Keyboard::A)
                 {
+                    m_UndoHistory.stopMerging();
+
                     m_SelStart = 0;
                     m_SelEnd = m_Text.getSize();
                     m_SelChars = m_Text.getSize();
@@ -1464,6 +1710,30 @@ namespace tgui
 
                     recalculateTextPositions();
                 }
+                else if ((event.code == sf::Keyboard::Z) || (event.code == sf::Keyboard::Y))
+                {
+                    // Ctrl+Z undoes the last change, Ctrl+Y and Ctrl+Shift+Z redo it
+                    bool changed;
+                    if ((event.code == sf::Keyboard::Z) && !event.shift)
+                        changed = undo();
+                    else
+                        changed = redo();
+
+                    if (changed)
+                    {
+                        // The selection point should be visible again
+                        m_SelectionPointVisible = true;
+                        m_AnimationTimeElapsed = sf::Time();
+
+                        // Add the callback (if the user requested it)
+                        if (m_CallbackFunctions[TextChanged].empty() == false)
+                        {
+                            m_Callback.trigger = TextChanged;
+                            m_Callback.text    = m_Text;
+                            addCallback();
+                        }
+                    }
+                }
             }
         }
     }
@@ -1527,6 +1797,8 @@ namespace tgui
         else
             m_DisplayedText.insert(m_SelEnd, key);
 
+        insertCharacterOffsets(m_SelEnd, 1);
+
         // Append the character to the text
         m_TextFull.setString(m_DisplayedText);
 
@@ -1541,15 +1813,20 @@ namespace tgui
         if (m_LimitTextWidth)
         {
             // Now check if the text fits into the EditBox
-            if (m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x > width)
+            if (m_CharacterOffsets.back() > width)
             {
                 // If the text does not fit in the EditBox then delete the added character
                 m_Text.erase(m_SelEnd, 1);
                 m_DisplayedText.erase(m_SelEnd, 1);
+                removeCharacterOffsets(m_SelEnd, 1);
+                m_TextFull.setString(m_DisplayedText);
                 return;
             }
         }
 
+        // Remember the typed character
+        m_UndoHistory.addChange(TextHistory::Typing, m_SelEnd, "", sf::String(key), m_SelStart, m_SelEnd);
+
         // Move our selection point forward
         setSelectionPointPosition(m_SelEnd + 1);
 
@@ -1568,12 +1845,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void EditBox::widgetFocused()
+    {
+        // The selection point only blinks while the widget is focused
+        m_SelectionPointVisible = true;
+        m_AnimationTimeElapsed = sf::Time();
+        startAnimation();
+
+        Widget::widgetFocused();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::widgetUnfocused()
     {
         // If there is a selection then undo it now
         if (m_SelChars)
             setSelectionPointPosition(m_SelEnd);
 
+        stopAnimation();
         Widget::widgetUnfocused();
     }
 
@@ -1795,26 +2085,6 @@ namespace tgui
         if (m_DisplayedText.isEmpty())
             return 0;
 
-        // Find out what the first visible character is
-        unsigned int firstVisibleChar;
-        if (m_TextCropPosition)
-        {
-            // Start searching near the selection point to quickly find the character even in a very long string
-            firstVisibleChar = m_SelEnd;
-
-            // Go backwards to find the character
-            while (m_TextFull.findCharacterPos(firstVisibleChar-1).x > m_TextCropPosition)
-                --firstVisibleChar;
-        }
-        else // If the first part is visible then the first character is also visible
-            firstVisibleChar = 0;
-
-        sf::String tempString;
-        float textWidthWithoutLastChar;
-        float fullTextWidth;
-        float halfOfLastCharWidth;
-        unsigned int lastVisibleChar;
-
         // Calculate the space inside the edit box
         float width;
         if (m_SplitImage)
@@ -1831,7 +2101,7 @@ namespace tgui
         if (m_TextAlignment != Alignment::Left)
         {
             // Calculate the text width
-            float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+            float textWidth = m_CharacterOffsets.back();
 
             // Check if a layout would make sense
             if (textWidth < width)
@@ -1844,48 +2114,36 @@ namespace tgui
             }
         }
 
-        // Find out what the last visible character is, starting from the selection point
-        lastVisibleChar = m_SelEnd;
-
-        // Go forward to find the character
-        while (m_TextFull.findCharacterPos(lastVisibleChar+1).x < m_TextCropPosition + width)
+        // Find out what the first visible character is
+        unsigned int firstVisibleChar = 0;
+        if (m_TextCropPosition)
         {
-            if (lastVisibleChar == m_DisplayedText.getSize())
-                break;
-
-            ++lastVisibleChar;
+            firstVisibleChar = std::upper_bound(m_CharacterOffsets.begin(), m_CharacterOffsets.end(), static_cast<float>(m_TextCropPosition)) - m_CharacterOffsets.begin();
+            firstVisibleChar = TGUI_MINIMUM(firstVisibleChar, m_SelEnd);
         }
 
-        // Set the first part of the text
-        tempString = m_DisplayedText.substring(0, firstVisibleChar);
-        m_TextFull.setString(tempString);
+        // Find out what the last visible character is
+        unsigned int lastVisibleChar = std::lower_bound(m_CharacterOffsets.begin(), m_CharacterOffsets.end(), m_TextCropPosition + width) - m_CharacterOffsets.begin();
+        if (lastVisibleChar > 0)
+            --lastVisibleChar;
+        lastVisibleChar = TGUI_MAXIMUM(lastVisibleChar, m_SelEnd);
 
-        // Calculate the first position
-        fullTextWidth = m_TextFull.findCharacterPos(firstVisibleChar).x;
+        // Convert the mouse position to a position inside the full text
+        posX += m_TextCropPosition - pixelsToMove;
 
-        // for all the other characters, check where you have clicked.
-        for (unsigned int i = firstVisibleChar; i < lastVisibleChar; ++i)
+        // Search the first character of which the middle lies behind the mouse
+        unsigned int low = firstVisibleChar;
+        unsigned int high = lastVisibleChar;
+        while (low < high)
         {
-            // Add the next character to the temporary string
-            tempString += m_DisplayedText[i];
-            m_TextFull.setString(tempString);
-
-            // Make some calculations
-            textWidthWithoutLastChar = fullTextWidth;
-            fullTextWidth = m_TextFull.findCharacterPos(i + 1).x;
-            halfOfLastCharWidth = (fullTextWidth - textWidthWithoutLastChar) / 2.0f;
-
-            // Check if you have clicked on the first halve of that character
-            if (posX < textWidthWithoutLastChar + pixelsToMove + halfOfLastCharWidth - m_TextCropPosition)
-            {
-                m_TextFull.setString(m_DisplayedText);
-                return i;
-            }
+            unsigned int middle = low + (high - low) / 2;
+            if (posX < (m_CharacterOffsets[middle] + m_CharacterOffsets[middle + 1]) / 2.f)
+                high = middle;
+            else
+                low = middle + 1;
         }
 
-        // If you pass here then you clicked behind all the characters
-        m_TextFull.setString(m_DisplayedText);
-        return lastVisibleChar;
+        return low;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1896,12 +2154,17 @@ namespace tgui
         if (m_SelChars == 0)
             return;
 
+        // Remember which characters are removed
+        m_UndoHistory.addChange(TextHistory::Other, TGUI_MINIMUM(m_SelStart, m_SelEnd),
+                                m_Text.substring(TGUI_MINIMUM(m_SelStart, m_SelEnd), m_SelChars), "", m_SelStart, m_SelEnd);
+
         // Check if the characters were selected from left to right
         if (m_SelStart < m_SelEnd)
         {
             // Erase the characters
             m_Text.erase(m_SelStart, m_SelChars);
             m_DisplayedText.erase(m_SelStart, m_SelChars);
+            removeCharacterOffsets(m_SelStart, m_SelChars);
 
             // Set the selection point back on the correct position
             setSelectionPointPosition(m_SelStart);
@@ -1911,6 +2174,7 @@ namespace tgui
             // Erase the characters
             m_Text.erase(m_SelEnd, m_SelChars);
             m_DisplayedText.erase(m_SelEnd, m_SelChars);
+            removeCharacterOffsets(m_SelEnd, m_SelChars);
 
             // Set the selection point back on the correct position
             setSelectionPointPosition(m_SelEnd);
@@ -1928,7 +2192,7 @@ namespace tgui
             width = 0;
 
         // Calculate the text width
-        float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+        float textWidth = m_CharacterOffsets.back();
 
         // If the text can be moved to the right then do so
         if (textWidth > width)
@@ -1942,6 +2206,52 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void EditBox::pasteText(const sf::String& contents)
+    {
+        // Only continue pasting if you actually have to do something
+        if ((m_SelChars > 0) || (contents.getSize() > 0))
+        {
+            deleteSelectedCharacters();
+
+            unsigned int oldCaretPos = m_SelEnd;
+
+            // The pasted characters are inserted unchanged unless setText has to filter the text. Only then the change has to be
+            // found by comparing the old and new text.
+            const bool filtered = m_NumbersOnly || ((m_MaxChars > 0) && (m_Text.getSize() + contents.getSize() > m_MaxChars));
+            sf::String oldText;
+            if (filtered)
+                oldText = m_Text;
+
+            // The text is filtered by setText, which would also forget the undo history
+            TextHistory undoHistory;
+            std::swap(undoHistory, m_UndoHistory);
+
+            if (m_Text.getSize() > m_SelEnd)
+                setText(m_Text.substring(0, m_SelEnd) + contents + m_Text.substring(m_SelEnd, m_Text.getSize() - m_SelEnd));
+            else
+                setText(m_Text + contents);
+
+            std::swap(undoHistory, m_UndoHistory);
+
+            if (filtered)
+                m_UndoHistory.addChange(TextHistory::Other, oldText, m_Text, oldCaretPos, oldCaretPos);
+            else
+                m_UndoHistory.addChange(TextHistory::Other, oldCaretPos, "", contents, oldCaretPos, oldCaretPos);
+
+            setSelectionPointPosition(oldCaretPos + contents.getSize());
+
+            // Add the callback (if the user requested it)
+            if (m_CallbackFunctions[TextChanged].empty() == false)
+            {
+                m_Callback.trigger = TextChanged;
+                m_Callback.text    = m_Text;
+                addCallback();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::recalculateTextPositions()
     {
         float textX = getPosition().x;
@@ -1967,7 +2277,7 @@ namespace tgui
             float width = m_Size.x - ((m_LeftBorder + m_RightBorder) * borderScale);
 
             // Calculate the text width
-            float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+            float textWidth = m_CharacterOffsets.back();
 
             // Check if a layout would make sense
             if (textWidth < width)
@@ -1993,36 +2303,159 @@ namespace tgui
         // Check if there is a selection
         if (m_SelChars != 0)
         {
-            // Watch out for the kerning
-            if (m_TextBeforeSelection.getString().getSize() > 0)
-                textX += m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[m_TextBeforeSelection.getString().getSize() - 1], m_DisplayedText[m_TextBeforeSelection.getString().getSize()], m_TextBeforeSelection.getCharacterSize());
+            const unsigned int selectionStart = m_TextBeforeSelection.getString().getSize();
+            const unsigned int selectionEnd = selectionStart + m_TextSelection.getString().getSize();
+
+            // Find out where the selection starts and where it ends (watch out for the kerning)
+            float selectionLeft = m_CharacterOffsets[selectionStart];
+            if (selectionStart > 0)
+                selectionLeft += m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[selectionStart - 1], m_DisplayedText[selectionStart], m_TextBeforeSelection.getCharacterSize());
+
+            float selectionRight = m_CharacterOffsets[selectionEnd];
+            if (m_DisplayedText.getSize() > selectionEnd)
+                selectionRight += m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[selectionEnd - 1], m_DisplayedText[selectionEnd], m_TextBeforeSelection.getCharacterSize());
 
-            textX += m_TextBeforeSelection.findCharacterPos(m_TextBeforeSelection.getString().getSize()).x - m_TextBeforeSelection.getPosition().x;
+            textX += selectionLeft;
 
             // Set the position and size of the rectangle that gets drawn behind the selected text
-            m_SelectedTextBackground.setSize(sf::Vector2f(m_TextSelection.findCharacterPos(m_TextSelection.getString().getSize()).x - m_TextSelection.getPosition().x,
+            m_SelectedTextBackground.setSize(sf::Vector2f(m_CharacterOffsets[selectionEnd] - selectionLeft,
                                                           (m_Size.y - ((m_TopBorder + m_BottomBorder) * scaling.y))));
             m_SelectedTextBackground.setPosition(std::floor(textX + 0.5f), std::floor(getPosition().y + (m_TopBorder * scaling.y) + 0.5f));
 
             // Set the text selected text on the correct position
             m_TextSelection.setPosition(std::floor(textX + 0.5f), std::floor(textY + 0.5f));
 
-            // Watch out for kerning
-            if (m_DisplayedText.getSize() > m_TextBeforeSelection.getString().getSize() + m_TextSelection.getString().getSize())
-                textX += m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[m_TextBeforeSelection.getString().getSize() + m_TextSelection.getString().getSize() - 1], m_DisplayedText[m_TextBeforeSelection.getString().getSize() + m_TextSelection.getString().getSize()], m_TextBeforeSelection.getCharacterSize());
-
-            // Set the text selected text on the correct position
-            textX += m_TextSelection.findCharacterPos(m_TextSelection.getString().getSize()).x  - m_TextSelection.getPosition().x;
+            // Set the text behind the selection on the correct position
+            textX += selectionRight - selectionLeft;
             m_TextAfterSelection.setPosition(std::floor(textX + 0.5f), std::floor(textY + 0.5f));
         }
 
         // Set the position of the selection point
-        selectionPointLeft += m_TextFull.findCharacterPos(m_SelEnd).x - (m_SelectionPoint.getSize().x * 0.5f);
+        selectionPointLeft += m_CharacterOffsets[m_SelEnd] - (m_SelectionPoint.getSize().x * 0.5f);
         m_SelectionPoint.setPosition(std::floor(selectionPointLeft + 0.5f), std::floor((m_TopBorder * scaling.y) + getPosition().y + 0.5f));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float EditBox::getCharacterWidth(unsigned int index) const
+    {
+        const sf::Font* font = m_TextFull.getFont();
+        if (font == nullptr)
+            return 0;
+
+        const unsigned int characterSize = m_TextFull.getCharacterSize();
+        const bool bold = (m_TextFull.getStyle() & sf::Text::Bold) != 0;
+
+        sf::Uint32 curChar = m_DisplayedText[index];
+
+        float width = 0;
+        if (index > 0)
+            width += font->getKerning(m_DisplayedText[index - 1], curChar, characterSize);
+
+        // Spaces and tabs are handled the same way as in sf::Text
+        if (curChar == ' ')
+            width += font->getGlyph(L' ', characterSize, bold).advance;
+        else if (curChar == '\t')
+            width += font->getGlyph(L' ', characterSize, bold).advance * 4;
+        else
+            width += font->getGlyph(curChar, characterSize, bold).advance;
+
+        return width;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::replaceCharacters(unsigned int position, unsigned int count, const sf::String& characters)
+    {
+        // Remove the old characters
+        m_Text.erase(position, count);
+        m_DisplayedText.erase(position, count);
+        removeCharacterOffsets(position, count);
+
+        // Insert the new characters
+        m_Text.insert(position, characters);
+        if (m_PasswordChar != '\0')
+            m_DisplayedText.insert(position, sf::String(std::basic_string<sf::Uint32>(characters.getSize(), m_PasswordChar)));
+        else
+            m_DisplayedText.insert(position, characters);
+
+        insertCharacterOffsets(position, characters.getSize());
+        m_TextFull.setString(m_DisplayedText);
+
+        // Calculate the space inside the edit box
+        float width;
+        if (m_SplitImage)
+            width = m_Size.x - ((m_LeftBorder + m_RightBorder) * (m_Size.y / m_TextureNormal_M.getSize().y));
+        else
+            width = m_Size.x - ((m_LeftBorder + m_RightBorder) * (m_Size.x / m_TextureNormal_M.getSize().x));
+
+        // If the width is negative then the edit box is too small to be displayed
+        if (width < 0)
+            width = 0;
+
+        // Calculate the text width
+        float textWidth = m_CharacterOffsets.back();
+
+        // If the text can be moved to the right then do so
+        if (textWidth > width)
+        {
+            if (textWidth - m_TextCropPosition < width)
+                m_TextCropPosition = static_cast<unsigned int>(textWidth - width);
+        }
+        else
+            m_TextCropPosition = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::recalculateCharacterOffsets()
+    {
+        m_CharacterWidths.resize(m_DisplayedText.getSize());
+        for (unsigned int i = 0; i < m_CharacterWidths.size(); ++i)
+            m_CharacterWidths[i] = getCharacterWidth(i);
+
+        m_CharacterOffsets.resize(m_CharacterWidths.size() + 1);
+        updateCharacterOffsets(0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::insertCharacterOffsets(unsigned int index, unsigned int count)
+    {
+        m_CharacterWidths.insert(m_CharacterWidths.begin() + index, count, 0);
+        m_CharacterOffsets.insert(m_CharacterOffsets.begin() + index, count, 0);
+
+        // The character behind the inserted ones also has to be recalculated because of the kerning
+        for (unsigned int i = index; (i <= index + count) && (i < m_CharacterWidths.size()); ++i)
+            m_CharacterWidths[i] = getCharacterWidth(i);
+
+        updateCharacterOffsets(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::removeCharacterOffsets(unsigned int index, unsigned int count)
+    {
+        m_CharacterWidths.erase(m_CharacterWidths.begin() + index, m_CharacterWidths.begin() + index + count);
+        m_CharacterOffsets.erase(m_CharacterOffsets.begin() + index + 1, m_CharacterOffsets.begin() + index + count + 1);
+
+        // The kerning of the character that now follows the removed ones may have changed
+        if (index < m_CharacterWidths.size())
+            m_CharacterWidths[index] = getCharacterWidth(index);
+
+        updateCharacterOffsets(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::updateCharacterOffsets(unsigned int index)
+    {
+        for (unsigned int i = index; i < m_CharacterWidths.size(); ++i)
+            m_CharacterOffsets[i + 1] = m_CharacterOffsets[i] + m_CharacterWidths[i];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::initialize(Container *const parent)
     {
         m_Parent = parent;
@@ -2053,6 +2486,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time EditBox::getTimeUntilNextUpdate() const
+    {
+        return sf::milliseconds(500) - m_AnimationTimeElapsed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         // Don't draw anything when the edit box was not loaded correctly
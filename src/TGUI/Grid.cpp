@@ -66,6 +66,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Grid::Grid(Grid&& other) :
+    Container     (std::move(other)),
+    m_GridWidgets (std::move(other.m_GridWidgets)),
+    m_ObjBorders  (std::move(other.m_ObjBorders)),
+    m_ObjLayout   (std::move(other.m_ObjLayout)),
+    m_RowHeight   (std::move(other.m_RowHeight)),
+    m_ColumnWidth (std::move(other.m_ColumnWidth)),
+    m_Size        (other.m_Size),
+    m_IntendedSize(other.m_IntendedSize)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Grid::~Grid()
     {
     }
@@ -94,6 +108,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Grid& Grid::operator= (Grid&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            this->Container::operator=(std::move(right));
+
+            std::swap(m_GridWidgets,  right.m_GridWidgets);
+            std::swap(m_ObjBorders,   right.m_ObjBorders);
+            std::swap(m_ObjLayout,    right.m_ObjLayout);
+            std::swap(m_RowHeight,    right.m_RowHeight);
+            std::swap(m_ColumnWidth,  right.m_ColumnWidth);
+            std::swap(m_Size,         right.m_Size);
+            std::swap(m_IntendedSize, right.m_IntendedSize);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Grid* Grid::clone()
     {
         return new Grid(*this);
@@ -103,6 +138,8 @@ namespace tgui
 
     void Grid::setSize(float width, float height)
     {
+        invalidate();
+
         // A negative size is not allowed for this object
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -125,6 +162,8 @@ namespace tgui
 
     void Grid::remove(const Widget::Ptr& widget)
     {
+        invalidate();
+
         remove(widget.get());
     }
 
@@ -132,6 +171,8 @@ namespace tgui
 
     void Grid::remove(Widget* widget)
     {
+        invalidate();
+
         // Find the widget in the grid
         for (unsigned int row = 0; row < m_GridWidgets.size(); ++row)
         {
@@ -185,6 +226,8 @@ namespace tgui
 
     void Grid::removeAllWidgets()
     {
+        invalidate();
+
         m_GridWidgets.clear();
         m_ObjBorders.clear();
         m_ObjLayout.clear();
@@ -535,8 +578,7 @@ namespace tgui
             mouseLeftWidget();
 
             // Tell the widgets inside the grid that the mouse is no longer on top of them
-            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
+            setHoveredWidget(nullptr);
 
             m_MouseHover = false;
         }
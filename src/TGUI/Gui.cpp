@@ -154,8 +154,18 @@ namespace tgui
                 TGUI_Clipboard.setWindowHandle(static_cast<sf::RenderWindow*>(m_Window)->getSystemHandle());
         }
 
-        // Let the event manager handle the event
-        return m_Container.handleEvent(event);
+        // The window has to be redrawn when its size or focus changed
+        if ((event.type == sf::Event::Resized) || (event.type == sf::Event::LostFocus) || (event.type == sf::Event::GainedFocus))
+            m_Container.m_NeedsRedraw = true;
+
+        // Let the event manager handle the event. A widget that reacts to an event may look different afterwards.
+        if (m_Container.handleEvent(event))
+        {
+            m_Container.m_NeedsRedraw = true;
+            return true;
+        }
+        else
+            return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -174,24 +184,33 @@ namespace tgui
         else
             m_Clock.restart();
 
+        // Pass the contents that arrived from other applications to the widgets that are pasting them
+        TGUI_Clipboard.update();
+
         // Check if clipping is enabled
         GLboolean clippingEnabled = glIsEnabled(GL_SCISSOR_TEST);
         GLint scissor[4];
+        sf::IntRect clippingArea;
 
         if (clippingEnabled)
         {
             // Remember the old clipping area
             glGetIntegerv(GL_SCISSOR_BOX, scissor);
+
+            // The scissor box counts from the bottom of the window, the clipping area from the top
+            clippingArea = sf::IntRect(scissor[0], static_cast<int>(m_Window->getSize().y) - scissor[1] - scissor[3], scissor[2], scissor[3]);
         }
         else // Clipping was disabled
         {
             // Enable clipping
             glEnable(GL_SCISSOR_TEST);
             glScissor(0, 0, m_Window->getSize().x, m_Window->getSize().y);
+
+            clippingArea = sf::IntRect(0, 0, m_Window->getSize().x, m_Window->getSize().y);
         }
 
         // Draw the window with all widgets inside it
-        m_Container.drawWidgetContainer(m_Window, sf::RenderStates::Default);
+        m_Container.drawWidgetContainer(m_Window, sf::RenderStates::Default, clippingArea);
 
         // Reset clipping to its original state
         if (clippingEnabled)
@@ -200,6 +219,24 @@ namespace tgui
             glDisable(GL_SCISSOR_TEST);
 
         m_Window->setView(oldView);
+
+        // Everything that changed is now visible on the screen
+        m_Container.m_NeedsRedraw = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::needsRedraw() const
+    {
+        if (m_Container.m_NeedsRedraw)
+            return true;
+
+        // The gui also changes when the next animation step is due or when pasted contents arrive
+        sf::Time timeUntilNextRedraw;
+        if (getTimeUntilNextRedraw(timeUntilNextRedraw))
+            return timeUntilNextRedraw == sf::Time();
+        else
+            return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -405,6 +442,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Gui::getTimeUntilNextRedraw(sf::Time& time) const
+    {
+        // Contents that are being pasted are passed to the widgets when the gui is drawn
+        sf::Time timeUntilClipboardUpdate;
+        const bool pasting = TGUI_Clipboard.getTimeUntilUpdate(timeUntilClipboardUpdate);
+
+        // Animations are paused while the window is unfocused
+        if (!m_Container.m_Focused || !m_Container.m_AnimatedWidget)
+        {
+            if (pasting)
+                time = timeUntilClipboardUpdate;
+
+            return pasting;
+        }
+
+        time = m_Container.getTimeUntilNextUpdate() - m_Clock.getElapsedTime();
+        if (time < sf::Time())
+            time = sf::Time();
+
+        if (pasting && (timeUntilClipboardUpdate < time))
+            time = timeUntilClipboardUpdate;
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
         m_Container.m_AnimationTimeElapsed = elapsedTime;
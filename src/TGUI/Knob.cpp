@@ -69,6 +69,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Knob::Knob(Knob&& other) :
+        Widget            (std::move(other)),
+        m_loadedConfigFile(std::move(other.m_loadedConfigFile)),
+        m_size            (other.m_size),
+        m_clockwiseTurning(other.m_clockwiseTurning),
+        m_imageRotation   (other.m_imageRotation),
+        m_startRotation   (other.m_startRotation),
+        m_endRotation     (other.m_endRotation),
+        m_minimum         (other.m_minimum),
+        m_value           (other.m_value),
+        m_maximum         (other.m_maximum)
+    {
+        // Take over the textures, the other widget will no longer release them
+        std::swap(m_backgroundTexture, other.m_backgroundTexture);
+        std::swap(m_foregroundTexture, other.m_foregroundTexture);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Knob::~Knob()
     {
         if (m_backgroundTexture.data != nullptr)  TGUI_TextureManager.removeTexture(m_backgroundTexture);
@@ -103,6 +122,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Knob& Knob::operator= (Knob&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            this->Widget::operator=(std::move(right));
+
+            std::swap(m_loadedConfigFile,  right.m_loadedConfigFile);
+            std::swap(m_backgroundTexture, right.m_backgroundTexture);
+            std::swap(m_foregroundTexture, right.m_foregroundTexture);
+            std::swap(m_size,              right.m_size);
+            std::swap(m_clockwiseTurning,  right.m_clockwiseTurning);
+            std::swap(m_imageRotation,     right.m_imageRotation);
+            std::swap(m_startRotation,     right.m_startRotation);
+            std::swap(m_endRotation,       right.m_endRotation);
+            std::swap(m_minimum,           right.m_minimum);
+            std::swap(m_value,             right.m_value);
+            std::swap(m_maximum,           right.m_maximum);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Knob* Knob::clone()
     {
         return new Knob(*this);
@@ -207,7 +251,7 @@ namespace tgui
 
     void Knob::setPosition(float x, float y)
     {
-        Transformable::setPosition(x, y);
+        Widget::setPosition(x, y);
 
         m_backgroundTexture.sprite.setPosition(x, y);
         m_foregroundTexture.sprite.setPosition(x + (m_backgroundTexture.getSize().x / 2.0f),
@@ -218,6 +262,8 @@ namespace tgui
 
     void Knob::setSize(float width, float height)
     {
+        invalidate();
+
         // Don't do anything when the knob wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -248,6 +294,8 @@ namespace tgui
 
     void Knob::setStartRotation(float startRotation)
     {
+        invalidate();
+
         while (startRotation >= 360)
             startRotation -= 360;
         while (startRotation < 0)
@@ -263,6 +311,8 @@ namespace tgui
 
     void Knob::setEndRotation(float endRotation)
     {
+        invalidate();
+
         while (endRotation >= 360)
             endRotation -= 360;
         while (endRotation < 0)
@@ -278,6 +328,8 @@ namespace tgui
 
     void Knob::setMinimum(int minimum)
     {
+        invalidate();
+
         if (m_minimum != minimum)
         {
             // Set the new minimum
@@ -300,6 +352,8 @@ namespace tgui
 
     void Knob::setMaximum(int maximum)
     {
+        invalidate();
+
         if (m_maximum != maximum)
         {
             // Set the new maximum
@@ -325,6 +379,8 @@ namespace tgui
 
     void Knob::setValue(int value)
     {
+        invalidate();
+
         if (m_value != value)
         {
             // Set the new value
@@ -374,6 +430,8 @@ namespace tgui
 
     void Knob::setClockwiseTurning(bool clockwise)
     {
+        invalidate();
+
         m_clockwiseTurning = clockwise;
 
         // The knob might have to point in a different direction even though it has the same value
@@ -391,6 +449,8 @@ namespace tgui
 
     void Knob::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         m_backgroundTexture.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
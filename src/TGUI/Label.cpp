@@ -37,7 +37,12 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Label::Label() :
-    m_AutoSize(true)
+    m_Font     (nullptr),
+    m_TextSize (30),
+    m_TextStyle(sf::Text::Regular),
+    m_TextColor(sf::Color::White),
+    m_Vertices (sf::Quads),
+    m_AutoSize (true)
     {
         m_Callback.widgetType = Type_Label;
         m_Loaded = true;
@@ -116,6 +121,8 @@ namespace tgui
 
     void Label::setSize(float width, float height)
     {
+        invalidate();
+
         // A negative size is not allowed for this object
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -134,9 +141,9 @@ namespace tgui
 
     void Label::setPosition(float x, float y)
     {
-        Transformable::setPosition(x, y);
+        Widget::setPosition(x, y);
 
-        m_Text.setPosition(std::floor(x - m_Text.getLocalBounds().left + 0.5f), std::floor(y - m_Text.getLocalBounds().top + 0.5f));
+        m_TextPosition = sf::Vector2f(std::floor(x - m_TextBounds.left + 0.5f), std::floor(y - m_TextBounds.top + 0.5f));
         m_Background.setPosition(x, y);
     }
 
@@ -144,95 +151,109 @@ namespace tgui
 
     void Label::setText(const sf::String& string)
     {
-        m_Text.setString(string);
+        // Nothing has to be done when the text didn't change
+        if (string == m_String)
+            return;
 
-        setPosition(getPosition());
+        invalidate();
 
-        // Change the size of the label if necessary
-        if (m_AutoSize)
+        // Try to only replace the characters that changed, rebuild everything when this isn't possible
+        if (!updateChangedCharacters(string))
         {
-            m_Size = sf::Vector2f(m_Text.getLocalBounds().width, m_Text.getLocalBounds().height);
-            m_Background.setSize(m_Size);
+            m_String = string;
+            updateGeometry();
         }
+
+        updateTextBounds();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::String& Label::getText() const
     {
-        return m_Text.getString();
+        return m_String;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Label::setTextFont(const sf::Font& font)
     {
-        m_Text.setFont(font);
-        setText(getText());
+        invalidate();
+
+        m_Font = &font;
+        updateGeometry();
+        updateTextBounds();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::Font* Label::getTextFont() const
     {
-        return m_Text.getFont();
+        return m_Font;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Label::setTextColor(const sf::Color& color)
     {
-        m_Text.setColor(color);
+        invalidate();
+
+        m_TextColor = color;
+
+        // Only the color of the vertices has to change
+        for (unsigned int i = 0; i < m_Vertices.getVertexCount(); ++i)
+            m_Vertices[i].color = color;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::Color& Label::getTextColor() const
     {
-        return m_Text.getColor();
+        return m_TextColor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Label::setTextStyle(sf::Uint32 style)
     {
-        m_Text.setStyle(style);
+        invalidate();
+
+        m_TextStyle = style;
+        updateGeometry();
+        updateTextBounds();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::Uint32 Label::getTextStyle() const
     {
-        return m_Text.getStyle();
+        return m_TextStyle;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Label::setTextSize(unsigned int size)
     {
-        m_Text.setCharacterSize(size);
-
-        setPosition(getPosition());
+        invalidate();
 
-        // Change the size of the label if necessary
-        if (m_AutoSize)
-        {
-            m_Size = sf::Vector2f(m_Text.getLocalBounds().width, m_Text.getLocalBounds().height);
-            m_Background.setSize(m_Size);
-        }
+        m_TextSize = size;
+        updateGeometry();
+        updateTextBounds();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int Label::getTextSize() const
     {
-        return m_Text.getCharacterSize();
+        return m_TextSize;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Label::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_Background.setFillColor(backgroundColor);
     }
 
@@ -247,12 +268,14 @@ namespace tgui
 
     void Label::setAutoSize(bool autoSize)
     {
+        invalidate();
+
         m_AutoSize = autoSize;
 
         // Change the size of the label if necessary
         if (m_AutoSize)
         {
-            m_Size = sf::Vector2f(m_Text.getLocalBounds().width, m_Text.getLocalBounds().height);
+            m_Size = sf::Vector2f(m_TextBounds.width, m_TextBounds.height);
             m_Background.setSize(m_Size);
         }
     }
@@ -357,12 +380,225 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Label::updateGeometry()
+    {
+        m_Vertices.clear();
+        m_CharacterVertices.clear();
+        m_CharacterPositions.clear();
+
+        m_WhitespaceMin = sf::Vector2f(static_cast<float>(m_TextSize), static_cast<float>(m_TextSize));
+        m_WhitespaceMax = sf::Vector2f(0, 0);
+
+        if ((m_Font == nullptr) || m_String.isEmpty())
+            return;
+
+        m_CharacterVertices.reserve(m_String.getSize());
+        m_CharacterPositions.reserve(m_String.getSize());
+
+        // The layout is identical to the one of sf::Text
+        bool  bold               = (m_TextStyle & sf::Text::Bold) != 0;
+        bool  underlined         = (m_TextStyle & sf::Text::Underlined) != 0;
+        float underlineOffset    = m_TextSize * 0.1f;
+        float underlineThickness = m_TextSize * (bold ? 0.1f : 0.07f);
+
+        float hspace = static_cast<float>(m_Font->getGlyph(L' ', m_TextSize, bold).advance);
+        float vspace = static_cast<float>(m_Font->getLineSpacing(m_TextSize));
+
+        sf::Vector2f position(0, static_cast<float>(m_TextSize));
+        sf::Uint32 prevChar = 0;
+        for (unsigned int i = 0; i < m_String.getSize(); ++i)
+        {
+            sf::Uint32 curChar = m_String[i];
+
+            // Apply the kerning offset
+            position.x += static_cast<float>(m_Font->getKerning(prevChar, curChar, m_TextSize));
+            prevChar = curChar;
+
+            // Draw the underline of the line that ends here
+            if (underlined && (curChar == L'\n'))
+            {
+                float top = position.y + underlineOffset;
+                float bottom = top + underlineThickness;
+
+                m_Vertices.append(sf::Vertex(sf::Vector2f(0, top), m_TextColor, sf::Vector2f(1, 1)));
+                m_Vertices.append(sf::Vertex(sf::Vector2f(position.x, top), m_TextColor, sf::Vector2f(1, 1)));
+                m_Vertices.append(sf::Vertex(sf::Vector2f(position.x, bottom), m_TextColor, sf::Vector2f(1, 1)));
+                m_Vertices.append(sf::Vertex(sf::Vector2f(0, bottom), m_TextColor, sf::Vector2f(1, 1)));
+            }
+
+            m_CharacterPositions.push_back(position);
+
+            // Whitespace characters don't have a quad, they only move the pen
+            if ((curChar == L' ') || (curChar == L'\t') || (curChar == L'\n') || (curChar == L'\v'))
+            {
+                m_CharacterVertices.push_back(-1);
+
+                m_WhitespaceMin.x = TGUI_MINIMUM(m_WhitespaceMin.x, position.x);
+                m_WhitespaceMin.y = TGUI_MINIMUM(m_WhitespaceMin.y, position.y);
+
+                switch (curChar)
+                {
+                    case L' ':  position.x += hspace;                 break;
+                    case L'\t': position.x += hspace * 4;             break;
+                    case L'\n': position.y += vspace; position.x = 0; break;
+                    case L'\v': position.y += vspace * 4;             break;
+                }
+
+                m_WhitespaceMax.x = TGUI_MAXIMUM(m_WhitespaceMax.x, position.x);
+                m_WhitespaceMax.y = TGUI_MAXIMUM(m_WhitespaceMax.y, position.y);
+                continue;
+            }
+
+            const sf::Glyph& glyph = m_Font->getGlyph(curChar, m_TextSize, bold);
+
+            m_CharacterVertices.push_back(static_cast<int>(m_Vertices.getVertexCount()));
+            m_Vertices.resize(m_Vertices.getVertexCount() + 4);
+            setCharacterQuad(m_CharacterVertices.back(), glyph, position);
+
+            position.x += static_cast<float>(glyph.advance);
+        }
+
+        // Draw the underline of the last line
+        if (underlined)
+        {
+            float top = position.y + underlineOffset;
+            float bottom = top + underlineThickness;
+
+            m_Vertices.append(sf::Vertex(sf::Vector2f(0, top), m_TextColor, sf::Vector2f(1, 1)));
+            m_Vertices.append(sf::Vertex(sf::Vector2f(position.x, top), m_TextColor, sf::Vector2f(1, 1)));
+            m_Vertices.append(sf::Vertex(sf::Vector2f(position.x, bottom), m_TextColor, sf::Vector2f(1, 1)));
+            m_Vertices.append(sf::Vertex(sf::Vector2f(0, bottom), m_TextColor, sf::Vector2f(1, 1)));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Label::updateChangedCharacters(const sf::String& string)
+    {
+        if ((m_Font == nullptr) || (string.getSize() != m_String.getSize()) || (m_CharacterVertices.size() != m_String.getSize()))
+            return false;
+
+        bool bold = (m_TextStyle & sf::Text::Bold) != 0;
+
+        // Check that every changed character can simply be replaced by the new one
+        bool changed = false;
+        for (unsigned int i = 0; i < string.getSize(); ++i)
+        {
+            bool characterChanged = (string[i] != m_String[i]);
+            bool previousCharacterChanged = (i > 0) && (string[i-1] != m_String[i-1]);
+
+            if (characterChanged)
+            {
+                // Whitespace characters have no quad and a newline would change the layout of the whole line
+                if (m_CharacterVertices[i] < 0)
+                    return false;
+                if ((string[i] == L' ') || (string[i] == L'\t') || (string[i] == L'\n') || (string[i] == L'\v'))
+                    return false;
+
+                // The next characters should not move
+                if (m_Font->getGlyph(string[i], m_TextSize, bold).advance != m_Font->getGlyph(m_String[i], m_TextSize, bold).advance)
+                    return false;
+
+                changed = true;
+            }
+
+            // The kerning between the character and the one in front of it should remain the same as well
+            if (characterChanged || previousCharacterChanged)
+            {
+                sf::Uint32 oldPrevChar = (i > 0) ? m_String[i-1] : 0;
+                sf::Uint32 newPrevChar = (i > 0) ? string[i-1] : 0;
+                if (m_Font->getKerning(oldPrevChar, m_String[i], m_TextSize) != m_Font->getKerning(newPrevChar, string[i], m_TextSize))
+                    return false;
+            }
+        }
+
+        if (!changed)
+            return false;
+
+        // Only replace the quads of the characters that changed
+        for (unsigned int i = 0; i < string.getSize(); ++i)
+        {
+            if (string[i] != m_String[i])
+                setCharacterQuad(m_CharacterVertices[i], m_Font->getGlyph(string[i], m_TextSize, bold), m_CharacterPositions[i]);
+        }
+
+        m_String = string;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Label::setCharacterQuad(unsigned int vertexIndex, const sf::Glyph& glyph, const sf::Vector2f& position)
+    {
+        float italic = (m_TextStyle & sf::Text::Italic) ? 0.208f : 0.f; // 12 degrees
+
+        float left   = static_cast<float>(glyph.bounds.left);
+        float top    = static_cast<float>(glyph.bounds.top);
+        float right  = static_cast<float>(glyph.bounds.left + glyph.bounds.width);
+        float bottom = static_cast<float>(glyph.bounds.top + glyph.bounds.height);
+
+        float u1 = static_cast<float>(glyph.textureRect.left);
+        float v1 = static_cast<float>(glyph.textureRect.top);
+        float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width);
+        float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height);
+
+        m_Vertices[vertexIndex]   = sf::Vertex(sf::Vector2f(position.x + left  - italic * top,    position.y + top),    m_TextColor, sf::Vector2f(u1, v1));
+        m_Vertices[vertexIndex+1] = sf::Vertex(sf::Vector2f(position.x + right - italic * top,    position.y + top),    m_TextColor, sf::Vector2f(u2, v1));
+        m_Vertices[vertexIndex+2] = sf::Vertex(sf::Vector2f(position.x + right - italic * bottom, position.y + bottom), m_TextColor, sf::Vector2f(u2, v2));
+        m_Vertices[vertexIndex+3] = sf::Vertex(sf::Vector2f(position.x + left  - italic * bottom, position.y + bottom), m_TextColor, sf::Vector2f(u1, v2));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Label::updateTextBounds()
+    {
+        if (m_CharacterVertices.empty())
+            m_TextBounds = sf::FloatRect();
+        else
+        {
+            // The bounds are formed by the whitespace and the quads of the other characters (the underline is not included)
+            sf::Vector2f minimum = m_WhitespaceMin;
+            sf::Vector2f maximum = m_WhitespaceMax;
+            for (unsigned int i = 0; i < m_CharacterVertices.size(); ++i)
+            {
+                if (m_CharacterVertices[i] < 0)
+                    continue;
+
+                for (int j = m_CharacterVertices[i]; j < m_CharacterVertices[i] + 4; ++j)
+                {
+                    minimum.x = TGUI_MINIMUM(minimum.x, m_Vertices[j].position.x);
+                    minimum.y = TGUI_MINIMUM(minimum.y, m_Vertices[j].position.y);
+                    maximum.x = TGUI_MAXIMUM(maximum.x, m_Vertices[j].position.x);
+                    maximum.y = TGUI_MAXIMUM(maximum.y, m_Vertices[j].position.y);
+                }
+            }
+
+            m_TextBounds = sf::FloatRect(minimum.x, minimum.y, maximum.x - minimum.x, maximum.y - minimum.y);
+        }
+
+        setPosition(getPosition());
+
+        // Change the size of the label if necessary
+        if (m_AutoSize)
+        {
+            m_Size = sf::Vector2f(m_TextBounds.width, m_TextBounds.height);
+            m_Background.setSize(m_Size);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         // When there is no text then there is nothing to draw
-        if (m_Text.getString().isEmpty())
+        if (m_String.isEmpty() || (m_Font == nullptr))
             return;
 
+        // The quads of the text are positioned relative to the text position and use the texture of the font
+        sf::RenderStates textStates = states;
+        textStates.transform.translate(m_TextPosition);
+        textStates.texture = &m_Font->getTexture(m_TextSize);
+
         if (m_AutoSize)
         {
             // Draw the background
@@ -370,7 +606,7 @@ namespace tgui
                 target.draw(m_Background, states);
 
             // Draw the text
-            target.draw(m_Text, states);
+            target.draw(m_Vertices, textStates);
         }
         else
         {
@@ -410,7 +646,7 @@ namespace tgui
                 target.draw(m_Background, states);
 
             // Draw the text
-            target.draw(m_Text, states);
+            target.draw(m_Vertices, textStates);
 
             // Reset the old clipping area
             glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
@@ -24,6 +24,9 @@
 
 
 #include <cmath>
+#include <cassert>
+#include <limits>
+#include <iterator>
 #include <algorithm>
 
 #include <SFML/OpenGL.hpp>
@@ -39,13 +42,19 @@ namespace tgui
    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ListBox::ListBox() :
-    m_SelectedItem(-1),
-    m_Size        (50, 100),
-    m_ItemHeight  (24),
-    m_TextSize    (19),
-    m_MaxItems    (0),
-    m_Scroll      (nullptr),
-    m_TextFont    (nullptr)
+    m_Sorted                (false),
+    m_ItemIdIndexNeedsUpdate(false),
+    m_Filtered              (false),
+    m_TypeAheadRow          (0),
+    m_Model                 (nullptr),
+    m_ModelItemCount        (0),
+    m_SelectedItem          (-1),
+    m_Size                  (50, 100),
+    m_ItemHeight            (24),
+    m_TextSize              (19),
+    m_MaxItems              (0),
+    m_Scroll                (nullptr),
+    m_TextFont              (nullptr)
     {
         m_Callback.widgetType = Type_ListBox;
         m_DraggableWidget = true;
@@ -62,6 +71,16 @@ namespace tgui
     m_LoadedConfigFile       (copy.m_LoadedConfigFile),
     m_Items                  (copy.m_Items),
     m_ItemIds                (copy.m_ItemIds),
+    m_Sorted                 (copy.m_Sorted),
+    m_ItemIdIndex            (copy.m_ItemIdIndex),
+    m_ItemIdIndexNeedsUpdate (copy.m_ItemIdIndexNeedsUpdate),
+    m_Filtered               (copy.m_Filtered),
+    m_FilterFunction         (copy.m_FilterFunction),
+    m_FilterPrefix           (copy.m_FilterPrefix),
+    m_FilteredItems          (copy.m_FilteredItems),
+    m_TypeAheadRow           (0),
+    m_Model                  (copy.m_Model),
+    m_ModelItemCount         (copy.m_ModelItemCount),
     m_SelectedItem           (copy.m_SelectedItem),
     m_Size                   (copy.m_Size),
     m_ItemHeight             (copy.m_ItemHeight),
@@ -83,6 +102,41 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ListBox::ListBox(ListBox&& other) :
+    Widget                   (std::move(other)),
+    WidgetBorders            (other),
+    m_LoadedConfigFile       (std::move(other.m_LoadedConfigFile)),
+    m_Items                  (std::move(other.m_Items)),
+    m_ItemIds                (std::move(other.m_ItemIds)),
+    m_Sorted                 (other.m_Sorted),
+    m_ItemIdIndex            (std::move(other.m_ItemIdIndex)),
+    m_ItemIdIndexNeedsUpdate (other.m_ItemIdIndexNeedsUpdate),
+    m_Filtered               (other.m_Filtered),
+    m_FilterFunction         (std::move(other.m_FilterFunction)),
+    m_FilterPrefix           (std::move(other.m_FilterPrefix)),
+    m_FilteredItems          (std::move(other.m_FilteredItems)),
+    m_TypeAheadRow           (0),
+    m_Model                  (other.m_Model),
+    m_ModelItemCount         (other.m_ModelItemCount),
+    m_SelectedItem           (other.m_SelectedItem),
+    m_Size                   (other.m_Size),
+    m_ItemHeight             (other.m_ItemHeight),
+    m_TextSize               (other.m_TextSize),
+    m_MaxItems               (other.m_MaxItems),
+    m_BackgroundColor        (other.m_BackgroundColor),
+    m_TextColor              (other.m_TextColor),
+    m_SelectedBackgroundColor(other.m_SelectedBackgroundColor),
+    m_SelectedTextColor      (other.m_SelectedTextColor),
+    m_BorderColor            (other.m_BorderColor),
+    m_TextFont               (other.m_TextFont)
+    {
+        // Take over the scrollbar
+        m_Scroll = other.m_Scroll;
+        other.m_Scroll = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ListBox::~ListBox()
     {
         if (m_Scroll != nullptr)
@@ -109,6 +163,18 @@ namespace tgui
             std::swap(m_LoadedConfigFile,        temp.m_LoadedConfigFile);
             std::swap(m_Items,                   temp.m_Items);
             std::swap(m_ItemIds,                 temp.m_ItemIds);
+            std::swap(m_Sorted,                  temp.m_Sorted);
+            std::swap(m_ItemIdIndex,             temp.m_ItemIdIndex);
+            std::swap(m_ItemIdIndexNeedsUpdate,  temp.m_ItemIdIndexNeedsUpdate);
+            std::swap(m_Filtered,                temp.m_Filtered);
+            std::swap(m_FilterFunction,          temp.m_FilterFunction);
+            std::swap(m_FilterPrefix,            temp.m_FilterPrefix);
+            std::swap(m_FilteredItems,           temp.m_FilteredItems);
+            std::swap(m_TypeAheadText,           temp.m_TypeAheadText);
+            std::swap(m_TypeAheadRow,            temp.m_TypeAheadRow);
+            std::swap(m_Model,                   temp.m_Model);
+            std::swap(m_ModelItemCount,          temp.m_ModelItemCount);
+            std::swap(m_ModelPages,              temp.m_ModelPages);
             std::swap(m_SelectedItem,            temp.m_SelectedItem);
             std::swap(m_Size,                    temp.m_Size);
             std::swap(m_ItemHeight,              temp.m_ItemHeight);
@@ -128,6 +194,47 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ListBox& ListBox::operator= (ListBox&& right)
+    {
+        if (this != &right)
+        {
+            this->Widget::operator=(std::move(right));
+            this->WidgetBorders::operator=(right);
+
+            std::swap(m_LoadedConfigFile,        right.m_LoadedConfigFile);
+            std::swap(m_Items,                   right.m_Items);
+            std::swap(m_ItemIds,                 right.m_ItemIds);
+            std::swap(m_Sorted,                  right.m_Sorted);
+            std::swap(m_ItemIdIndex,             right.m_ItemIdIndex);
+            std::swap(m_ItemIdIndexNeedsUpdate,  right.m_ItemIdIndexNeedsUpdate);
+            std::swap(m_Filtered,                right.m_Filtered);
+            std::swap(m_FilterFunction,          right.m_FilterFunction);
+            std::swap(m_FilterPrefix,            right.m_FilterPrefix);
+            std::swap(m_FilteredItems,           right.m_FilteredItems);
+            std::swap(m_TypeAheadText,           right.m_TypeAheadText);
+            std::swap(m_TypeAheadRow,            right.m_TypeAheadRow);
+            std::swap(m_Model,                   right.m_Model);
+            std::swap(m_ModelItemCount,          right.m_ModelItemCount);
+            std::swap(m_ModelPages,              right.m_ModelPages);
+            std::swap(m_SelectedItem,            right.m_SelectedItem);
+            std::swap(m_Size,                    right.m_Size);
+            std::swap(m_ItemHeight,              right.m_ItemHeight);
+            std::swap(m_TextSize,                right.m_TextSize);
+            std::swap(m_MaxItems,                right.m_MaxItems);
+            std::swap(m_Scroll,                  right.m_Scroll);
+            std::swap(m_BackgroundColor,         right.m_BackgroundColor);
+            std::swap(m_TextColor,               right.m_TextColor);
+            std::swap(m_SelectedBackgroundColor, right.m_SelectedBackgroundColor);
+            std::swap(m_SelectedTextColor,       right.m_SelectedTextColor);
+            std::swap(m_BorderColor,             right.m_BorderColor);
+            std::swap(m_TextFont,                right.m_TextFont);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ListBox* ListBox::clone()
     {
         return new ListBox(*this);
@@ -228,7 +335,7 @@ namespace tgui
                     m_Scroll->setVerticalScroll(true);
                     m_Scroll->setSize(m_Scroll->getSize().x, static_cast<float>(m_Size.y));
                     m_Scroll->setLowValue(m_Size.y);
-                    m_Scroll->setMaximum(m_Items.size() * m_ItemHeight);
+                    m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
                 }
             }
             else
@@ -249,6 +356,8 @@ namespace tgui
 
     void ListBox::setSize(float width, float height)
     {
+        invalidate();
+
         // A negative size is not allowed for this widget
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -307,6 +416,8 @@ namespace tgui
 
     void ListBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_BackgroundColor = backgroundColor;
     }
 
@@ -314,6 +425,8 @@ namespace tgui
 
     void ListBox::setTextColor(const sf::Color& textColor)
     {
+        invalidate();
+
         m_TextColor = textColor;
     }
 
@@ -321,6 +434,8 @@ namespace tgui
 
     void ListBox::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
     {
+        invalidate();
+
         m_SelectedBackgroundColor = selectedBackgroundColor;
     }
 
@@ -328,6 +443,8 @@ namespace tgui
 
     void ListBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
+        invalidate();
+
         m_SelectedTextColor = selectedTextColor;
     }
 
@@ -335,6 +452,8 @@ namespace tgui
 
     void ListBox::setBorderColor(const sf::Color& borderColor)
     {
+        invalidate();
+
         m_BorderColor = borderColor;
     }
 
@@ -377,6 +496,8 @@ namespace tgui
 
     void ListBox::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_TextFont = &font;
     }
 
@@ -391,70 +512,156 @@ namespace tgui
 
     int ListBox::addItem(const sf::String& itemName, int id)
     {
-        // Check if the item limit is reached (if there is one)
-        if ((m_MaxItems == 0) || (m_Items.size() < m_MaxItems))
+        invalidate();
+
+        // Items can't be added when they are provided by a model
+        if (m_Model != nullptr)
+            return -1;
+
+        // Check if the item limit is reached
+        if (m_Items.size() >= getItemLimit())
+            return -1;
+
+        unsigned int index;
+        if (m_Sorted)
         {
-            // If there is no scrollbar then there is another limit
-            if (m_Scroll == nullptr)
-            {
-                // Calculate the amount of items that fit in the list box
-                unsigned int maximumItems = m_Size.y / m_ItemHeight;
+            // Insert the item behind the items with the same name, so that they stay in the order in which they were added
+            index = std::upper_bound(m_Items.begin(), m_Items.end(), itemName) - m_Items.begin();
 
-                // Check if the item still fits in the list box
-                if (m_Items.size() == maximumItems)
-                    return -1;
-            }
+            m_Items.insert(m_Items.begin() + index, itemName);
+            m_ItemIds.insert(m_ItemIds.begin() + index, id);
+
+            if (m_SelectedItem >= static_cast<int>(index))
+                ++m_SelectedItem;
+        }
+        else // Add the item to the end of the list
+        {
+            index = m_Items.size();
 
-            // Add the item to the list
             m_Items.push_back(itemName);
             m_ItemIds.push_back(id);
+        }
 
-            // If there is a scrollbar then tell it that another item was added
-            if (m_Scroll != nullptr)
-                m_Scroll->setMaximum(m_Items.size() * m_ItemHeight);
+        // The indices of the other items only change when the item wasn't added at the end
+        if (index + 1 < m_Items.size())
+            m_ItemIdIndexNeedsUpdate = true;
+        else if (!m_ItemIdIndexNeedsUpdate)
+            m_ItemIdIndex[id].push_back(index);
 
-            // Return the item index
-            return m_Items.size() - 1;
-        }
-        else // The item limit was reached
-            return -1;
+        if (m_Filtered)
+            filterItem(index, true);
+
+        // If there is a scrollbar then tell it that another item was added
+        if (m_Scroll != nullptr)
+            m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
+
+        // Return the item index
+        return index;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ListBox::setSelectedItem(const sf::String& itemName)
+    unsigned int ListBox::setItems(std::vector<sf::String> itemNames, std::vector<int> ids)
     {
-        // Loop through all items
-        for (unsigned int i = 0; i < m_Items.size(); ++i)
+        if (m_Model != nullptr)
+            return 0;
+
+        // Remove the old items without already updating the scrollbar, addItems will do that
+        m_Items.clear();
+        m_ItemIds.clear();
+        m_ItemIdIndex.clear();
+        m_ItemIdIndexNeedsUpdate = false;
+        m_FilteredItems.clear();
+        m_SelectedItem = -1;
+
+        return addItems(std::move(itemNames), std::move(ids));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListBox::addItems(std::vector<sf::String> itemNames, std::vector<int> ids)
+    {
+        invalidate();
+
+        if (m_Model != nullptr)
+            return 0;
+
+        // Drop the items that no longer fit in the list box
+        const unsigned int limit = getItemLimit();
+        if (m_Items.size() >= limit)
+            return 0;
+        else if (itemNames.size() > limit - m_Items.size())
+            itemNames.erase(itemNames.begin() + (limit - m_Items.size()), itemNames.end());
+
+        // Items for which no id was given get 0 as id
+        ids.resize(itemNames.size(), 0);
+
+        const unsigned int firstNewItem = m_Items.size();
+        if (m_Items.empty())
         {
-            // Check if a match was found
-            if (m_Items[i] == itemName)
+            m_Items = std::move(itemNames);
+            m_ItemIds = std::move(ids);
+        }
+        else
+        {
+            m_Items.insert(m_Items.end(), std::make_move_iterator(itemNames.begin()), std::make_move_iterator(itemNames.end()));
+            m_ItemIds.insert(m_ItemIds.end(), ids.begin(), ids.end());
+        }
+
+        if (m_Sorted)
+        {
+            sortItems(firstNewItem);
+        }
+        else
+        {
+            if (!m_ItemIdIndexNeedsUpdate)
             {
-                // Select the item
-                m_SelectedItem = static_cast<int>(i);
+                for (unsigned int i = firstNewItem; i < m_ItemIds.size(); ++i)
+                    m_ItemIdIndex[m_ItemIds[i]].push_back(i);
+            }
 
-                // Move the scrollbar if needed
-                if (m_Scroll)
+            // Only the new items have to be checked against the filter
+            if (m_Filtered)
+            {
+                for (unsigned int i = firstNewItem; i < m_Items.size(); ++i)
                 {
-                    if (m_SelectedItem * getItemHeight() < m_Scroll->getValue())
-                        m_Scroll->setValue(m_SelectedItem * getItemHeight());
-                    else if ((m_SelectedItem + 1) * getItemHeight() > m_Scroll->getValue() + m_Scroll->getLowValue())
-                        m_Scroll->setValue((m_SelectedItem + 1) * getItemHeight() - m_Scroll->getLowValue());
+                    if (passesFilter(m_Items[i]))
+                        m_FilteredItems.push_back(i);
                 }
-
-                return true;
             }
         }
 
+        // The scrollbar only has to be told once about all the new items
+        if (m_Scroll != nullptr)
+            m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
+
+        return m_Items.size() - firstNewItem;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::setSelectedItem(const sf::String& itemName)
+    {
+        invalidate();
+
+        int index = getItemIndex(itemName);
+
         // No match was found
-        m_SelectedItem = -1;
-        return false;
+        if (index == -1)
+        {
+            m_SelectedItem = -1;
+            return false;
+        }
+
+        return setSelectedItem(index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::setSelectedItem(int index)
     {
+        invalidate();
+
         if (index < 0)
         {
             deselectItem();
@@ -462,7 +669,7 @@ namespace tgui
         }
 
         // If the index is too high then deselect the items
-        if (index > int(m_Items.size()-1))
+        if (index > static_cast<int>(getItemCount())-1)
         {
             m_SelectedItem = -1;
             return false;
@@ -471,13 +678,14 @@ namespace tgui
         // Select the item
         m_SelectedItem = index;
 
-        // Move the scrollbar if needed
-        if (m_Scroll)
+        // Move the scrollbar if needed (unless the item is hidden by the filter)
+        int row = getRowOfItem(index);
+        if ((m_Scroll) && (row >= 0))
         {
-            if (m_SelectedItem * getItemHeight() < m_Scroll->getValue())
-                m_Scroll->setValue(m_SelectedItem * getItemHeight());
-            else if ((m_SelectedItem + 1) * getItemHeight() > m_Scroll->getValue() + m_Scroll->getLowValue())
-                m_Scroll->setValue((m_SelectedItem + 1) * getItemHeight() - m_Scroll->getLowValue());
+            if (row * getItemHeight() < m_Scroll->getValue())
+                m_Scroll->setValue(row * getItemHeight());
+            else if ((row + 1) * getItemHeight() > m_Scroll->getValue() + m_Scroll->getLowValue())
+                m_Scroll->setValue((row + 1) * getItemHeight() - m_Scroll->getLowValue());
         }
 
         return true;
@@ -485,8 +693,41 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListBox::setSelectedItemById(int id)
+    {
+        invalidate();
+
+        // The ids of the items in a model are not indexed, so they have to be searched one by one
+        if (m_Model != nullptr)
+        {
+            for (unsigned int i = 0; i < m_ModelItemCount; ++i)
+            {
+                if (getItemIdAt(i) == id)
+                    return setSelectedItem(static_cast<int>(i));
+            }
+
+            m_SelectedItem = -1;
+            return false;
+        }
+
+        updateItemIdIndex();
+
+        auto it = m_ItemIdIndex.find(id);
+        if (it == m_ItemIdIndex.end())
+        {
+            m_SelectedItem = -1;
+            return false;
+        }
+
+        return setSelectedItem(static_cast<int>(it->second.front()));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::deselectItem()
     {
+        invalidate();
+
         m_SelectedItem = -1;
     }
 
@@ -494,6 +735,12 @@ namespace tgui
 
     bool ListBox::removeItem(unsigned int index)
     {
+        invalidate();
+
+        // Items can't be removed when they are provided by a model
+        if (m_Model != nullptr)
+            return false;
+
         // The index can't be too high
         if (index > m_Items.size()-1)
             return false;
@@ -501,10 +748,22 @@ namespace tgui
         // Remove the item
         m_Items.erase(m_Items.begin() + index);
         m_ItemIds.erase(m_ItemIds.begin() + index);
+        m_ItemIdIndexNeedsUpdate = true;
+
+        // Remove the item from the filtered items and shift the indices of the items behind it
+        if (m_Filtered)
+        {
+            auto it = std::lower_bound(m_FilteredItems.begin(), m_FilteredItems.end(), index);
+            if ((it != m_FilteredItems.end()) && (*it == index))
+                it = m_FilteredItems.erase(it);
+
+            for (; it != m_FilteredItems.end(); ++it)
+                --*it;
+        }
 
         // If there is a scrollbar then tell it that an item was removed
         if (m_Scroll != nullptr)
-            m_Scroll->setMaximum(m_Items.size() * m_ItemHeight);
+            m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
 
         // Check if the selected item should change
         if (m_SelectedItem == static_cast<int>(index))
@@ -519,51 +778,59 @@ namespace tgui
 
     bool ListBox::removeItem(const sf::String& itemName)
     {
-        // Loop through all items
-        for (unsigned int i = 0; i < m_Items.size(); ++i)
-        {
-            // When the name matches then delete the item
-            if (m_Items[i] == itemName)
-            {
-                m_Items.erase(m_Items.begin() + i);
-                m_ItemIds.erase(m_ItemIds.begin() + i);
-
-                // Check if the selected item should change
-                if (m_SelectedItem == static_cast<int>(i))
-                    m_SelectedItem = -1;
-                else if (m_SelectedItem > static_cast<int>(i))
-                    --m_SelectedItem;
-
-                // If there is a scrollbar then tell it that an item was removed
-                if (m_Scroll != nullptr)
-                    m_Scroll->setMaximum(m_Items.size() * m_ItemHeight);
-
-                return true;
-            }
-        }
+        int index = getItemIndex(itemName);
+        if (index == -1)
+            return false;
 
-        return false;
+        return removeItem(static_cast<unsigned int>(index));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int ListBox::removeItemsById(int id)
     {
-        unsigned int removedItems = 0;
+        invalidate();
 
-        for (unsigned int i = 0; i < m_Items.size();)
+        if (m_Model != nullptr)
+            return 0;
+
+        updateItemIdIndex();
+
+        auto it = m_ItemIdIndex.find(id);
+        if (it == m_ItemIdIndex.end())
+            return 0;
+
+        // Move the remaining items forward in a single pass instead of erasing the items one by one
+        const unsigned int firstRemovedItem = it->second.front();
+        int selectedItem = (m_SelectedItem < static_cast<int>(firstRemovedItem)) ? m_SelectedItem : -1;
+        unsigned int newSize = firstRemovedItem;
+        for (unsigned int i = firstRemovedItem + 1; i < m_Items.size(); ++i)
         {
-            if (m_ItemIds[i] == id)
+            if (m_ItemIds[i] != id)
             {
-                m_Items.erase(m_Items.begin() + i);
-                m_ItemIds.erase(m_ItemIds.begin() + i);
+                if (m_SelectedItem == static_cast<int>(i))
+                    selectedItem = static_cast<int>(newSize);
 
-                removedItems++;
+                m_Items[newSize] = std::move(m_Items[i]);
+                m_ItemIds[newSize] = m_ItemIds[i];
+                ++newSize;
             }
-            else
-                ++i;
         }
 
+        const unsigned int removedItems = m_Items.size() - newSize;
+        m_Items.erase(m_Items.begin() + newSize, m_Items.end());
+        m_ItemIds.erase(m_ItemIds.begin() + newSize, m_ItemIds.end());
+        m_ItemIdIndexNeedsUpdate = true;
+
+        m_SelectedItem = selectedItem;
+
+        if (m_Filtered)
+            applyFilter();
+
+        // If there is a scrollbar then tell it that items were removed
+        if (m_Scroll != nullptr)
+            m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
+
         return removedItems;
     }
 
@@ -571,9 +838,17 @@ namespace tgui
 
     void ListBox::removeAllItems()
     {
+        invalidate();
+
+        if (m_Model != nullptr)
+            return;
+
         // Clear the list, remove all items
         m_Items.clear();
         m_ItemIds.clear();
+        m_ItemIdIndex.clear();
+        m_ItemIdIndexNeedsUpdate = false;
+        m_FilteredItems.clear();
 
         // Unselect any selected item
         m_SelectedItem = -1;
@@ -588,22 +863,33 @@ namespace tgui
     sf::String ListBox::getItem(unsigned int index) const
     {
         // The index can't be too high
-        if (index > m_Items.size()-1)
+        if (index >= getItemCount())
             return "";
 
         // Return the item
-        return m_Items[index];
+        return getItemName(index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     int ListBox::getItemIndex(const sf::String& itemName) const
     {
+        // Sorted items can be found with a binary search
+        if ((m_Sorted) && (m_Model == nullptr))
+        {
+            auto it = std::lower_bound(m_Items.begin(), m_Items.end(), itemName);
+            if ((it != m_Items.end()) && (*it == itemName))
+                return it - m_Items.begin();
+            else
+                return -1;
+        }
+
         // Loop through all items
-        for (unsigned int i = 0; i < m_Items.size(); ++i)
+        const unsigned int itemCount = getItemCount();
+        for (unsigned int i = 0; i < itemCount; ++i)
         {
             // When the name matches then return the index
-            if (m_Items[i] == itemName)
+            if (getItemName(i) == itemName)
                 return i;
         }
 
@@ -615,17 +901,30 @@ namespace tgui
 
     std::vector<sf::String>& ListBox::getItems()
     {
+        // The items of a model aren't stored in the list box
+        assert(m_Model == nullptr);
+
         return m_Items;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    unsigned int ListBox::getItemCount() const
+    {
+        if (m_Model != nullptr)
+            return m_ModelItemCount;
+        else
+            return m_Items.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     sf::String ListBox::getSelectedItem() const
     {
         if (m_SelectedItem == -1)
             return "";
         else
-            return m_Items[m_SelectedItem];
+            return getItemName(m_SelectedItem);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -642,18 +941,36 @@ namespace tgui
         if (m_SelectedItem == -1)
             return 0;
         else
-            return m_ItemIds[m_SelectedItem];
+            return getItemIdAt(m_SelectedItem);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::changeItem(unsigned int index, const sf::String& newValue)
     {
-        if (index >= m_Items.size()) {
+        invalidate();
+
+        if ((m_Model != nullptr) || (index >= m_Items.size()))
             return false;
-        }
 
         m_Items[index] = newValue;
+
+        if (m_Filtered)
+            filterItem(index, false);
+
+        // Move the item to its new place when the items are sorted
+        if (m_Sorted)
+        {
+            if ((index > 0) && (newValue < m_Items[index-1]))
+                moveItem(index, std::upper_bound(m_Items.begin(), m_Items.begin() + index, newValue) - m_Items.begin());
+            else if ((index + 1 < m_Items.size()) && (m_Items[index+1] < newValue))
+                moveItem(index, std::lower_bound(m_Items.begin() + index + 1, m_Items.end(), newValue) - m_Items.begin() - 1);
+        }
+
+        // The amount of displayed items changes when the filter now hides or shows the item
+        if ((m_Filtered) && (m_Scroll != nullptr))
+            m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
+
         return true;
     }
 
@@ -661,16 +978,44 @@ namespace tgui
 
     unsigned int ListBox::changeItems(const sf::String& originalValue, const sf::String& newValue)
     {
+        invalidate();
+
+        if (m_Model != nullptr)
+            return 0;
+
+        // When the items are sorted then all items with the same name are next to each other
+        if (m_Sorted)
+        {
+            auto range = std::equal_range(m_Items.begin(), m_Items.end(), originalValue);
+            unsigned int amountChanged = range.second - range.first;
+            if (amountChanged > 0)
+            {
+                std::fill(range.first, range.second, newValue);
+                sortItems();
+
+                if ((m_Filtered) && (m_Scroll != nullptr))
+                    m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
+            }
+
+            return amountChanged;
+        }
+
         unsigned int amountChanged = 0;
-        for (auto it = m_Items.begin(); it != m_Items.end(); ++it)
+        for (unsigned int i = 0; i < m_Items.size(); ++i)
         {
-            if (*it == originalValue)
+            if (m_Items[i] == originalValue)
             {
-                *it = newValue;
+                m_Items[i] = newValue;
                 amountChanged++;
+
+                if (m_Filtered)
+                    filterItem(i, false);
             }
         }
 
+        if ((m_Filtered) && (m_Scroll != nullptr))
+            m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
+
         return amountChanged;
     }
 
@@ -678,17 +1023,32 @@ namespace tgui
 
     unsigned int ListBox::changeItemsById(int id, const sf::String& newValue)
     {
-        unsigned int amountChanged = 0;
-        auto idIt = m_ItemIds.begin();
-        for (auto it = m_Items.begin(); it != m_Items.end(); ++it, ++idIt)
+        invalidate();
+
+        if (m_Model != nullptr)
+            return 0;
+
+        updateItemIdIndex();
+
+        auto it = m_ItemIdIndex.find(id);
+        if (it == m_ItemIdIndex.end())
+            return 0;
+
+        const unsigned int amountChanged = it->second.size();
+        for (auto indexIt = it->second.cbegin(); indexIt != it->second.cend(); ++indexIt)
         {
-            if (*idIt == id)
-            {
-                *it = newValue;
-                amountChanged++;
-            }
+            m_Items[*indexIt] = newValue;
+
+            if (m_Filtered)
+                filterItem(*indexIt, false);
         }
 
+        if (m_Sorted)
+            sortItems();
+
+        if ((m_Filtered) && (m_Scroll != nullptr))
+            m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
+
         return amountChanged;
     }
 
@@ -696,6 +1056,8 @@ namespace tgui
 
     bool ListBox::setScrollbar(const std::string& scrollbarConfigFileFilename)
     {
+        invalidate();
+
         // Calling setScrollbar with an empty string does the same as removeScrollbar
         if (scrollbarConfigFileFilename.empty() == true)
         {
@@ -723,7 +1085,7 @@ namespace tgui
             m_Scroll->setVerticalScroll(true);
             m_Scroll->setSize(m_Scroll->getSize().x, static_cast<float>(m_Size.y));
             m_Scroll->setLowValue(m_Size.y);
-            m_Scroll->setMaximum(m_Items.size() * m_ItemHeight);
+            m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
 
             return true;
         }
@@ -733,6 +1095,8 @@ namespace tgui
 
     void ListBox::removeScrollbar()
     {
+        invalidate();
+
         // Delete the scrollbar
         delete m_Scroll;
         m_Scroll = nullptr;
@@ -746,6 +1110,10 @@ namespace tgui
             // Remove the items that didn't fit inside the list box
             m_Items.erase(m_Items.begin() + m_MaxItems, m_Items.end());
             m_ItemIds.erase(m_ItemIds.begin() + m_MaxItems, m_ItemIds.end());
+            m_ItemIdIndexNeedsUpdate = true;
+
+            if (m_Filtered)
+                applyFilter();
         }
     }
 
@@ -753,6 +1121,8 @@ namespace tgui
 
     void ListBox::setItemHeight(unsigned int itemHeight)
     {
+        invalidate();
+
         // There is a minimum height
         if (itemHeight < 10)
             itemHeight = 10;
@@ -773,12 +1143,16 @@ namespace tgui
                 // Remove the items that didn't fit inside the list box
                 m_Items.erase(m_Items.begin() + m_MaxItems, m_Items.end());
                 m_ItemIds.erase(m_ItemIds.begin() + m_MaxItems, m_ItemIds.end());
+                m_ItemIdIndexNeedsUpdate = true;
+
+                if (m_Filtered)
+                    applyFilter();
             }
         }
         else // There is a scrollbar
         {
             // Set the maximum of the scrollbar
-            m_Scroll->setMaximum(m_Items.size() * m_ItemHeight);
+            m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
         }
     }
 
@@ -793,6 +1167,8 @@ namespace tgui
 
     void ListBox::setMaximumItems(unsigned int maximumItems)
     {
+        invalidate();
+
         // Set the new limit
         m_MaxItems = maximumItems;
 
@@ -802,10 +1178,14 @@ namespace tgui
             // Remove the items that passed the limitation
             m_Items.erase(m_Items.begin() + m_MaxItems, m_Items.end());
             m_ItemIds.erase(m_ItemIds.begin() + m_MaxItems, m_ItemIds.end());
+            m_ItemIdIndexNeedsUpdate = true;
+
+            if (m_Filtered)
+                applyFilter();
 
             // If there is a scrollbar then tell it that the number of items was changed
             if (m_Scroll != nullptr)
-                m_Scroll->setMaximum(m_Items.size() * m_ItemHeight);
+                m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
         }
     }
 
@@ -818,8 +1198,153 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListBox::setSorted(bool sorted)
+    {
+        invalidate();
+
+        if (sorted && !m_Sorted)
+            sortItems();
+
+        m_Sorted = sorted;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::isSorted() const
+    {
+        return m_Sorted;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setFilter(std::function<bool(const sf::String&)> filter)
+    {
+        if (!filter)
+        {
+            removeFilter();
+            return;
+        }
+
+        invalidate();
+
+        m_Filtered = true;
+        m_FilterFunction = std::move(filter);
+        m_FilterPrefix.clear();
+        applyFilter();
+
+        if (m_Scroll != nullptr)
+            m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setFilterPrefix(const sf::String& prefix)
+    {
+        if (prefix.isEmpty())
+        {
+            removeFilter();
+            return;
+        }
+
+        invalidate();
+
+        // When characters were only added to the previous prefix then the items that didn't pass the previous filter
+        // can't pass the new one either, so only the items that are still displayed have to be checked
+        if (m_Filtered && !m_FilterFunction && startsWith(prefix, m_FilterPrefix))
+        {
+            m_FilterPrefix = prefix;
+
+            auto newEnd = std::remove_if(m_FilteredItems.begin(), m_FilteredItems.end(),
+                                         [this](unsigned int index) { return !startsWith(getItemName(index), m_FilterPrefix); });
+            m_FilteredItems.erase(newEnd, m_FilteredItems.end());
+        }
+        else
+        {
+            m_Filtered = true;
+            m_FilterFunction = nullptr;
+            m_FilterPrefix = prefix;
+            applyFilter();
+        }
+
+        if (m_Scroll != nullptr)
+            m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::removeFilter()
+    {
+        invalidate();
+
+        m_Filtered = false;
+        m_FilterFunction = nullptr;
+        m_FilterPrefix.clear();
+        std::vector<unsigned int>().swap(m_FilteredItems);
+
+        if (m_Scroll != nullptr)
+            m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListBox::getFilteredItemCount() const
+    {
+        if (m_Filtered)
+            return m_FilteredItems.size();
+        else
+            return getItemCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setModel(ListBoxModel* model)
+    {
+        removeAllItems();
+
+        m_Model = model;
+        m_SelectedItem = -1;
+
+        modelChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListBoxModel* ListBox::getModel() const
+    {
+        return m_Model;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::modelChanged()
+    {
+        invalidate();
+
+        // Forget the items that were requested before
+        m_ModelPages.clear();
+
+        if (m_Model != nullptr)
+            m_ModelItemCount = m_Model->getItemCount();
+        else
+            m_ModelItemCount = 0;
+
+        // Unselect the selected item when it no longer exists
+        if (m_SelectedItem >= static_cast<int>(getItemCount()))
+            m_SelectedItem = -1;
+
+        if (m_Filtered)
+            applyFilter();
+
+        if (m_Scroll != nullptr)
+            m_Scroll->setMaximum(getFilteredItemCount() * m_ItemHeight);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        invalidate();
+
         m_LeftBorder   = leftBorder;
         m_TopBorder    = topBorder;
         m_RightBorder  = rightBorder;
@@ -830,6 +1355,8 @@ namespace tgui
 
     void ListBox::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         if (m_Scroll != nullptr)
@@ -903,33 +1430,36 @@ namespace tgui
             int oldSelectedItem = m_SelectedItem;
 
             // Check if there is a scrollbar or whether it is hidden
+            int row;
             if ((m_Scroll != nullptr) && (m_Scroll->getLowValue() < m_Scroll->getMaximum()))
             {
                 // Check if we clicked on the first (perhaps partially) visible item
                 if (y - getPosition().y <= (m_ItemHeight - (m_Scroll->getValue() % m_ItemHeight)))
                 {
                     // We clicked on the first visible item
-                    m_SelectedItem = static_cast<int>(m_Scroll->getValue() / m_ItemHeight);
+                    row = static_cast<int>(m_Scroll->getValue() / m_ItemHeight);
                 }
                 else // We didn't click on the first visible item
                 {
                     // Calculate on what item we clicked
                     if ((m_Scroll->getValue() % m_ItemHeight) == 0)
-                        m_SelectedItem = static_cast<int>((y - getPosition().y) / m_ItemHeight + (m_Scroll->getValue() / m_ItemHeight));
+                        row = static_cast<int>((y - getPosition().y) / m_ItemHeight + (m_Scroll->getValue() / m_ItemHeight));
                     else
-                        m_SelectedItem = static_cast<int>((((y - getPosition().y) - (m_ItemHeight - (m_Scroll->getValue() % m_ItemHeight))) / m_ItemHeight) + (m_Scroll->getValue() / m_ItemHeight) + 1);
+                        row = static_cast<int>((((y - getPosition().y) - (m_ItemHeight - (m_Scroll->getValue() % m_ItemHeight))) / m_ItemHeight) + (m_Scroll->getValue() / m_ItemHeight) + 1);
                 }
             }
             else // There is no scrollbar or it is not displayed
             {
                 // Calculate on which item we clicked
-                m_SelectedItem = static_cast<int>((y - getPosition().y) / m_ItemHeight);
-
-                // When you clicked behind the last item then unselect the selected item
-                if (m_SelectedItem > static_cast<int>(m_Items.size())-1)
-                    m_SelectedItem = -1;
+                row = static_cast<int>((y - getPosition().y) / m_ItemHeight);
             }
 
+            // When you clicked behind the last item then unselect the selected item
+            if (row > static_cast<int>(getFilteredItemCount())-1)
+                m_SelectedItem = -1;
+            else
+                m_SelectedItem = static_cast<int>(getItemIndexOfRow(row));
+
             // Add the callback (if the user requested it)
             if ((oldSelectedItem != m_SelectedItem) && (m_CallbackFunctions[ItemSelected].empty() == false))
             {
@@ -937,7 +1467,7 @@ namespace tgui
                 if (m_SelectedItem < 0)
                     m_Callback.text  = "";
                 else
-                    m_Callback.text = m_Items[m_SelectedItem];
+                    m_Callback.text = getItemName(m_SelectedItem);
 
                 m_Callback.value   = m_SelectedItem;
                 m_Callback.trigger = ItemSelected;
@@ -1077,6 +1607,48 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListBox::textEntered(sf::Uint32 key)
+    {
+        // Start a new search when nothing was typed for a while
+        if (m_TypeAheadClock.restart() > sf::seconds(1))
+        {
+            m_TypeAheadText.clear();
+            m_TypeAheadRow = 0;
+        }
+
+        m_TypeAheadText += key;
+
+        // Every item that starts with the new text also started with the previous text,
+        // so the search can continue from the item that was found last time
+        const unsigned int itemCount = getFilteredItemCount();
+        for (unsigned int row = m_TypeAheadRow; row < itemCount; ++row)
+        {
+            const unsigned int index = getItemIndexOfRow(row);
+            if (startsWith(getItemName(index), m_TypeAheadText))
+            {
+                m_TypeAheadRow = row;
+
+                if (m_SelectedItem != static_cast<int>(index))
+                {
+                    setSelectedItem(static_cast<int>(index));
+
+                    // Add the callback (if the user requested it)
+                    if (m_CallbackFunctions[ItemSelected].empty() == false)
+                    {
+                        m_Callback.text    = getItemName(m_SelectedItem);
+                        m_Callback.value   = m_SelectedItem;
+                        m_Callback.trigger = ItemSelected;
+                        addCallback();
+                    }
+                }
+
+                return;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ListBox::setProperty(std::string property, const std::string& value)
     {
         property = toLower(property);
@@ -1123,13 +1695,10 @@ namespace tgui
         }
         else if (property == "items")
         {
-            removeAllItems();
-
             std::vector<sf::String> items;
             decodeList(value, items);
 
-            for (auto it = items.cbegin(); it != items.cend(); ++it)
-                addItem(*it);
+            setItems(std::move(items));
         }
         else if (property == "selecteditem")
         {
@@ -1182,7 +1751,13 @@ namespace tgui
         else if (property == "borders")
             value = "(" + to_string(getBorders().left) + "," + to_string(getBorders().top) + "," + to_string(getBorders().right) + "," + to_string(getBorders().bottom) + ")";
         else if (property == "items")
-            encodeList(m_Items, value);
+        {
+            // The items of a model aren't part of the list box, so they aren't saved together with it
+            if (m_Model != nullptr)
+                value = "";
+            else
+                encodeList(m_Items, value);
+        }
         else if (property == "selecteditem")
             value = to_string(getSelectedItemIndex());
         else if (property == "callback")
@@ -1342,13 +1917,14 @@ namespace tgui
                 states.transform = storedTransform;
 
                 // Set the next item
-                text.setString(m_Items[i]);
+                const unsigned int index = getItemIndexOfRow(i);
+                text.setString(getItemName(index));
 
                 // Get the global bounds
                 sf::FloatRect bounds = text.getGlobalBounds();
 
                 // Check if we are drawing the selected item
-                if (m_SelectedItem == static_cast<int>(i))
+                if (m_SelectedItem == static_cast<int>(index))
                 {
                     // Draw a background for the selected item
                     {
@@ -1385,16 +1961,19 @@ namespace tgui
             // Store the current transformations
             sf::Transform storedTransform = states.transform;
 
-            for (unsigned int i = 0; i < m_Items.size(); ++i)
+            // Don't look at the items that lie below the list box
+            const unsigned int itemCount = TGUI_MINIMUM(getFilteredItemCount(), m_Size.y / m_ItemHeight + 1);
+            for (unsigned int i = 0; i < itemCount; ++i)
             {
                 // Restore the transformations
                 states.transform = storedTransform;
 
                 // Set the next item
-                text.setString(m_Items[i]);
+                const unsigned int index = getItemIndexOfRow(i);
+                text.setString(getItemName(index));
 
                 // Check if we are drawing the selected item
-                if (m_SelectedItem == static_cast<int>(i))
+                if (m_SelectedItem == static_cast<int>(index))
                 {
                     // Draw a background for the selected item
                     {
@@ -1443,6 +2022,265 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListBox::getItemLimit() const
+    {
+        unsigned int limit = (m_MaxItems > 0) ? m_MaxItems : std::numeric_limits<unsigned int>::max();
+
+        // If there is no scrollbar then the items also have to fit inside the list box
+        if (m_Scroll == nullptr)
+            limit = TGUI_MINIMUM(limit, m_Size.y / m_ItemHeight);
+
+        return limit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::sortItems(unsigned int firstUnsortedItem)
+    {
+        // Sort the indices of the items, so that the ids and the selected item can follow their item afterwards
+        std::vector<unsigned int> order(m_Items.size());
+        for (unsigned int i = 0; i < order.size(); ++i)
+            order[i] = i;
+
+        auto compare = [this](unsigned int left, unsigned int right) { return m_Items[left] < m_Items[right]; };
+        std::stable_sort(order.begin() + firstUnsortedItem, order.end(), compare);
+        std::inplace_merge(order.begin(), order.begin() + firstUnsortedItem, order.end(), compare);
+
+        std::vector<sf::String> items;
+        std::vector<int> ids;
+        items.reserve(order.size());
+        ids.reserve(order.size());
+
+        int selectedItem = -1;
+        for (unsigned int i = 0; i < order.size(); ++i)
+        {
+            items.push_back(std::move(m_Items[order[i]]));
+            ids.push_back(m_ItemIds[order[i]]);
+
+            if (static_cast<int>(order[i]) == m_SelectedItem)
+                selectedItem = static_cast<int>(i);
+        }
+
+        m_Items.swap(items);
+        m_ItemIds.swap(ids);
+        m_SelectedItem = selectedItem;
+        m_ItemIdIndexNeedsUpdate = true;
+
+        if (m_Filtered)
+            applyFilter();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::moveItem(unsigned int from, unsigned int to)
+    {
+        if (from == to)
+            return;
+
+        if (from < to)
+        {
+            std::rotate(m_Items.begin() + from, m_Items.begin() + from + 1, m_Items.begin() + to + 1);
+            std::rotate(m_ItemIds.begin() + from, m_ItemIds.begin() + from + 1, m_ItemIds.begin() + to + 1);
+
+            if (m_SelectedItem == static_cast<int>(from))
+                m_SelectedItem = static_cast<int>(to);
+            else if ((m_SelectedItem > static_cast<int>(from)) && (m_SelectedItem <= static_cast<int>(to)))
+                --m_SelectedItem;
+        }
+        else
+        {
+            std::rotate(m_Items.begin() + to, m_Items.begin() + from, m_Items.begin() + from + 1);
+            std::rotate(m_ItemIds.begin() + to, m_ItemIds.begin() + from, m_ItemIds.begin() + from + 1);
+
+            if (m_SelectedItem == static_cast<int>(from))
+                m_SelectedItem = static_cast<int>(to);
+            else if ((m_SelectedItem >= static_cast<int>(to)) && (m_SelectedItem < static_cast<int>(from)))
+                ++m_SelectedItem;
+        }
+
+        m_ItemIdIndexNeedsUpdate = true;
+
+        if (m_Filtered)
+            applyFilter();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateItemIdIndex()
+    {
+        if (!m_ItemIdIndexNeedsUpdate)
+            return;
+
+        m_ItemIdIndex.clear();
+        for (unsigned int i = 0; i < m_ItemIds.size(); ++i)
+            m_ItemIdIndex[m_ItemIds[i]].push_back(i);
+
+        m_ItemIdIndexNeedsUpdate = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListBox::getItemIndexOfRow(unsigned int row) const
+    {
+        if (m_Filtered)
+            return m_FilteredItems[row];
+        else
+            return row;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::getRowOfItem(unsigned int index) const
+    {
+        if (!m_Filtered)
+            return static_cast<int>(index);
+
+        auto it = std::lower_bound(m_FilteredItems.begin(), m_FilteredItems.end(), index);
+        if ((it != m_FilteredItems.end()) && (*it == index))
+            return it - m_FilteredItems.begin();
+        else
+            return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::passesFilter(const sf::String& item) const
+    {
+        if (m_FilterFunction)
+            return m_FilterFunction(item);
+        else
+            return startsWith(item, m_FilterPrefix);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::applyFilter()
+    {
+        m_FilteredItems.clear();
+
+        const unsigned int itemCount = getItemCount();
+        for (unsigned int i = 0; i < itemCount; ++i)
+        {
+            if (passesFilter(getItemName(i)))
+                m_FilteredItems.push_back(i);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::filterItem(unsigned int index, bool inserted)
+    {
+        auto it = std::lower_bound(m_FilteredItems.begin(), m_FilteredItems.end(), index);
+
+        // The items behind an inserted item moved one place
+        if (inserted)
+        {
+            for (auto shiftIt = it; shiftIt != m_FilteredItems.end(); ++shiftIt)
+                ++*shiftIt;
+        }
+
+        const bool wasDisplayed = (!inserted) && (it != m_FilteredItems.end()) && (*it == index);
+        if (passesFilter(getItemName(index)))
+        {
+            if (!wasDisplayed)
+                m_FilteredItems.insert(it, index);
+        }
+        else if (wasDisplayed)
+            m_FilteredItems.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::startsWith(const sf::String& text, const sf::String& prefix)
+    {
+        if (prefix.getSize() > text.getSize())
+            return false;
+
+        for (unsigned int i = 0; i < prefix.getSize(); ++i)
+        {
+            sf::Uint32 textChar = text[i];
+            sf::Uint32 prefixChar = prefix[i];
+
+            if ((textChar >= 'A') && (textChar <= 'Z'))
+                textChar += 'a' - 'A';
+            if ((prefixChar >= 'A') && (prefixChar <= 'Z'))
+                prefixChar += 'a' - 'A';
+
+            if (textChar != prefixChar)
+                return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::String& ListBox::getItemName(unsigned int index) const
+    {
+        if (m_Model != nullptr)
+        {
+            const ModelPage& page = getModelPage(index);
+            return page.items[index - page.first];
+        }
+        else
+            return m_Items[index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::getItemIdAt(unsigned int index) const
+    {
+        if (m_Model != nullptr)
+        {
+            const ModelPage& page = getModelPage(index);
+            return page.ids[index - page.first];
+        }
+        else
+            return m_ItemIds[index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ListBox::ModelPage& ListBox::getModelPage(unsigned int index) const
+    {
+        const unsigned int pageSize = 64;
+
+        // Look for the page in the cache and move it to the front when found
+        for (auto it = m_ModelPages.begin(); it != m_ModelPages.end(); ++it)
+        {
+            if ((index >= it->first) && (index < it->first + it->items.size()))
+            {
+                if (it != m_ModelPages.begin())
+                    m_ModelPages.splice(m_ModelPages.begin(), m_ModelPages, it);
+
+                return m_ModelPages.front();
+            }
+        }
+
+        // Every row that fits inside the list box may need its own page when the items are filtered,
+        // so keep that many pages to avoid requesting the same pages again every time the list box is drawn
+        const unsigned int maxPages = m_Size.y / m_ItemHeight + 2;
+        while (m_ModelPages.size() >= maxPages)
+            m_ModelPages.pop_back();
+
+        ModelPage page;
+        page.first = index - (index % pageSize);
+
+        const unsigned int count = TGUI_MINIMUM(pageSize, m_ModelItemCount - page.first);
+        page.items.reserve(count);
+        page.ids.reserve(count);
+        m_Model->getItems(page.first, count, page.items, page.ids);
+
+        // Make sure that a badly behaving model can't make us read outside the page
+        page.items.resize(count);
+        page.ids.resize(count, 0);
+
+        m_ModelPages.push_front(std::move(page));
+        return m_ModelPages.front();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -69,6 +69,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    LoadingBar::LoadingBar(LoadingBar&& other) :
+    ClickableWidget   (std::move(other)),
+    m_LoadedConfigFile(std::move(other.m_LoadedConfigFile)),
+    m_Minimum         (other.m_Minimum),
+    m_Maximum         (other.m_Maximum),
+    m_Value           (other.m_Value),
+    m_SplitImage      (other.m_SplitImage),
+    m_Text            (std::move(other.m_Text)),
+    m_TextSize        (other.m_TextSize)
+    {
+        // Take over the textures, the other widget will no longer release them
+        std::swap(m_TextureBack_L, other.m_TextureBack_L);
+        std::swap(m_TextureBack_M, other.m_TextureBack_M);
+        std::swap(m_TextureBack_R, other.m_TextureBack_R);
+        std::swap(m_TextureFront_L, other.m_TextureFront_L);
+        std::swap(m_TextureFront_M, other.m_TextureFront_M);
+        std::swap(m_TextureFront_R, other.m_TextureFront_R);
+
+        recalculateSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     LoadingBar::~LoadingBar()
     {
         if (m_TextureBack_L.data != nullptr)  TGUI_TextureManager.removeTexture(m_TextureBack_L);
@@ -110,6 +133,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    LoadingBar& LoadingBar::operator= (LoadingBar&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            this->ClickableWidget::operator=(std::move(right));
+
+            std::swap(m_LoadedConfigFile, right.m_LoadedConfigFile);
+            std::swap(m_Minimum,          right.m_Minimum);
+            std::swap(m_Maximum,          right.m_Maximum);
+            std::swap(m_Value,            right.m_Value);
+            std::swap(m_SplitImage,       right.m_SplitImage);
+            std::swap(m_TextureBack_L,    right.m_TextureBack_L);
+            std::swap(m_TextureBack_M,    right.m_TextureBack_M);
+            std::swap(m_TextureBack_R,    right.m_TextureBack_R);
+            std::swap(m_TextureFront_L,   right.m_TextureFront_L);
+            std::swap(m_TextureFront_M,   right.m_TextureFront_M);
+            std::swap(m_TextureFront_R,   right.m_TextureFront_R);
+            std::swap(m_Text,             right.m_Text);
+            std::swap(m_TextSize,         right.m_TextSize);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     LoadingBar* LoadingBar::clone()
     {
         return new LoadingBar(*this);
@@ -297,6 +347,8 @@ namespace tgui
 
     void LoadingBar::setSize(float width, float height)
     {
+        invalidate();
+
         // Don't do anything when the loading bar wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -327,6 +379,8 @@ namespace tgui
 
     void LoadingBar::setMinimum(unsigned int minimum)
     {
+        invalidate();
+
         // Set the new minimum
         m_Minimum = minimum;
 
@@ -346,6 +400,8 @@ namespace tgui
 
     void LoadingBar::setMaximum(unsigned int maximum)
     {
+        invalidate();
+
         // Set the new maximum
         m_Maximum = maximum;
 
@@ -365,6 +421,8 @@ namespace tgui
 
     void LoadingBar::setValue(unsigned int value)
     {
+        invalidate();
+
         // Set the new value
         m_Value = value;
 
@@ -440,6 +498,8 @@ namespace tgui
 
     void LoadingBar::setText(const sf::String& text)
     {
+        invalidate();
+
         // Don't do anything when the loading bar wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -476,6 +536,8 @@ namespace tgui
 
     void LoadingBar::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_Text.setFont(font);
     }
 
@@ -490,6 +552,8 @@ namespace tgui
 
     void LoadingBar::setTextColor(const sf::Color& color)
     {
+        invalidate();
+
         m_Text.setColor(color);
     }
 
@@ -504,6 +568,8 @@ namespace tgui
 
     void LoadingBar::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Change the text size
         m_TextSize = size;
 
@@ -522,6 +588,8 @@ namespace tgui
 
     void LoadingBar::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         m_TextureBack_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -24,6 +24,7 @@
 
 
 #include <cmath>
+#include <limits>
 
 #include <SFML/OpenGL.hpp>
 
@@ -128,6 +129,8 @@ namespace tgui
 
     void MenuBar::setSize(float width, float height)
     {
+        invalidate();
+
         m_Size.x = width;
         m_Size.y = height;
 
@@ -149,6 +152,8 @@ namespace tgui
 
     void MenuBar::addMenu(const sf::String& text)
     {
+        invalidate();
+
         Menu menu;
 
         menu.selectedMenuItem = -1;
@@ -165,6 +170,8 @@ namespace tgui
 
     bool MenuBar::addMenuItem(const sf::String& menu, const sf::String& text)
     {
+        invalidate();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
         {
@@ -190,6 +197,8 @@ namespace tgui
 
     bool MenuBar::removeMenu(const sf::String& menu)
     {
+        invalidate();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
         {
@@ -214,6 +223,8 @@ namespace tgui
 
     bool MenuBar::removeMenuItem(const sf::String& menu, const sf::String& menuItem)
     {
+        invalidate();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
         {
@@ -245,6 +256,8 @@ namespace tgui
 
     void MenuBar::removeAllMenus()
     {
+        invalidate();
+
         m_Menus.clear();
     }
 
@@ -276,6 +289,8 @@ namespace tgui
 
     void MenuBar::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_BackgroundColor = backgroundColor;
     }
 
@@ -283,6 +298,8 @@ namespace tgui
 
     void MenuBar::setTextColor(const sf::Color& textColor)
     {
+        invalidate();
+
         m_TextColor = textColor;
 
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
@@ -301,6 +318,8 @@ namespace tgui
 
     void MenuBar::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
     {
+        invalidate();
+
         m_SelectedBackgroundColor = selectedBackgroundColor;
     }
 
@@ -308,6 +327,8 @@ namespace tgui
 
     void MenuBar::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
+        invalidate();
+
         m_SelectedTextColor = selectedTextColor;
 
         if (m_VisibleMenu != -1)
@@ -349,6 +370,8 @@ namespace tgui
 
     void MenuBar::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_TextFont = &font;
 
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
@@ -375,6 +398,8 @@ namespace tgui
 
     void MenuBar::setTextSize(unsigned int size)
     {
+        invalidate();
+
         m_TextSize = size;
 
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
@@ -397,6 +422,8 @@ namespace tgui
 
     void MenuBar::setDistanceToSide(unsigned int distanceToSide)
     {
+        invalidate();
+
         m_DistanceToSide = distanceToSide;
     }
 
@@ -411,6 +438,8 @@ namespace tgui
 
     void MenuBar::setMinimumSubMenuWidth(unsigned int minimumWidth)
     {
+        invalidate();
+
         m_MinimumSubMenuWidth = minimumWidth;
     }
 
@@ -423,6 +452,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::FloatRect MenuBar::getDrawBounds() const
+    {
+        if (m_VisibleMenu == -1)
+            return Widget::getDrawBounds();
+
+        // The open menu can be wider than the menu bar, so only its height is known
+        return sf::FloatRect(getPosition().x, getPosition().y,
+                             std::numeric_limits<float>::max(), m_Size.y * (m_Menus[m_VisibleMenu].menuItems.size() + 1));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool MenuBar::mouseOnWidget(float x, float y)
     {
         if (m_Loaded)
@@ -63,6 +63,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MessageBox::MessageBox(MessageBox&& other) :
+    ChildWindow               (std::move(other)),
+    m_LoadedConfigFile        (std::move(other.m_LoadedConfigFile)),
+    m_ButtonConfigFileFilename(std::move(other.m_ButtonConfigFileFilename)),
+    m_Buttons                 (std::move(other.m_Buttons)),
+    m_Label                   (std::move(other.m_Label)),
+    m_TextSize                (other.m_TextSize)
+    {
+        // The buttons have to send their callbacks to this message box now
+        for (auto it = m_Buttons.begin(); it != m_Buttons.end(); ++it)
+        {
+            (*it)->unbindAllCallback();
+            (*it)->bindCallbackEx(&MessageBox::ButtonClickedCallbackFunction, this, Button::LeftMouseClicked | Button::SpaceKeyPressed | Button::ReturnKeyPressed);
+        }
+
+        // Leave an empty label behind, so that the functions of the other message box can still be called
+        other.m_Label = Label::Ptr();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     MessageBox::~MessageBox()
     {
     }
@@ -88,6 +109,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    MessageBox& MessageBox::operator= (MessageBox&& right)
+    {
+        if (this != &right)
+        {
+            this->ChildWindow::operator=(std::move(right));
+
+            std::swap(m_LoadedConfigFile,         right.m_LoadedConfigFile);
+            std::swap(m_ButtonConfigFileFilename, right.m_ButtonConfigFileFilename);
+            std::swap(m_Buttons,                  right.m_Buttons);
+            std::swap(m_Label,                    right.m_Label);
+            std::swap(m_TextSize,                 right.m_TextSize);
+
+            // The buttons were exchanged, so they have to send their callbacks to their new message box
+            for (auto it = m_Buttons.begin(); it != m_Buttons.end(); ++it)
+            {
+                (*it)->unbindAllCallback();
+                (*it)->bindCallbackEx(&MessageBox::ButtonClickedCallbackFunction, this, Button::LeftMouseClicked | Button::SpaceKeyPressed | Button::ReturnKeyPressed);
+            }
+
+            for (auto it = right.m_Buttons.begin(); it != right.m_Buttons.end(); ++it)
+            {
+                (*it)->unbindAllCallback();
+                (*it)->bindCallbackEx(&MessageBox::ButtonClickedCallbackFunction, &right, Button::LeftMouseClicked | Button::SpaceKeyPressed | Button::ReturnKeyPressed);
+            }
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     MessageBox* MessageBox::clone()
     {
         return new MessageBox(*this);
@@ -191,6 +243,8 @@ namespace tgui
 
     void MessageBox::setText(const sf::String& text)
     {
+        invalidate();
+
         if (m_Loaded)
         {
             m_Label->setText(text);
@@ -220,6 +274,8 @@ namespace tgui
 
     void MessageBox::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_Label->setTextFont(font);
     }
 
@@ -234,6 +290,8 @@ namespace tgui
 
     void MessageBox::setTextColor(const sf::Color& color)
     {
+        invalidate();
+
         m_Label->setTextColor(color);
     }
 
@@ -248,6 +306,8 @@ namespace tgui
 
     void MessageBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         m_TextSize = size;
 
         if (m_Loaded)
@@ -272,6 +332,8 @@ namespace tgui
 
     void MessageBox::addButton(const sf::String& caption)
     {
+        invalidate();
+
         if (m_Loaded)
         {
             Button::Ptr button(*this);
@@ -61,6 +61,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Panel::Panel(Panel&& other) :
+    Container        (std::move(other)),
+    m_Size           (other.m_Size),
+    m_BackgroundColor(other.m_BackgroundColor),
+    m_Texture        (other.m_Texture)
+    {
+        if (m_Texture)
+        {
+            m_Sprite.setTexture(*m_Texture);
+            m_Sprite.setScale(m_Size.x / m_Texture->getSize().x, m_Size.y / m_Texture->getSize().y);
+            m_Sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Panel::~Panel()
     {
     }
@@ -86,6 +102,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Panel& Panel::operator= (Panel&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            this->Container::operator=(std::move(right));
+
+            std::swap(m_Size,                          right.m_Size);
+            std::swap(m_BackgroundColor,               right.m_BackgroundColor);
+            std::swap(m_Texture,                       right.m_Texture);
+            std::swap(m_Sprite,                        right.m_Sprite);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Panel* Panel::clone()
     {
         return new Panel(*this);
@@ -95,6 +129,8 @@ namespace tgui
 
     void Panel::setSize(float width, float height)
     {
+        invalidate();
+
         // A negative size is not allowed for this widget
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -119,6 +155,8 @@ namespace tgui
 
     void Panel::setBackgroundTexture(sf::Texture *const texture)
     {
+        invalidate();
+
         // Store the texture
         m_Texture = texture;
 
@@ -141,6 +179,8 @@ namespace tgui
 
     void Panel::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_BackgroundColor = backgroundColor;
     }
 
@@ -155,6 +195,8 @@ namespace tgui
 
     void Panel::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Container::setTransparency(transparency);
 
         m_Sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -177,8 +219,7 @@ namespace tgui
             mouseLeftWidget();
 
             // Tell the widgets inside the panel that the mouse is no longer on top of them
-            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
+            setHoveredWidget(nullptr);
 
             m_MouseHover = false;
         }
@@ -380,7 +421,7 @@ namespace tgui
             target.draw(m_Sprite, states);
 
         // Draw the widgets
-        drawWidgetContainer(&target, states);
+        drawWidgetContainer(&target, states, sf::IntRect(scissorLeft, scissorTop, scissorRight - scissorLeft, scissorBottom - scissorTop));
 
         // Reset the old clipping area
         glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
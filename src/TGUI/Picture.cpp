@@ -48,6 +48,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Picture::Picture(Picture&& other) :
+    ClickableWidget (std::move(other)),
+    m_LoadedFilename(std::move(other.m_LoadedFilename))
+    {
+        // Take over the textures, the other widget will no longer release them
+        std::swap(m_Texture, other.m_Texture);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Picture::~Picture()
     {
         // Remove the texture (if we are the only one using it)
@@ -79,6 +89,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Picture& Picture::operator= (Picture&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            this->ClickableWidget::operator=(std::move(right));
+
+            std::swap(m_LoadedFilename, right.m_LoadedFilename);
+            std::swap(m_Texture,        right.m_Texture);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Picture* Picture::clone()
     {
         return new Picture(*this);
@@ -152,7 +178,7 @@ namespace tgui
 
     void Picture::setPosition(float x, float y)
     {
-        Transformable::setPosition(x, y);
+        Widget::setPosition(x, y);
 
         m_Texture.sprite.setPosition(x, y);
     }
@@ -161,6 +187,8 @@ namespace tgui
 
     void Picture::setSize(float width, float height)
     {
+        invalidate();
+
         m_Size.x = width;
         m_Size.y = height;
 
@@ -174,6 +202,8 @@ namespace tgui
 
     void Picture::setSmooth(bool smooth)
     {
+        invalidate();
+
         if (m_Loaded)
             m_Texture.data->texture.setSmooth(smooth);
         else
@@ -198,6 +228,8 @@ namespace tgui
 
     void Picture::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         m_Texture.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
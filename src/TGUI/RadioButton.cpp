@@ -62,6 +62,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    RadioButton::RadioButton(RadioButton&& other) :
+    ClickableWidget   (std::move(other)),
+    m_LoadedConfigFile(std::move(other.m_LoadedConfigFile)),
+    m_Checked         (other.m_Checked),
+    m_AllowTextClick  (other.m_AllowTextClick),
+    m_Text            (std::move(other.m_Text)),
+    m_TextSize        (other.m_TextSize)
+    {
+        // Take over the textures, the other widget will no longer release them
+        std::swap(m_TextureUnchecked, other.m_TextureUnchecked);
+        std::swap(m_TextureChecked, other.m_TextureChecked);
+        std::swap(m_TextureHover, other.m_TextureHover);
+        std::swap(m_TextureFocused, other.m_TextureFocused);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     RadioButton::~RadioButton()
     {
         if (m_TextureUnchecked.data != nullptr)  TGUI_TextureManager.removeTexture(m_TextureUnchecked);
@@ -95,6 +112,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    RadioButton& RadioButton::operator= (RadioButton&& right)
+    {
+        if (this != &right)
+        {
+            this->ClickableWidget::operator=(std::move(right));
+
+            std::swap(m_LoadedConfigFile, right.m_LoadedConfigFile);
+            std::swap(m_Checked,          right.m_Checked);
+            std::swap(m_AllowTextClick,   right.m_AllowTextClick);
+            std::swap(m_Text,             right.m_Text);
+            std::swap(m_TextSize,         right.m_TextSize);
+            std::swap(m_TextureUnchecked, right.m_TextureUnchecked);
+            std::swap(m_TextureChecked,   right.m_TextureChecked);
+            std::swap(m_TextureHover,     right.m_TextureHover);
+            std::swap(m_TextureFocused,   right.m_TextureFocused);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     RadioButton* RadioButton::clone()
     {
         return new RadioButton(*this);
@@ -241,6 +280,8 @@ namespace tgui
 
     void RadioButton::setSize(float width, float height)
     {
+        invalidate();
+
         // Don't do anything when the radio button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -288,6 +329,8 @@ namespace tgui
 
     void RadioButton::check()
     {
+        invalidate();
+
         if (m_Checked == false)
         {
             // Tell our parent that all the radio buttons should be unchecked
@@ -310,6 +353,8 @@ namespace tgui
 
     void RadioButton::uncheck()
     {
+        invalidate();
+
         if (m_Checked)
         {
             m_Checked = false;
@@ -335,6 +380,8 @@ namespace tgui
 
     void RadioButton::setText(const sf::String& text)
     {
+        invalidate();
+
         // Don't do anything when the radio button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -363,6 +410,8 @@ namespace tgui
 
     void RadioButton::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_Text.setFont(font);
         setText(getText());
     }
@@ -378,6 +427,8 @@ namespace tgui
 
     void RadioButton::setTextColor(const sf::Color& Color)
     {
+        invalidate();
+
         m_Text.setColor(Color);
     }
 
@@ -392,6 +443,8 @@ namespace tgui
 
     void RadioButton::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Change the text size
         m_TextSize = size;
 
@@ -410,6 +463,8 @@ namespace tgui
 
     void RadioButton::allowTextClick(bool acceptTextClick)
     {
+        invalidate();
+
         m_AllowTextClick = acceptTextClick;
     }
 
@@ -417,6 +472,8 @@ namespace tgui
 
     void RadioButton::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         m_TextureChecked.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -84,6 +84,41 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Scrollbar::Scrollbar(Scrollbar&& other) :
+    Widget               (std::move(other)),
+    m_LoadedConfigFile   (std::move(other.m_LoadedConfigFile)),
+    m_MouseDownOnThumb   (other.m_MouseDownOnThumb),
+    m_MouseDownOnThumbPos(other.m_MouseDownOnThumbPos),
+    m_Maximum            (other.m_Maximum),
+    m_Value              (other.m_Value),
+    m_LowValue           (other.m_LowValue),
+    m_VerticalScroll     (other.m_VerticalScroll),
+    m_VerticalImage      (other.m_VerticalImage),
+    m_ScrollAmount       (other.m_ScrollAmount),
+    m_AutoHide           (other.m_AutoHide),
+    m_MouseDownOnArrow   (other.m_MouseDownOnArrow),
+    m_SplitImage         (other.m_SplitImage),
+    m_SeparateHoverImage (other.m_SeparateHoverImage),
+    m_Size               (other.m_Size),
+    m_ThumbSize          (other.m_ThumbSize)
+    {
+        // Take over the textures, the other widget will no longer release them
+        std::swap(m_TextureTrackNormal_L, other.m_TextureTrackNormal_L);
+        std::swap(m_TextureTrackHover_L, other.m_TextureTrackHover_L);
+        std::swap(m_TextureTrackNormal_M, other.m_TextureTrackNormal_M);
+        std::swap(m_TextureTrackHover_M, other.m_TextureTrackHover_M);
+        std::swap(m_TextureTrackNormal_R, other.m_TextureTrackNormal_R);
+        std::swap(m_TextureTrackHover_R, other.m_TextureTrackHover_R);
+        std::swap(m_TextureThumbNormal, other.m_TextureThumbNormal);
+        std::swap(m_TextureThumbHover, other.m_TextureThumbHover);
+        std::swap(m_TextureArrowUpNormal, other.m_TextureArrowUpNormal);
+        std::swap(m_TextureArrowUpHover, other.m_TextureArrowUpHover);
+        std::swap(m_TextureArrowDownNormal, other.m_TextureArrowDownNormal);
+        std::swap(m_TextureArrowDownHover, other.m_TextureArrowDownHover);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Scrollbar::~Scrollbar()
     {
         if (m_TextureArrowUpNormal.data != nullptr)   TGUI_TextureManager.removeTexture(m_TextureArrowUpNormal);
@@ -144,6 +179,47 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Scrollbar& Scrollbar::operator= (Scrollbar&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            this->Widget::operator=(std::move(right));
+
+            std::swap(m_LoadedConfigFile,       right.m_LoadedConfigFile);
+            std::swap(m_MouseDownOnThumb,       right.m_MouseDownOnThumb);
+            std::swap(m_MouseDownOnThumbPos,    right.m_MouseDownOnThumbPos);
+            std::swap(m_Maximum,                right.m_Maximum);
+            std::swap(m_Value,                  right.m_Value);
+            std::swap(m_LowValue,               right.m_LowValue);
+            std::swap(m_VerticalScroll,         right.m_VerticalScroll);
+            std::swap(m_VerticalImage,          right.m_VerticalImage);
+            std::swap(m_ScrollAmount,           right.m_ScrollAmount);
+            std::swap(m_AutoHide,               right.m_AutoHide);
+            std::swap(m_MouseDownOnArrow,       right.m_MouseDownOnArrow);
+            std::swap(m_SplitImage,             right.m_SplitImage);
+            std::swap(m_SeparateHoverImage,     right.m_SeparateHoverImage);
+            std::swap(m_Size,                   right.m_Size);
+            std::swap(m_ThumbSize,              right.m_ThumbSize);
+            std::swap(m_TextureTrackNormal_L,   right.m_TextureTrackNormal_L);
+            std::swap(m_TextureTrackHover_L,    right.m_TextureTrackHover_L);
+            std::swap(m_TextureTrackNormal_M,   right.m_TextureTrackNormal_M);
+            std::swap(m_TextureTrackHover_M,    right.m_TextureTrackHover_M);
+            std::swap(m_TextureTrackNormal_R,   right.m_TextureTrackNormal_R);
+            std::swap(m_TextureTrackHover_R,    right.m_TextureTrackHover_R);
+            std::swap(m_TextureThumbNormal,     right.m_TextureThumbNormal);
+            std::swap(m_TextureThumbHover,      right.m_TextureThumbHover);
+            std::swap(m_TextureArrowUpNormal,   right.m_TextureArrowUpNormal);
+            std::swap(m_TextureArrowUpHover,    right.m_TextureArrowUpHover);
+            std::swap(m_TextureArrowDownNormal, right.m_TextureArrowDownNormal);
+            std::swap(m_TextureArrowDownHover,  right.m_TextureArrowDownHover);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Scrollbar* Scrollbar::clone()
     {
         return new Scrollbar(*this);
@@ -407,6 +483,8 @@ namespace tgui
 
     void Scrollbar::setSize(float width, float height)
     {
+        invalidate();
+
         // Don't do anything when the scrollbar wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -462,6 +540,8 @@ namespace tgui
 
     void Scrollbar::setMaximum(unsigned int maximum)
     {
+        invalidate();
+
         // Set the new maximum
         if (maximum > 0)
             m_Maximum = maximum;
@@ -479,6 +559,8 @@ namespace tgui
 
     void Scrollbar::setValue(unsigned int value)
     {
+        invalidate();
+
         if (m_Value != value)
         {
             // Set the new value
@@ -504,6 +586,8 @@ namespace tgui
 
     void Scrollbar::setLowValue(unsigned int lowValue)
     {
+        invalidate();
+
         // Set the new value
         m_LowValue = lowValue;
 
@@ -518,6 +602,8 @@ namespace tgui
 
     void Scrollbar::setVerticalScroll(bool verticalScroll)
     {
+        invalidate();
+
         // Only continue when the value changed
         if (m_VerticalScroll != verticalScroll)
         {
@@ -574,6 +660,8 @@ namespace tgui
 
     void Scrollbar::setArrowScrollAmount(unsigned int scrollAmount)
     {
+        invalidate();
+
         m_ScrollAmount = scrollAmount;
     }
 
@@ -588,6 +676,8 @@ namespace tgui
 
     void Scrollbar::setAutoHide(bool autoHide)
     {
+        invalidate();
+
         m_AutoHide = autoHide;
     }
 
@@ -602,6 +692,8 @@ namespace tgui
 
     void Scrollbar::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         m_TextureTrackNormal_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
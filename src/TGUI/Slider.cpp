@@ -75,6 +75,34 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Slider::Slider(Slider&& other) :
+    Widget               (std::move(other)),
+    m_LoadedConfigFile   (std::move(other.m_LoadedConfigFile)),
+    m_MouseDownOnThumb   (other.m_MouseDownOnThumb),
+    m_MouseDownOnThumbPos(other.m_MouseDownOnThumbPos),
+    m_Minimum            (other.m_Minimum),
+    m_Maximum            (other.m_Maximum),
+    m_Value              (other.m_Value),
+    m_VerticalScroll     (other.m_VerticalScroll),
+    m_VerticalImage      (other.m_VerticalImage),
+    m_SplitImage         (other.m_SplitImage),
+    m_SeparateHoverImage (other.m_SeparateHoverImage),
+    m_Size               (other.m_Size),
+    m_ThumbSize          (other.m_ThumbSize)
+    {
+        // Take over the textures, the other widget will no longer release them
+        std::swap(m_TextureTrackNormal_L, other.m_TextureTrackNormal_L);
+        std::swap(m_TextureTrackHover_L, other.m_TextureTrackHover_L);
+        std::swap(m_TextureTrackNormal_M, other.m_TextureTrackNormal_M);
+        std::swap(m_TextureTrackHover_M, other.m_TextureTrackHover_M);
+        std::swap(m_TextureTrackNormal_R, other.m_TextureTrackNormal_R);
+        std::swap(m_TextureTrackHover_R, other.m_TextureTrackHover_R);
+        std::swap(m_TextureThumbNormal, other.m_TextureThumbNormal);
+        std::swap(m_TextureThumbHover, other.m_TextureThumbHover);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Slider::~Slider()
     {
         if (m_TextureTrackNormal_L.data != nullptr) TGUI_TextureManager.removeTexture(m_TextureTrackNormal_L);
@@ -124,6 +152,40 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Slider& Slider::operator= (Slider&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            this->Widget::operator=(std::move(right));
+
+            std::swap(m_LoadedConfigFile,     right.m_LoadedConfigFile);
+            std::swap(m_MouseDownOnThumb,     right.m_MouseDownOnThumb);
+            std::swap(m_MouseDownOnThumbPos,  right.m_MouseDownOnThumbPos);
+            std::swap(m_Minimum,              right.m_Minimum);
+            std::swap(m_Maximum,              right.m_Maximum);
+            std::swap(m_Value,                right.m_Value);
+            std::swap(m_VerticalScroll,       right.m_VerticalScroll);
+            std::swap(m_VerticalImage,        right.m_VerticalImage);
+            std::swap(m_SplitImage,           right.m_SplitImage);
+            std::swap(m_SeparateHoverImage,   right.m_SeparateHoverImage);
+            std::swap(m_Size,                 right.m_Size);
+            std::swap(m_ThumbSize,            right.m_ThumbSize);
+            std::swap(m_TextureTrackNormal_L, right.m_TextureTrackNormal_L);
+            std::swap(m_TextureTrackHover_L,  right.m_TextureTrackHover_L);
+            std::swap(m_TextureTrackNormal_M, right.m_TextureTrackNormal_M);
+            std::swap(m_TextureTrackHover_M,  right.m_TextureTrackHover_M);
+            std::swap(m_TextureTrackNormal_R, right.m_TextureTrackNormal_R);
+            std::swap(m_TextureTrackHover_R,  right.m_TextureTrackHover_R);
+            std::swap(m_TextureThumbNormal,   right.m_TextureThumbNormal);
+            std::swap(m_TextureThumbHover,    right.m_TextureThumbHover);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Slider* Slider::clone()
     {
         return new Slider(*this);
@@ -419,6 +481,8 @@ namespace tgui
 
     void Slider::setSize(float width, float height)
     {
+        invalidate();
+
         // Don't do anything when the slider wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -583,6 +647,8 @@ namespace tgui
 
     void Slider::setMinimum(unsigned int minimum)
     {
+        invalidate();
+
         // Set the new minimum
         m_Minimum = minimum;
 
@@ -599,6 +665,8 @@ namespace tgui
 
     void Slider::setMaximum(unsigned int maximum)
     {
+        invalidate();
+
         // Set the new maximum
         if (maximum > 0)
             m_Maximum = maximum;
@@ -618,6 +686,8 @@ namespace tgui
 
     void Slider::setValue(unsigned int value)
     {
+        invalidate();
+
         if (m_Value != value)
         {
             // Set the new value
@@ -643,6 +713,8 @@ namespace tgui
 
     void Slider::setVerticalScroll(bool verticalScroll)
     {
+        invalidate();
+
         // Only continue when the value changed
         if (m_VerticalScroll != verticalScroll)
         {
@@ -699,6 +771,8 @@ namespace tgui
 
     void Slider::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         m_TextureTrackNormal_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -713,6 +787,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::FloatRect Slider::getDrawBounds() const
+    {
+        // Half of the thumb can stick out on every side of the track
+        return sf::FloatRect(getPosition().x - (m_ThumbSize.x / 2.f), getPosition().y - (m_ThumbSize.y / 2.f),
+                             getSize().x + m_ThumbSize.x, getSize().y + m_ThumbSize.y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Slider::mouseOnWidget(float x, float y)
     {
         // Don't do anything when the slider wasn't loaded correctly
@@ -66,6 +66,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Slider2d::Slider2d(Slider2d&& other) :
+    ClickableWidget      (std::move(other)),
+    m_LoadedConfigFile   (std::move(other.m_LoadedConfigFile)),
+    m_Minimum            (other.m_Minimum),
+    m_Maximum            (other.m_Maximum),
+    m_Value              (other.m_Value),
+    m_ReturnThumbToCenter(other.m_ReturnThumbToCenter),
+    m_FixedThumbSize     (other.m_FixedThumbSize),
+    m_SeparateHoverImage (other.m_SeparateHoverImage)
+    {
+        // Take over the textures, the other widget will no longer release them
+        std::swap(m_TextureTrackNormal, other.m_TextureTrackNormal);
+        std::swap(m_TextureTrackHover, other.m_TextureTrackHover);
+        std::swap(m_TextureThumbNormal, other.m_TextureThumbNormal);
+        std::swap(m_TextureThumbHover, other.m_TextureThumbHover);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Slider2d::~Slider2d()
     {
         // Remove all the textures
@@ -103,6 +122,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Slider2d& Slider2d::operator= (Slider2d&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            this->ClickableWidget::operator=(std::move(right));
+
+            std::swap(m_LoadedConfigFile,    right.m_LoadedConfigFile);
+            std::swap(m_Minimum,             right.m_Minimum);
+            std::swap(m_Maximum,             right.m_Maximum);
+            std::swap(m_Value,               right.m_Value);
+            std::swap(m_ReturnThumbToCenter, right.m_ReturnThumbToCenter);
+            std::swap(m_FixedThumbSize,      right.m_FixedThumbSize);
+            std::swap(m_TextureTrackNormal,  right.m_TextureTrackNormal);
+            std::swap(m_TextureTrackHover,   right.m_TextureTrackHover);
+            std::swap(m_TextureThumbNormal,  right.m_TextureThumbNormal);
+            std::swap(m_TextureThumbHover,   right.m_TextureThumbHover);
+            std::swap(m_SeparateHoverImage,  right.m_SeparateHoverImage);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Slider2d* Slider2d::clone()
     {
         return new Slider2d(*this);
@@ -227,6 +271,8 @@ namespace tgui
 
     void Slider2d::setSize(float width, float height)
     {
+        invalidate();
+
         // Don't do anything when the slider wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -244,6 +290,8 @@ namespace tgui
 
     void Slider2d::setMinimum(const sf::Vector2f& minimum)
     {
+        invalidate();
+
         // Set the new minimum
         m_Minimum = minimum;
 
@@ -264,6 +312,8 @@ namespace tgui
 
     void Slider2d::setMaximum(const sf::Vector2f& maximum)
     {
+        invalidate();
+
         // Set the new maximum
         m_Maximum = maximum;
 
@@ -284,6 +334,8 @@ namespace tgui
 
     void Slider2d::setValue(const sf::Vector2f& value)
     {
+        invalidate();
+
         // Set the new value
         m_Value = value;
 
@@ -324,6 +376,8 @@ namespace tgui
 
     void Slider2d::setFixedThumbSize(bool fixedSize)
     {
+        invalidate();
+
         m_FixedThumbSize = fixedSize;
     }
 
@@ -352,6 +406,8 @@ namespace tgui
 
     void Slider2d::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         m_TextureThumbNormal.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
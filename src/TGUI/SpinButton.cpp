@@ -65,6 +65,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    SpinButton::SpinButton(SpinButton&& other) :
+    ClickableWidget       (std::move(other)),
+    m_LoadedConfigFile    (std::move(other.m_LoadedConfigFile)),
+    m_VerticalScroll      (other.m_VerticalScroll),
+    m_Minimum             (other.m_Minimum),
+    m_Maximum             (other.m_Maximum),
+    m_Value               (other.m_Value),
+    m_SeparateHoverImage  (other.m_SeparateHoverImage),
+    m_MouseHoverOnTopArrow(other.m_MouseHoverOnTopArrow),
+    m_MouseDownOnTopArrow (other.m_MouseDownOnTopArrow)
+    {
+        // Take over the textures, the other widget will no longer release them
+        std::swap(m_TextureArrowUpNormal, other.m_TextureArrowUpNormal);
+        std::swap(m_TextureArrowUpHover, other.m_TextureArrowUpHover);
+        std::swap(m_TextureArrowDownNormal, other.m_TextureArrowDownNormal);
+        std::swap(m_TextureArrowDownHover, other.m_TextureArrowDownHover);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     SpinButton::~SpinButton()
     {
         if (m_TextureArrowUpNormal.data != nullptr)    TGUI_TextureManager.removeTexture(m_TextureArrowUpNormal);
@@ -102,6 +122,32 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    SpinButton& SpinButton::operator= (SpinButton&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            this->ClickableWidget::operator=(std::move(right));
+
+            std::swap(m_LoadedConfigFile,       right.m_LoadedConfigFile);
+            std::swap(m_VerticalScroll,         right.m_VerticalScroll);
+            std::swap(m_Minimum,                right.m_Minimum);
+            std::swap(m_Maximum,                right.m_Maximum);
+            std::swap(m_Value,                  right.m_Value);
+            std::swap(m_SeparateHoverImage,     right.m_SeparateHoverImage);
+            std::swap(m_MouseHoverOnTopArrow,   right.m_MouseHoverOnTopArrow);
+            std::swap(m_MouseDownOnTopArrow,    right.m_MouseDownOnTopArrow);
+            std::swap(m_TextureArrowUpNormal,   right.m_TextureArrowUpNormal);
+            std::swap(m_TextureArrowUpHover,    right.m_TextureArrowUpHover);
+            std::swap(m_TextureArrowDownNormal, right.m_TextureArrowDownNormal);
+            std::swap(m_TextureArrowDownHover,  right.m_TextureArrowDownHover);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     SpinButton* SpinButton::clone()
     {
         return new SpinButton(*this);
@@ -226,6 +272,8 @@ namespace tgui
 
     void SpinButton::setSize(float width, float height)
     {
+        invalidate();
+
         // Don't do anything when the spin button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -243,6 +291,8 @@ namespace tgui
 
     void SpinButton::setMinimum(unsigned int minimum)
     {
+        invalidate();
+
         // Set the new minimum
         m_Minimum = minimum;
 
@@ -259,6 +309,8 @@ namespace tgui
 
     void SpinButton::setMaximum(unsigned int maximum)
     {
+        invalidate();
+
         m_Maximum = maximum;
 
         // The maximum can never be below the minimum
@@ -274,6 +326,8 @@ namespace tgui
 
     void SpinButton::setValue(unsigned int value)
     {
+        invalidate();
+
         // Set the new value
         m_Value = value;
 
@@ -309,6 +363,8 @@ namespace tgui
 
     void SpinButton::setVerticalScroll(bool verticalScroll)
     {
+        invalidate();
+
         m_VerticalScroll = verticalScroll;
     }
 
@@ -323,6 +379,8 @@ namespace tgui
 
     void SpinButton::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         m_TextureArrowUpNormal.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
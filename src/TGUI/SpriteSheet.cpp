@@ -51,6 +51,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    SpriteSheet::SpriteSheet(SpriteSheet&& other) :
+    Picture      (std::move(other)),
+    m_Rows       (other.m_Rows),
+    m_Columns    (other.m_Columns),
+    m_VisibleCell(other.m_VisibleCell)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     SpriteSheet& SpriteSheet::operator= (const SpriteSheet& right)
     {
         // Make sure it is not the same widget
@@ -69,6 +79,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    SpriteSheet& SpriteSheet::operator= (SpriteSheet&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            this->Picture::operator=(std::move(right));
+
+            std::swap(m_Rows,        right.m_Rows);
+            std::swap(m_Columns,     right.m_Columns);
+            std::swap(m_VisibleCell, right.m_VisibleCell);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     SpriteSheet* SpriteSheet::clone()
     {
         return new SpriteSheet(*this);
@@ -78,6 +105,8 @@ namespace tgui
 
     void SpriteSheet::setSize(float width, float height)
     {
+        invalidate();
+
         // Make sure that the picture was already loaded
         if (m_Loaded == false)
             return;
@@ -104,6 +133,8 @@ namespace tgui
 
     void SpriteSheet::setCells(unsigned int rows, unsigned int columns)
     {
+        invalidate();
+
         // Make sure that the picture was already loaded
         if (m_Loaded == false)
             return;
@@ -134,6 +165,8 @@ namespace tgui
 
     void SpriteSheet::setRows(unsigned int rows)
     {
+        invalidate();
+
         setCells(rows, m_Columns);
     }
 
@@ -148,6 +181,8 @@ namespace tgui
 
     void SpriteSheet::setColumns(unsigned int columns)
     {
+        invalidate();
+
         setCells(m_Rows, columns);
     }
 
@@ -162,6 +197,8 @@ namespace tgui
 
     void SpriteSheet::setVisibleCell(unsigned int row, unsigned int column)
     {
+        invalidate();
+
         // Make sure that the picture was already loaded
         if (m_Loaded == false)
             return;
@@ -77,6 +77,34 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Tab::Tab(Tab&& other) :
+    Widget                 (std::move(other)),
+    m_LoadedConfigFile     (std::move(other.m_LoadedConfigFile)),
+    m_SplitImage           (other.m_SplitImage),
+    m_SeparateSelectedImage(other.m_SeparateSelectedImage),
+    m_TabHeight            (other.m_TabHeight),
+    m_TextSize             (other.m_TextSize),
+    m_TextColor            (other.m_TextColor),
+    m_SelectedTextColor    (other.m_SelectedTextColor),
+    m_MaximumTabWidth      (other.m_MaximumTabWidth),
+    m_DistanceToSide       (other.m_DistanceToSide),
+    m_SelectedTab          (other.m_SelectedTab),
+    m_TabNames             (std::move(other.m_TabNames)),
+    m_NameWidth            (std::move(other.m_NameWidth)),
+    m_Text                 (std::move(other.m_Text))
+    {
+        // Take over the textures, the other widget will no longer release them
+        std::swap(m_TextureNormal_L, other.m_TextureNormal_L);
+        std::swap(m_TextureNormal_M, other.m_TextureNormal_M);
+        std::swap(m_TextureNormal_R, other.m_TextureNormal_R);
+
+        std::swap(m_TextureSelected_L, other.m_TextureSelected_L);
+        std::swap(m_TextureSelected_M, other.m_TextureSelected_M);
+        std::swap(m_TextureSelected_R, other.m_TextureSelected_R);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Tab::~Tab()
     {
         if (m_TextureNormal_L.data != nullptr)    TGUI_TextureManager.removeTexture(m_TextureNormal_L);
@@ -124,6 +152,39 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Tab& Tab::operator= (Tab&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            this->Widget::operator=(std::move(right));
+
+            std::swap(m_LoadedConfigFile,      right.m_LoadedConfigFile);
+            std::swap(m_SplitImage,            right.m_SplitImage);
+            std::swap(m_SeparateSelectedImage, right.m_SeparateSelectedImage);
+            std::swap(m_TabHeight,             right.m_TabHeight);
+            std::swap(m_TextSize,              right.m_TextSize);
+            std::swap(m_TextColor,             right.m_TextColor);
+            std::swap(m_SelectedTextColor,     right.m_SelectedTextColor);
+            std::swap(m_MaximumTabWidth,       right.m_MaximumTabWidth);
+            std::swap(m_DistanceToSide,        right.m_DistanceToSide);
+            std::swap(m_SelectedTab,           right.m_SelectedTab);
+            std::swap(m_TabNames,              right.m_TabNames);
+            std::swap(m_NameWidth,             right.m_NameWidth);
+            std::swap(m_TextureNormal_L,       right.m_TextureNormal_L);
+            std::swap(m_TextureNormal_M,       right.m_TextureNormal_M);
+            std::swap(m_TextureNormal_R,       right.m_TextureNormal_R);
+            std::swap(m_TextureSelected_L,     right.m_TextureSelected_L);
+            std::swap(m_TextureSelected_M,     right.m_TextureSelected_M);
+            std::swap(m_TextureSelected_R,     right.m_TextureSelected_R);
+            std::swap(m_Text,                  right.m_Text);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Tab* Tab::clone()
     {
         return new Tab(*this);
@@ -332,6 +393,7 @@ namespace tgui
 
     void Tab::setSize(float, float)
     {
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -379,6 +441,8 @@ namespace tgui
 
     void Tab::select(const sf::String& name)
     {
+        invalidate();
+
         // Loop through all tabs
         for (unsigned int i=0; i<m_TabNames.size(); ++i)
         {
@@ -398,6 +462,8 @@ namespace tgui
 
     void Tab::select(unsigned int index)
     {
+        invalidate();
+
         // If the index is too big then do nothing
         if (index > m_TabNames.size()-1)
         {
@@ -413,6 +479,8 @@ namespace tgui
 
     void Tab::deselect()
     {
+        invalidate();
+
         m_SelectedTab = -1;
     }
 
@@ -420,6 +488,8 @@ namespace tgui
 
     void Tab::remove(const sf::String& name)
     {
+        invalidate();
+
         // Loop through all tabs
         for (unsigned int i=0; i<m_TabNames.size(); ++i)
         {
@@ -447,6 +517,8 @@ namespace tgui
 
     void Tab::remove(unsigned int index)
     {
+        invalidate();
+
         // The index can't be too high
         if (index > m_TabNames.size()-1)
         {
@@ -469,6 +541,8 @@ namespace tgui
 
     void Tab::removeAll()
     {
+        invalidate();
+
         m_TabNames.clear();
         m_NameWidth.clear();
         m_SelectedTab = -1;
@@ -495,6 +569,8 @@ namespace tgui
 
     void Tab::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_Text.setFont(font);
 
         // Recalculate the name widths
@@ -516,6 +592,8 @@ namespace tgui
 
     void Tab::setTextColor(const sf::Color& color)
     {
+        invalidate();
+
         m_TextColor = color;
     }
 
@@ -530,6 +608,8 @@ namespace tgui
 
     void Tab::setSelectedTextColor(const sf::Color& color)
     {
+        invalidate();
+
         m_SelectedTextColor = color;
     }
 
@@ -544,6 +624,8 @@ namespace tgui
 
     void Tab::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Change the text size
         m_TextSize = size;
 
@@ -579,6 +661,8 @@ namespace tgui
 
     void Tab::setTabHeight(unsigned int height)
     {
+        invalidate();
+
         // Make sure that the height changed
         if (m_TabHeight != height)
         {
@@ -601,6 +685,8 @@ namespace tgui
 
     void Tab::setMaximumTabWidth(unsigned int maximumWidth)
     {
+        invalidate();
+
         m_MaximumTabWidth = maximumWidth;
     }
 
@@ -615,6 +701,8 @@ namespace tgui
 
     void Tab::setDistanceToSide(unsigned int distanceToSide)
     {
+        invalidate();
+
         m_DistanceToSide = distanceToSide;
     }
 
@@ -629,6 +717,8 @@ namespace tgui
 
     void Tab::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         m_TextureNormal_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
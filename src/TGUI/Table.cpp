@@ -0,0 +1,1749 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <cmath>
+#include <algorithm>
+
+#include <SFML/OpenGL.hpp>
+
+#include <TGUI/Scrollbar.hpp>
+#include <TGUI/Container.hpp>
+#include <TGUI/Table.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+   /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Table::Table() :
+    m_RowCount               (0),
+    m_SortColumn             (-1),
+    m_SortAscending          (true),
+    m_SelectedRow            (-1),
+    m_ResizingColumn         (-1),
+    m_Size                   (200, 100),
+    m_RowHeight              (24),
+    m_TextSize               (19),
+    m_Scroll                 (nullptr),
+    m_TextFont               (nullptr),
+    m_HeaderVertices         (sf::Quads),
+    m_CellVertices           (sf::Quads),
+    m_TextGeometryNeedsUpdate(true),
+    m_GeometryFirstRow       (0),
+    m_GeometryEndRow         (0)
+    {
+        m_Callback.widgetType = Type_Table;
+        m_DraggableWidget = true;
+        m_Loaded = true;
+
+        changeColors();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Table::Table(const Table& copy) :
+    Widget                   (copy),
+    WidgetBorders            (copy),
+    m_LoadedConfigFile       (copy.m_LoadedConfigFile),
+    m_Columns                (copy.m_Columns),
+    m_RowCount               (copy.m_RowCount),
+    m_RowOrder               (copy.m_RowOrder),
+    m_SortColumn             (copy.m_SortColumn),
+    m_SortAscending          (copy.m_SortAscending),
+    m_SelectedRow            (copy.m_SelectedRow),
+    m_ResizingColumn         (-1),
+    m_Size                   (copy.m_Size),
+    m_RowHeight              (copy.m_RowHeight),
+    m_TextSize               (copy.m_TextSize),
+    m_BackgroundColor        (copy.m_BackgroundColor),
+    m_TextColor              (copy.m_TextColor),
+    m_SelectedBackgroundColor(copy.m_SelectedBackgroundColor),
+    m_SelectedTextColor      (copy.m_SelectedTextColor),
+    m_BorderColor            (copy.m_BorderColor),
+    m_HeaderBackgroundColor  (copy.m_HeaderBackgroundColor),
+    m_HeaderTextColor        (copy.m_HeaderTextColor),
+    m_TextFont               (copy.m_TextFont),
+    m_HeaderVertices         (sf::Quads),
+    m_CellVertices           (sf::Quads),
+    m_TextGeometryNeedsUpdate(true),
+    m_GeometryFirstRow       (0),
+    m_GeometryEndRow         (0)
+    {
+        // If there is a scrollbar then copy it
+        if (copy.m_Scroll != nullptr)
+            m_Scroll = new Scrollbar(*copy.m_Scroll);
+        else
+            m_Scroll = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Table::Table(Table&& other) :
+    Widget                   (std::move(other)),
+    WidgetBorders            (other),
+    m_LoadedConfigFile       (std::move(other.m_LoadedConfigFile)),
+    m_Columns                (std::move(other.m_Columns)),
+    m_RowCount               (other.m_RowCount),
+    m_RowOrder               (std::move(other.m_RowOrder)),
+    m_SortColumn             (other.m_SortColumn),
+    m_SortAscending          (other.m_SortAscending),
+    m_SelectedRow            (other.m_SelectedRow),
+    m_ResizingColumn         (-1),
+    m_Size                   (other.m_Size),
+    m_RowHeight              (other.m_RowHeight),
+    m_TextSize               (other.m_TextSize),
+    m_BackgroundColor        (other.m_BackgroundColor),
+    m_TextColor              (other.m_TextColor),
+    m_SelectedBackgroundColor(other.m_SelectedBackgroundColor),
+    m_SelectedTextColor      (other.m_SelectedTextColor),
+    m_BorderColor            (other.m_BorderColor),
+    m_HeaderBackgroundColor  (other.m_HeaderBackgroundColor),
+    m_HeaderTextColor        (other.m_HeaderTextColor),
+    m_TextFont               (other.m_TextFont),
+    m_HeaderVertices         (sf::Quads),
+    m_CellVertices           (sf::Quads),
+    m_TextGeometryNeedsUpdate(true),
+    m_GeometryFirstRow       (0),
+    m_GeometryEndRow         (0)
+    {
+        // Take over the scrollbar
+        m_Scroll = other.m_Scroll;
+        other.m_Scroll = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Table::~Table()
+    {
+        if (m_Scroll != nullptr)
+            delete m_Scroll;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Table& Table::operator= (const Table& right)
+    {
+        if (this != &right)
+        {
+            Table temp(right);
+            this->Widget::operator=(right);
+            this->WidgetBorders::operator=(right);
+
+            // If there already was a scrollbar then delete it now
+            if (m_Scroll != nullptr)
+            {
+                delete m_Scroll;
+                m_Scroll = nullptr;
+            }
+
+            std::swap(m_LoadedConfigFile,        temp.m_LoadedConfigFile);
+            std::swap(m_Columns,                 temp.m_Columns);
+            std::swap(m_RowCount,                temp.m_RowCount);
+            std::swap(m_RowOrder,                temp.m_RowOrder);
+            std::swap(m_SortColumn,              temp.m_SortColumn);
+            std::swap(m_SortAscending,           temp.m_SortAscending);
+            std::swap(m_SelectedRow,             temp.m_SelectedRow);
+            std::swap(m_ResizingColumn,          temp.m_ResizingColumn);
+            std::swap(m_Size,                    temp.m_Size);
+            std::swap(m_RowHeight,               temp.m_RowHeight);
+            std::swap(m_TextSize,                temp.m_TextSize);
+            std::swap(m_Scroll,                  temp.m_Scroll);
+            std::swap(m_BackgroundColor,         temp.m_BackgroundColor);
+            std::swap(m_TextColor,               temp.m_TextColor);
+            std::swap(m_SelectedBackgroundColor, temp.m_SelectedBackgroundColor);
+            std::swap(m_SelectedTextColor,       temp.m_SelectedTextColor);
+            std::swap(m_BorderColor,             temp.m_BorderColor);
+            std::swap(m_HeaderBackgroundColor,   temp.m_HeaderBackgroundColor);
+            std::swap(m_HeaderTextColor,         temp.m_HeaderTextColor);
+            std::swap(m_TextFont,                temp.m_TextFont);
+
+            m_TextGeometryNeedsUpdate = true;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Table& Table::operator= (Table&& right)
+    {
+        if (this != &right)
+        {
+            this->Widget::operator=(std::move(right));
+            this->WidgetBorders::operator=(right);
+
+            std::swap(m_LoadedConfigFile,        right.m_LoadedConfigFile);
+            std::swap(m_Columns,                 right.m_Columns);
+            std::swap(m_RowCount,                right.m_RowCount);
+            std::swap(m_RowOrder,                right.m_RowOrder);
+            std::swap(m_SortColumn,              right.m_SortColumn);
+            std::swap(m_SortAscending,           right.m_SortAscending);
+            std::swap(m_SelectedRow,             right.m_SelectedRow);
+            std::swap(m_ResizingColumn,          right.m_ResizingColumn);
+            std::swap(m_Size,                    right.m_Size);
+            std::swap(m_RowHeight,               right.m_RowHeight);
+            std::swap(m_TextSize,                right.m_TextSize);
+            std::swap(m_Scroll,                  right.m_Scroll);
+            std::swap(m_BackgroundColor,         right.m_BackgroundColor);
+            std::swap(m_TextColor,               right.m_TextColor);
+            std::swap(m_SelectedBackgroundColor, right.m_SelectedBackgroundColor);
+            std::swap(m_SelectedTextColor,       right.m_SelectedTextColor);
+            std::swap(m_BorderColor,             right.m_BorderColor);
+            std::swap(m_HeaderBackgroundColor,   right.m_HeaderBackgroundColor);
+            std::swap(m_HeaderTextColor,         right.m_HeaderTextColor);
+            std::swap(m_TextFont,                right.m_TextFont);
+
+            m_TextGeometryNeedsUpdate = true;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Table* Table::clone()
+    {
+        return new Table(*this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Table::load(const std::string& configFileFilename)
+    {
+        m_LoadedConfigFile = getResourcePath() + configFileFilename;
+
+        // If there already was a scrollbar then delete it now
+        if (m_Scroll != nullptr)
+        {
+            delete m_Scroll;
+            m_Scroll = nullptr;
+        }
+
+        m_TextGeometryNeedsUpdate = true;
+
+        // Open the config file
+        ConfigFile configFile;
+        if (!configFile.open(m_LoadedConfigFile))
+        {
+            TGUI_OUTPUT("TGUI error: Failed to open " + m_LoadedConfigFile + ".");
+            return false;
+        }
+
+        // Read the properties and their values (as strings)
+        std::vector<std::string> properties;
+        std::vector<std::string> values;
+        if (!configFile.read("Table", properties, values))
+        {
+            TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
+            return false;
+        }
+
+        // Close the config file
+        configFile.close();
+
+        // Find the folder that contains the config file
+        std::string configFileFolder = "";
+        std::string::size_type slashPos = configFileFilename.find_last_of("/\\");
+        if (slashPos != std::string::npos)
+            configFileFolder = configFileFilename.substr(0, slashPos+1);
+
+        // Handle the read properties
+        for (unsigned int i = 0; i < properties.size(); ++i)
+        {
+            std::string property = properties[i];
+            std::string value = values[i];
+
+            if (property == "backgroundcolor")
+            {
+                setBackgroundColor(extractColor(value));
+            }
+            else if (property == "textcolor")
+            {
+                setTextColor(extractColor(value));
+            }
+            else if (property == "selectedbackgroundcolor")
+            {
+                setSelectedBackgroundColor(extractColor(value));
+            }
+            else if (property == "selectedtextcolor")
+            {
+                setSelectedTextColor(extractColor(value));
+            }
+            else if (property == "bordercolor")
+            {
+                setBorderColor(extractColor(value));
+            }
+            else if (property == "headerbackgroundcolor")
+            {
+                setHeaderBackgroundColor(extractColor(value));
+            }
+            else if (property == "headertextcolor")
+            {
+                setHeaderTextColor(extractColor(value));
+            }
+            else if (property == "borders")
+            {
+                Borders borders;
+                if (extractBorders(value, borders))
+                    setBorders(borders.left, borders.top, borders.right, borders.bottom);
+            }
+            else if (property == "scrollbar")
+            {
+                if ((value.length() < 3) || (value[0] != '"') || (value[value.length()-1] != '"'))
+                {
+                    TGUI_OUTPUT("TGUI error: Failed to parse value for Scrollbar in section Table in " + m_LoadedConfigFile + ".");
+                    return false;
+                }
+
+                // load the scrollbar and check if it failed
+                m_Scroll = new Scrollbar();
+                if (m_Scroll->load(configFileFolder + value.substr(1, value.length()-2)) == false)
+                {
+                    // The scrollbar couldn't be loaded so it must be deleted
+                    delete m_Scroll;
+                    m_Scroll = nullptr;
+
+                    return false;
+                }
+                else // The scrollbar was loaded successfully
+                {
+                    m_Scroll->setVerticalScroll(true);
+                    updateScrollbar();
+                }
+            }
+            else
+                TGUI_OUTPUT("TGUI warning: Unrecognized property '" + property + "' in section Table in " + m_LoadedConfigFile + ".");
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& Table::getLoadedConfigFile() const
+    {
+        return m_LoadedConfigFile;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::setSize(float width, float height)
+    {
+        invalidate();
+
+        // A negative size is not allowed for this widget
+        if (width  < 0) width  = -width;
+        if (height < 0) height = -height;
+
+        // There is a minimum width
+        if (m_Scroll == nullptr)
+            width = TGUI_MAXIMUM(50.f, width);
+        else
+            width = TGUI_MAXIMUM(50.f + m_Scroll->getSize().x, width);
+
+        // The header and at least one row have to fit inside the table
+        if (height < 2 * m_RowHeight)
+            height = static_cast<float>(2 * m_RowHeight);
+
+        // Store the values
+        m_Size.x = static_cast<unsigned int>(width);
+        m_Size.y = static_cast<unsigned int>(height);
+
+        updateScrollbar();
+
+        m_TextGeometryNeedsUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2f Table::getSize() const
+    {
+        return sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_Size.y));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2f Table::getFullSize() const
+    {
+        return sf::Vector2f(getSize().x + m_LeftBorder + m_RightBorder,
+                            getSize().y + m_TopBorder + m_BottomBorder);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::changeColors(const sf::Color& backgroundColor,         const sf::Color& textColor,
+                             const sf::Color& selectedBackgroundColor, const sf::Color& selectedTextColor,
+                             const sf::Color& borderColor,             const sf::Color& headerBackgroundColor,
+                             const sf::Color& headerTextColor)
+    {
+        invalidate();
+
+        m_BackgroundColor         = backgroundColor;
+        m_TextColor               = textColor;
+        m_SelectedBackgroundColor = selectedBackgroundColor;
+        m_SelectedTextColor       = selectedTextColor;
+        m_BorderColor             = borderColor;
+        m_HeaderBackgroundColor   = headerBackgroundColor;
+        m_HeaderTextColor         = headerTextColor;
+
+        m_TextGeometryNeedsUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::setBackgroundColor(const sf::Color& backgroundColor)
+    {
+        invalidate();
+
+        m_BackgroundColor = backgroundColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::setTextColor(const sf::Color& textColor)
+    {
+        invalidate();
+
+        m_TextColor = textColor;
+        m_TextGeometryNeedsUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
+    {
+        invalidate();
+
+        m_SelectedBackgroundColor = selectedBackgroundColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::setSelectedTextColor(const sf::Color& selectedTextColor)
+    {
+        invalidate();
+
+        m_SelectedTextColor = selectedTextColor;
+        m_TextGeometryNeedsUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::setBorderColor(const sf::Color& borderColor)
+    {
+        invalidate();
+
+        m_BorderColor = borderColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::setHeaderBackgroundColor(const sf::Color& headerBackgroundColor)
+    {
+        invalidate();
+
+        m_HeaderBackgroundColor = headerBackgroundColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::setHeaderTextColor(const sf::Color& headerTextColor)
+    {
+        invalidate();
+
+        m_HeaderTextColor = headerTextColor;
+        m_TextGeometryNeedsUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Color& Table::getBackgroundColor() const
+    {
+        return m_BackgroundColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Color& Table::getTextColor() const
+    {
+        return m_TextColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Color& Table::getSelectedBackgroundColor() const
+    {
+        return m_SelectedBackgroundColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Color& Table::getSelectedTextColor() const
+    {
+        return m_SelectedTextColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Color& Table::getBorderColor() const
+    {
+        return m_BorderColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Color& Table::getHeaderBackgroundColor() const
+    {
+        return m_HeaderBackgroundColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Color& Table::getHeaderTextColor() const
+    {
+        return m_HeaderTextColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::setTextFont(const sf::Font& font)
+    {
+        invalidate();
+
+        m_TextFont = &font;
+        m_TextGeometryNeedsUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Font* Table::getTextFont() const
+    {
+        return m_TextFont;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Table::addColumn(const sf::String& caption, unsigned int width)
+    {
+        invalidate();
+
+        Column column;
+        column.caption = caption;
+        column.width = TGUI_MAXIMUM(width, 10u);
+        column.cells.resize(m_RowCount);
+        m_Columns.push_back(std::move(column));
+
+        m_TextGeometryNeedsUpdate = true;
+        return m_Columns.size() - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::removeAllColumns()
+    {
+        invalidate();
+
+        m_Columns.clear();
+        m_SortColumn = -1;
+        m_ResizingColumn = -1;
+
+        removeAllRows();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Table::getColumnCount() const
+    {
+        return m_Columns.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Table::setColumnCaption(unsigned int column, const sf::String& caption)
+    {
+        if (column >= m_Columns.size())
+        {
+            TGUI_OUTPUT("TGUI error: Column " + to_string(column) + " does not exist.");
+            return false;
+        }
+
+        invalidate();
+
+        m_Columns[column].caption = caption;
+        m_TextGeometryNeedsUpdate = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String Table::getColumnCaption(unsigned int column) const
+    {
+        if (column < m_Columns.size())
+            return m_Columns[column].caption;
+        else
+            return "";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Table::setColumnWidth(unsigned int column, unsigned int width)
+    {
+        if (column >= m_Columns.size())
+        {
+            TGUI_OUTPUT("TGUI error: Column " + to_string(column) + " does not exist.");
+            return false;
+        }
+
+        invalidate();
+
+        // There is a minimum width
+        m_Columns[column].width = TGUI_MAXIMUM(width, 10u);
+        m_TextGeometryNeedsUpdate = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Table::getColumnWidth(unsigned int column) const
+    {
+        if (column < m_Columns.size())
+            return m_Columns[column].width;
+        else
+            return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int Table::addRow(const std::vector<sf::String>& cells)
+    {
+        if (m_Columns.empty())
+        {
+            TGUI_OUTPUT("TGUI error: Can't add a row to a table without columns.");
+            return -1;
+        }
+
+        invalidate();
+
+        for (unsigned int i = 0; i < m_Columns.size(); ++i)
+        {
+            if (i < cells.size())
+                m_Columns[i].cells.push_back(cells[i]);
+            else
+                m_Columns[i].cells.push_back("");
+        }
+
+        const unsigned int row = m_RowCount++;
+        insertIntoRowOrder(row);
+
+        updateScrollbar();
+
+        m_TextGeometryNeedsUpdate = true;
+        return static_cast<int>(row);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Table::setCell(unsigned int row, unsigned int column, const sf::String& value)
+    {
+        if ((row >= m_RowCount) || (column >= m_Columns.size()))
+        {
+            TGUI_OUTPUT("TGUI error: Cell (" + to_string(row) + "," + to_string(column) + ") does not exist.");
+            return false;
+        }
+
+        invalidate();
+
+        m_Columns[column].cells[row] = value;
+
+        // When the rows are sorted by this column then the row may have to move
+        if (m_SortColumn == static_cast<int>(column))
+        {
+            m_RowOrder.erase(std::find(m_RowOrder.begin(), m_RowOrder.end(), row));
+            insertIntoRowOrder(row);
+        }
+
+        m_TextGeometryNeedsUpdate = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String Table::getCell(unsigned int row, unsigned int column) const
+    {
+        if ((row < m_RowCount) && (column < m_Columns.size()))
+            return m_Columns[column].cells[row];
+        else
+            return "";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Table::removeRow(unsigned int row)
+    {
+        if (row >= m_RowCount)
+        {
+            TGUI_OUTPUT("TGUI error: Row " + to_string(row) + " does not exist.");
+            return false;
+        }
+
+        invalidate();
+
+        for (auto it = m_Columns.begin(); it != m_Columns.end(); ++it)
+            it->cells.erase(it->cells.begin() + row);
+
+        --m_RowCount;
+
+        // Remove the row from the displayed order and lower the indices of the rows behind it in a single pass
+        unsigned int j = 0;
+        for (unsigned int i = 0; i < m_RowOrder.size(); ++i)
+        {
+            if (m_RowOrder[i] == row)
+                continue;
+
+            m_RowOrder[j++] = (m_RowOrder[i] > row) ? m_RowOrder[i] - 1 : m_RowOrder[i];
+        }
+        m_RowOrder.resize(j);
+
+        // Update the selected row
+        if (m_SelectedRow == static_cast<int>(row))
+            m_SelectedRow = -1;
+        else if (m_SelectedRow > static_cast<int>(row))
+            --m_SelectedRow;
+
+        updateScrollbar();
+
+        m_TextGeometryNeedsUpdate = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::removeAllRows()
+    {
+        invalidate();
+
+        for (auto it = m_Columns.begin(); it != m_Columns.end(); ++it)
+            it->cells.clear();
+
+        m_RowCount = 0;
+        m_RowOrder.clear();
+        m_SelectedRow = -1;
+
+        updateScrollbar();
+
+        m_TextGeometryNeedsUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Table::getRowCount() const
+    {
+        return m_RowCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Table::sortByColumn(unsigned int column, bool ascending)
+    {
+        if (column >= m_Columns.size())
+        {
+            TGUI_OUTPUT("TGUI error: Column " + to_string(column) + " does not exist.");
+            return false;
+        }
+
+        invalidate();
+
+        m_SortColumn = static_cast<int>(column);
+        m_SortAscending = ascending;
+
+        // Only the indices are sorted, the cells themselves never move
+        std::sort(m_RowOrder.begin(), m_RowOrder.end(), [this](unsigned int left, unsigned int right) { return rowComesBefore(left, right); });
+
+        m_TextGeometryNeedsUpdate = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::removeSorting()
+    {
+        invalidate();
+
+        m_SortColumn = -1;
+        m_SortAscending = true;
+
+        for (unsigned int i = 0; i < m_RowOrder.size(); ++i)
+            m_RowOrder[i] = i;
+
+        m_TextGeometryNeedsUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int Table::getSortColumn() const
+    {
+        return m_SortColumn;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Table::isSortedAscending() const
+    {
+        return m_SortAscending;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Table::setSelectedRow(int row)
+    {
+        invalidate();
+
+        if (row < 0)
+        {
+            deselectRow();
+            return true;
+        }
+
+        // If the index is too high then deselect the row
+        if (row > static_cast<int>(m_RowCount)-1)
+        {
+            m_SelectedRow = -1;
+            m_TextGeometryNeedsUpdate = true;
+            return false;
+        }
+
+        // Select the row
+        m_SelectedRow = row;
+        m_TextGeometryNeedsUpdate = true;
+
+        // Move the scrollbar if needed
+        if (m_Scroll != nullptr)
+        {
+            const unsigned int position = std::find(m_RowOrder.begin(), m_RowOrder.end(), static_cast<unsigned int>(row)) - m_RowOrder.begin();
+
+            if (position * m_RowHeight < m_Scroll->getValue())
+                m_Scroll->setValue(position * m_RowHeight);
+            else if ((position + 1) * m_RowHeight > m_Scroll->getValue() + m_Scroll->getLowValue())
+                m_Scroll->setValue((position + 1) * m_RowHeight - m_Scroll->getLowValue());
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::deselectRow()
+    {
+        invalidate();
+
+        m_SelectedRow = -1;
+        m_TextGeometryNeedsUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int Table::getSelectedRow() const
+    {
+        return m_SelectedRow;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Table::setScrollbar(const std::string& scrollbarConfigFileFilename)
+    {
+        invalidate();
+
+        m_TextGeometryNeedsUpdate = true;
+
+        // Calling setScrollbar with an empty string does the same as removeScrollbar
+        if (scrollbarConfigFileFilename.empty() == true)
+        {
+            removeScrollbar();
+            return true;
+        }
+
+        // If the scrollbar was already created then delete it first
+        if (m_Scroll != nullptr)
+            delete m_Scroll;
+
+        // load the scrollbar and check if it failed
+        m_Scroll = new Scrollbar();
+        if(m_Scroll->load(scrollbarConfigFileFilename) == false)
+        {
+            // The scrollbar couldn't be loaded so it must be deleted
+            delete m_Scroll;
+            m_Scroll = nullptr;
+
+            return false;
+        }
+        else // The scrollbar was loaded successfully
+        {
+            m_Scroll->setVerticalScroll(true);
+            updateScrollbar();
+
+            return true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::removeScrollbar()
+    {
+        invalidate();
+
+        // Delete the scrollbar
+        delete m_Scroll;
+        m_Scroll = nullptr;
+
+        m_TextGeometryNeedsUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::setRowHeight(unsigned int rowHeight)
+    {
+        invalidate();
+
+        // There is a minimum height
+        if (rowHeight < 10)
+            rowHeight = 10;
+
+        // Set the new heights
+        m_RowHeight = rowHeight;
+        m_TextSize  = static_cast<unsigned int>(rowHeight * 0.8f);
+
+        // The header and at least one row have to fit inside the table
+        if (m_Size.y < 2 * m_RowHeight)
+            m_Size.y = 2 * m_RowHeight;
+
+        // The header also became higher, so the scrollbar has to be resized
+        updateScrollbar();
+
+        m_TextGeometryNeedsUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Table::getRowHeight() const
+    {
+        return m_RowHeight;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
+    {
+        invalidate();
+
+        m_LeftBorder   = leftBorder;
+        m_TopBorder    = topBorder;
+        m_RightBorder  = rightBorder;
+        m_BottomBorder = bottomBorder;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::setTransparency(unsigned char transparency)
+    {
+        invalidate();
+
+        Widget::setTransparency(transparency);
+
+        if (m_Scroll != nullptr)
+            m_Scroll->setTransparency(m_Opacity);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Table::mouseOnWidget(float x, float y)
+    {
+        // Get the current position
+        sf::Vector2f position = getPosition();
+
+        // Pass the event to the scrollbar (if there is one)
+        if (m_Scroll != nullptr)
+        {
+            // Temporarily set the position of the scroll
+            m_Scroll->setPosition(position.x + m_Size.x - m_Scroll->getSize().x, position.y + m_RowHeight);
+
+            // Pass the event
+            m_Scroll->mouseOnWidget(x, y);
+
+            // Reset the position
+            m_Scroll->setPosition(0, 0);
+        }
+
+        // Check if the mouse is on top of the table
+        if (getTransform().transformRect(sf::FloatRect(0, 0, static_cast<float>(m_Size.x), static_cast<float>(m_Size.y))).contains(x, y))
+            return true;
+        else // The mouse is not on top of the table
+        {
+            if (m_MouseHover)
+                mouseLeftWidget();
+
+            m_MouseHover = false;
+            return false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::leftMousePressed(float x, float y)
+    {
+        // Set the mouse down flag to true
+        m_MouseDown = true;
+
+        // If there is a scrollbar then pass the event
+        if (m_Scroll != nullptr)
+        {
+            // Temporarily set the position of the scroll
+            m_Scroll->setPosition(getPosition().x + m_Size.x - m_Scroll->getSize().x, getPosition().y + m_RowHeight);
+
+            // Pass the event
+            bool clickedOnScrollbar = m_Scroll->mouseOnWidget(x, y);
+            if (clickedOnScrollbar)
+                m_Scroll->leftMousePressed(x, y);
+
+            // Reset the position
+            m_Scroll->setPosition(0, 0);
+
+            if (clickedOnScrollbar)
+                return;
+        }
+
+        x -= getPosition().x;
+        y -= getPosition().y;
+
+        // Check if the click occurred on the header
+        if (y < m_RowHeight)
+        {
+            // Start resizing the column when the line behind it was clicked
+            m_ResizingColumn = getColumnSeparatorAt(x);
+            if (m_ResizingColumn >= 0)
+                return;
+
+            // Clicking on a header sorts the rows by that column, clicking on it again reverses the order
+            int column = getColumnAt(x);
+            if (column >= 0)
+            {
+                if (m_SortColumn == column)
+                    sortByColumn(column, !m_SortAscending);
+                else
+                    sortByColumn(column, true);
+
+                // Add the callback (if the user requested it)
+                if (m_CallbackFunctions[HeaderClicked].empty() == false)
+                {
+                    m_Callback.text    = m_Columns[column].caption;
+                    m_Callback.value   = column;
+                    m_Callback.trigger = HeaderClicked;
+                    addCallback();
+                }
+            }
+
+            return;
+        }
+
+        // Remember the old selected row
+        int oldSelectedRow = m_SelectedRow;
+
+        // Calculate on which row we clicked
+        unsigned int position = static_cast<unsigned int>(y - m_RowHeight);
+        if ((m_Scroll != nullptr) && (m_Scroll->getLowValue() < m_Scroll->getMaximum()))
+            position += m_Scroll->getValue();
+        position /= m_RowHeight;
+
+        // When you clicked behind the last row then unselect the selected row
+        if (position >= m_RowCount)
+            m_SelectedRow = -1;
+        else
+            m_SelectedRow = static_cast<int>(m_RowOrder[position]);
+
+        if (oldSelectedRow != m_SelectedRow)
+        {
+            invalidate();
+            m_TextGeometryNeedsUpdate = true;
+
+            // Add the callback (if the user requested it)
+            if (m_CallbackFunctions[RowSelected].empty() == false)
+            {
+                // When no row is selected then send an empty string, otherwise send the text of the first column
+                if (m_SelectedRow < 0)
+                    m_Callback.text = "";
+                else
+                    m_Callback.text = m_Columns[0].cells[m_SelectedRow];
+
+                m_Callback.value   = m_SelectedRow;
+                m_Callback.trigger = RowSelected;
+                addCallback();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::leftMouseReleased(float x, float y)
+    {
+        // If there is a scrollbar then pass it the event
+        if (m_Scroll != nullptr)
+        {
+            // Remember the old scrollbar value
+            unsigned int oldValue = m_Scroll->getValue();
+
+            // Temporarily set the position of the scroll
+            m_Scroll->setPosition(getPosition().x + (m_Size.x - m_Scroll->getSize().x), getPosition().y + m_RowHeight);
+
+            // Pass the event
+            m_Scroll->leftMouseReleased(x, y);
+
+            // Reset the position
+            m_Scroll->setPosition(0, 0);
+
+            // Check if the scrollbar value was incremented (you have pressed on the down arrow)
+            if (m_Scroll->getValue() == oldValue + 1)
+            {
+                // Decrement the value
+                m_Scroll->setValue(m_Scroll->getValue()-1);
+
+                // Scroll down with the whole row height instead of with a single pixel
+                m_Scroll->setValue(m_Scroll->getValue() + m_RowHeight - (m_Scroll->getValue() % m_RowHeight));
+            }
+            else if (m_Scroll->getValue() == oldValue - 1) // Check if the scrollbar value was decremented (you have pressed on the up arrow)
+            {
+                // increment the value
+                m_Scroll->setValue(m_Scroll->getValue()+1);
+
+                // Scroll up with the whole row height instead of with a single pixel
+                if (m_Scroll->getValue() % m_RowHeight > 0)
+                    m_Scroll->setValue(m_Scroll->getValue() - (m_Scroll->getValue() % m_RowHeight));
+                else
+                    m_Scroll->setValue(m_Scroll->getValue() - m_RowHeight);
+            }
+        }
+
+        m_ResizingColumn = -1;
+        m_MouseDown = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::mouseMoved(float x, float y)
+    {
+        if (m_MouseHover == false)
+            mouseEnteredWidget();
+
+        m_MouseHover = true;
+
+        // Change the width of the column while the line behind its header is being dragged
+        if (m_MouseDown && (m_ResizingColumn >= 0))
+        {
+            float columnLeft = 0;
+            for (int i = 0; i < m_ResizingColumn; ++i)
+                columnLeft += m_Columns[i].width;
+
+            const float width = x - getPosition().x - columnLeft;
+            setColumnWidth(m_ResizingColumn, (width > 0) ? static_cast<unsigned int>(width) : 0);
+            return;
+        }
+
+        // If there is a scrollbar then pass the event
+        if (m_Scroll != nullptr)
+        {
+            // Temporarily set the position of the scroll
+            m_Scroll->setPosition(getPosition().x + (m_Size.x - m_Scroll->getSize().x), getPosition().y + m_RowHeight);
+
+            // Check if you are dragging the thumb of the scrollbar
+            if ((m_Scroll->m_MouseDown) && (m_Scroll->m_MouseDownOnThumb))
+            {
+                // Pass the event, even when the mouse is not on top of the scrollbar
+                m_Scroll->mouseMoved(x, y);
+            }
+            else // You are just moving the mouse
+            {
+                // When the mouse is on top of the scrollbar then pass the mouse move event
+                if (m_Scroll->mouseOnWidget(x, y))
+                    m_Scroll->mouseMoved(x, y);
+            }
+
+            // Reset the position
+            m_Scroll->setPosition(0, 0);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::mouseWheelMoved(int delta, int, int)
+    {
+        // Only do something when there is a scrollbar
+        if (m_Scroll != nullptr)
+        {
+            if (m_Scroll->getLowValue() < m_Scroll->getMaximum())
+            {
+                // Check if you are scrolling down
+                if (delta < 0)
+                {
+                    // Scroll down
+                    m_Scroll->setValue(m_Scroll->getValue() + (static_cast<unsigned int>(-delta) * (m_RowHeight / 2)));
+                }
+                else // You are scrolling up
+                {
+                    unsigned int change = static_cast<unsigned int>(delta) * (m_RowHeight / 2);
+
+                    // Scroll up
+                    if (change < m_Scroll->getValue())
+                        m_Scroll->setValue(m_Scroll->getValue() - change);
+                    else
+                        m_Scroll->setValue(0);
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::mouseNotOnWidget()
+    {
+        if (m_MouseHover)
+            mouseLeftWidget();
+
+        m_MouseHover = false;
+
+        if (m_Scroll != nullptr)
+            m_Scroll->m_MouseHover = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::mouseNoLongerDown()
+    {
+        m_MouseDown = false;
+        m_ResizingColumn = -1;
+
+        if (m_Scroll != nullptr)
+            m_Scroll->m_MouseDown = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Table::setProperty(std::string property, const std::string& value)
+    {
+        property = toLower(property);
+
+        if (property == "configfile")
+        {
+            load(value);
+        }
+        else if (property == "backgroundcolor")
+        {
+            setBackgroundColor(extractColor(value));
+        }
+        else if (property == "textcolor")
+        {
+            setTextColor(extractColor(value));
+        }
+        else if (property == "selectedbackgroundcolor")
+        {
+            setSelectedBackgroundColor(extractColor(value));
+        }
+        else if (property == "selectedtextcolor")
+        {
+            setSelectedTextColor(extractColor(value));
+        }
+        else if (property == "bordercolor")
+        {
+            setBorderColor(extractColor(value));
+        }
+        else if (property == "headerbackgroundcolor")
+        {
+            setHeaderBackgroundColor(extractColor(value));
+        }
+        else if (property == "headertextcolor")
+        {
+            setHeaderTextColor(extractColor(value));
+        }
+        else if (property == "rowheight")
+        {
+            setRowHeight(atoi(value.c_str()));
+        }
+        else if (property == "borders")
+        {
+            Borders borders;
+            if (extractBorders(value, borders))
+                setBorders(borders.left, borders.top, borders.right, borders.bottom);
+            else
+                TGUI_OUTPUT("TGUI error: Failed to parse 'Borders' property.");
+        }
+        else if (property == "columns")
+        {
+            std::vector<sf::String> captions;
+            decodeList(value, captions);
+
+            removeAllColumns();
+            for (auto it = captions.cbegin(); it != captions.cend(); ++it)
+                addColumn(*it);
+        }
+        else if (property == "selectedrow")
+        {
+            setSelectedRow(atoi(value.c_str()));
+        }
+        else if (property == "callback")
+        {
+            Widget::setProperty(property, value);
+
+            std::vector<sf::String> callbacks;
+            decodeList(value, callbacks);
+
+            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+            {
+                if ((*it == "RowSelected") || (*it == "rowselected"))
+                    bindCallback(RowSelected);
+                else if ((*it == "HeaderClicked") || (*it == "headerclicked"))
+                    bindCallback(HeaderClicked);
+            }
+        }
+        else // The property didn't match
+            return Widget::setProperty(property, value);
+
+        // You pass here when one of the properties matched
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Table::getProperty(std::string property, std::string& value) const
+    {
+        property = toLower(property);
+
+        if (property == "configfile")
+            value = getLoadedConfigFile();
+        else if (property == "backgroundcolor")
+            value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
+        else if (property == "textcolor")
+            value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
+        else if (property == "selectedbackgroundcolor")
+            value = "(" + to_string(int(getSelectedBackgroundColor().r)) + "," + to_string(int(getSelectedBackgroundColor().g))
+                    + "," + to_string(int(getSelectedBackgroundColor().b)) + "," + to_string(int(getSelectedBackgroundColor().a)) + ")";
+        else if (property == "selectedtextcolor")
+            value = "(" + to_string(int(getSelectedTextColor().r)) + "," + to_string(int(getSelectedTextColor().g))
+                    + "," + to_string(int(getSelectedTextColor().b)) + "," + to_string(int(getSelectedTextColor().a)) + ")";
+        else if (property == "bordercolor")
+            value = "(" + to_string(int(getBorderColor().r)) + "," + to_string(int(getBorderColor().g)) + "," + to_string(int(getBorderColor().b)) + "," + to_string(int(getBorderColor().a)) + ")";
+        else if (property == "headerbackgroundcolor")
+            value = "(" + to_string(int(getHeaderBackgroundColor().r)) + "," + to_string(int(getHeaderBackgroundColor().g))
+                    + "," + to_string(int(getHeaderBackgroundColor().b)) + "," + to_string(int(getHeaderBackgroundColor().a)) + ")";
+        else if (property == "headertextcolor")
+            value = "(" + to_string(int(getHeaderTextColor().r)) + "," + to_string(int(getHeaderTextColor().g))
+                    + "," + to_string(int(getHeaderTextColor().b)) + "," + to_string(int(getHeaderTextColor().a)) + ")";
+        else if (property == "rowheight")
+            value = to_string(getRowHeight());
+        else if (property == "borders")
+            value = "(" + to_string(getBorders().left) + "," + to_string(getBorders().top) + "," + to_string(getBorders().right) + "," + to_string(getBorders().bottom) + ")";
+        else if (property == "columns")
+        {
+            std::vector<sf::String> captions;
+            for (auto it = m_Columns.cbegin(); it != m_Columns.cend(); ++it)
+                captions.push_back(it->caption);
+
+            encodeList(captions, value);
+        }
+        else if (property == "selectedrow")
+            value = to_string(getSelectedRow());
+        else if (property == "callback")
+        {
+            std::string tempValue;
+            Widget::getProperty(property, tempValue);
+
+            std::vector<sf::String> callbacks;
+
+            if ((m_CallbackFunctions.find(RowSelected) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(RowSelected).size() == 1) && (m_CallbackFunctions.at(RowSelected).front() == nullptr))
+                callbacks.push_back("RowSelected");
+            if ((m_CallbackFunctions.find(HeaderClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(HeaderClicked).size() == 1) && (m_CallbackFunctions.at(HeaderClicked).front() == nullptr))
+                callbacks.push_back("HeaderClicked");
+
+            encodeList(callbacks, value);
+
+            if (value.empty() || tempValue.empty())
+                value += tempValue;
+            else
+                value += "," + tempValue;
+        }
+        else // The property didn't match
+            return Widget::getProperty(property, value);
+
+        // You pass here when one of the properties matched
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::list< std::pair<std::string, std::string> > Table::getPropertyList() const
+    {
+        auto list = Widget::getPropertyList();
+        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
+        list.push_back(std::pair<std::string, std::string>("BackgroundColor", "color"));
+        list.push_back(std::pair<std::string, std::string>("TextColor", "color"));
+        list.push_back(std::pair<std::string, std::string>("SelectedBackgroundColor", "color"));
+        list.push_back(std::pair<std::string, std::string>("SelectedTextColor", "color"));
+        list.push_back(std::pair<std::string, std::string>("BorderColor", "color"));
+        list.push_back(std::pair<std::string, std::string>("HeaderBackgroundColor", "color"));
+        list.push_back(std::pair<std::string, std::string>("HeaderTextColor", "color"));
+        list.push_back(std::pair<std::string, std::string>("RowHeight", "uint"));
+        list.push_back(std::pair<std::string, std::string>("Borders", "borders"));
+        list.push_back(std::pair<std::string, std::string>("Columns", "string"));
+        list.push_back(std::pair<std::string, std::string>("SelectedRow", "int"));
+        return list;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::initialize(Container *const parent)
+    {
+        m_Parent = parent;
+        setTextFont(m_Parent->getGlobalFont());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        const sf::View& view = target.getView();
+
+        // Calculate the scale factor of the view
+        float scaleViewX = target.getSize().x / view.getSize().x;
+        float scaleViewY = target.getSize().y / view.getSize().y;
+
+        // The rows are clipped to the area below the header and left of the scrollbar
+        const unsigned int contentWidth = getContentWidth();
+        sf::Vector2f topLeftPosition = sf::Vector2f(((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
+                                                    ((getAbsolutePosition().y + m_RowHeight - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
+        sf::Vector2f bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + contentWidth - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
+                                                        (getAbsolutePosition().y + m_Size.y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
+
+        // Adjust the transformation
+        states.transform *= getTransform();
+
+        // Remember the current transformation
+        sf::Transform oldTransform = states.transform;
+
+        // Draw the borders
+        {
+            // Draw left border
+            sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y + m_TopBorder)));
+            border.setPosition(-static_cast<float>(m_LeftBorder), -static_cast<float>(m_TopBorder));
+            border.setFillColor(m_BorderColor);
+            target.draw(border, states);
+
+            // Draw top border
+            border.setSize(sf::Vector2f(static_cast<float>(m_Size.x + m_RightBorder), static_cast<float>(m_TopBorder)));
+            border.setPosition(0, -static_cast<float>(m_TopBorder));
+            target.draw(border, states);
+
+            // Draw right border
+            border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), static_cast<float>(m_Size.y + m_BottomBorder)));
+            border.setPosition(static_cast<float>(m_Size.x), 0);
+            target.draw(border, states);
+
+            // Draw bottom border
+            border.setSize(sf::Vector2f(static_cast<float>(m_Size.x + m_LeftBorder), static_cast<float>(m_BottomBorder)));
+            border.setPosition(-static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y));
+            target.draw(border, states);
+        }
+
+        // Draw the background
+        sf::RectangleShape front(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_Size.y)));
+        front.setFillColor(m_BackgroundColor);
+        target.draw(front, states);
+
+        // Draw the background of the header
+        sf::RectangleShape header(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_RowHeight)));
+        header.setFillColor(m_HeaderBackgroundColor);
+        target.draw(header, states);
+
+        // Draw the lines between the headers
+        {
+            sf::RectangleShape line(sf::Vector2f(1, static_cast<float>(m_RowHeight)));
+            line.setFillColor(m_BorderColor);
+
+            float left = 0;
+            for (auto it = m_Columns.cbegin(); (it != m_Columns.cend()) && (left < contentWidth); ++it)
+            {
+                left += it->width;
+                line.setPosition(left - 1, 0);
+                target.draw(line, states);
+            }
+        }
+
+        // Find out which rows are visible
+        unsigned int scrollValue = 0;
+        if ((m_Scroll != nullptr) && (m_Scroll->getLowValue() < m_Scroll->getMaximum()))
+            scrollValue = m_Scroll->getValue();
+
+        const unsigned int firstRow = scrollValue / m_RowHeight;
+        // The last row may only be partially visible, the area below the header is m_Size.y - m_RowHeight pixels high
+        const unsigned int endRow = TGUI_MINIMUM((scrollValue + m_Size.y - 1) / m_RowHeight, m_RowCount);
+
+        // The text only has to be recreated when other rows became visible or when it was changed
+        if (m_TextGeometryNeedsUpdate || (firstRow != m_GeometryFirstRow) || (endRow != m_GeometryEndRow))
+            updateTextGeometry(firstRow, endRow);
+
+        if (m_TextFont != nullptr)
+            states.texture = &m_TextFont->getTexture(m_TextSize);
+
+        // Draw the text in the header
+        target.draw(m_HeaderVertices, states);
+
+        // Get the old clipping area
+        GLint scissor[4];
+        glGetIntegerv(GL_SCISSOR_BOX, scissor);
+
+        // Calculate the clipping area
+        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
+        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
+        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
+        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
+
+        // If the widget outside the window then don't draw anything
+        if (scissorRight < scissorLeft)
+            scissorRight = scissorLeft;
+        else if (scissorBottom < scissorTop)
+            scissorTop = scissorBottom;
+
+        // Set the clipping area
+        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+
+        // The rows are positioned below the header and move up when scrolling down
+        states.transform.translate(0, static_cast<float>(m_RowHeight) - static_cast<float>(scrollValue));
+
+        // Draw a background for the selected row when it is visible
+        if (m_SelectedRow >= 0)
+        {
+            for (unsigned int i = firstRow; i < endRow; ++i)
+            {
+                if (m_RowOrder[i] == static_cast<unsigned int>(m_SelectedRow))
+                {
+                    sf::RectangleShape back(sf::Vector2f(static_cast<float>(contentWidth), static_cast<float>(m_RowHeight)));
+                    back.setPosition(0, static_cast<float>(i * m_RowHeight));
+                    back.setFillColor(m_SelectedBackgroundColor);
+
+                    sf::RenderStates backStates = states;
+                    backStates.texture = nullptr;
+                    target.draw(back, backStates);
+                    break;
+                }
+            }
+        }
+
+        // Draw the text of the visible cells
+        target.draw(m_CellVertices, states);
+
+        // Reset the old clipping area
+        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+
+        // Check if there is a scrollbar
+        if (m_Scroll != nullptr)
+        {
+            // Reset the transformation
+            states.transform = oldTransform;
+            states.transform.translate(static_cast<float>(m_Size.x) - m_Scroll->getSize().x, static_cast<float>(m_RowHeight));
+            states.texture = nullptr;
+
+            // Draw the scrollbar
+            target.draw(*m_Scroll, states);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Table::rowComesBefore(unsigned int left, unsigned int right) const
+    {
+        const std::vector<sf::String>& cells = m_Columns[m_SortColumn].cells;
+
+        if (cells[left] == cells[right])
+            return left < right;
+        else if (m_SortAscending)
+            return cells[left] < cells[right];
+        else
+            return cells[right] < cells[left];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::insertIntoRowOrder(unsigned int row)
+    {
+        if (m_SortColumn < 0)
+        {
+            // Without sorting the rows are displayed in the order of their index
+            m_RowOrder.insert(std::upper_bound(m_RowOrder.begin(), m_RowOrder.end(), row), row);
+        }
+        else
+        {
+            m_RowOrder.insert(std::lower_bound(m_RowOrder.begin(), m_RowOrder.end(), row,
+                                               [this](unsigned int left, unsigned int right) { return rowComesBefore(left, right); }),
+                              row);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Table::getContentWidth() const
+    {
+        if (m_Scroll != nullptr)
+            return m_Size.x - static_cast<unsigned int>(m_Scroll->getSize().x);
+        else
+            return m_Size.x;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int Table::getColumnSeparatorAt(float x) const
+    {
+        float right = 0;
+        for (unsigned int i = 0; i < m_Columns.size(); ++i)
+        {
+            right += m_Columns[i].width;
+            if (std::abs(x - right) <= 3)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int Table::getColumnAt(float x) const
+    {
+        float right = 0;
+        for (unsigned int i = 0; i < m_Columns.size(); ++i)
+        {
+            right += m_Columns[i].width;
+            if (x < right)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::updateScrollbar()
+    {
+        if (m_Scroll == nullptr)
+            return;
+
+        // The scrollbar is placed below the header
+        m_Scroll->setSize(m_Scroll->getSize().x, static_cast<float>(m_Size.y - m_RowHeight));
+        m_Scroll->setLowValue(m_Size.y - m_RowHeight);
+        m_Scroll->setMaximum(m_RowCount * m_RowHeight);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::updateTextGeometry(unsigned int firstRow, unsigned int endRow) const
+    {
+        m_TextGeometryNeedsUpdate = false;
+        m_GeometryFirstRow = firstRow;
+        m_GeometryEndRow = endRow;
+
+        m_HeaderVertices.clear();
+        m_CellVertices.clear();
+
+        if (m_TextFont == nullptr)
+            return;
+
+        // Columns that lie completely behind the right side of the table are skipped
+        const float contentWidth = static_cast<float>(getContentWidth());
+        float left = 0;
+        for (auto it = m_Columns.cbegin(); (it != m_Columns.cend()) && (left < contentWidth); ++it)
+        {
+            const float right = TGUI_MINIMUM(left + it->width, contentWidth);
+
+            addTextGeometry(m_HeaderVertices, it->caption, left + 2, 0, right - 2, m_HeaderTextColor);
+
+            for (unsigned int i = firstRow; i < endRow; ++i)
+            {
+                const unsigned int row = m_RowOrder[i];
+                const sf::Color& color = (static_cast<int>(row) == m_SelectedRow) ? m_SelectedTextColor : m_TextColor;
+                addTextGeometry(m_CellVertices, it->cells[row], left + 2, static_cast<float>(i * m_RowHeight), right - 2, color);
+            }
+
+            left += it->width;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::addTextGeometry(sf::VertexArray& vertices, const sf::String& text, float x, float y, float maxX, const sf::Color& color) const
+    {
+        // The layout is identical to the one of sf::Text, vertically centered inside the row
+        const float hspace = static_cast<float>(m_TextFont->getGlyph(L' ', m_TextSize, false).advance);
+
+        sf::Vector2f position(x, std::floor(y + (m_RowHeight - m_TextSize) / 2.f));
+        sf::Uint32 prevChar = 0;
+        for (unsigned int i = 0; i < text.getSize(); ++i)
+        {
+            sf::Uint32 curChar = text[i];
+
+            // Apply the kerning offset
+            position.x += static_cast<float>(m_TextFont->getKerning(prevChar, curChar, m_TextSize));
+            prevChar = curChar;
+
+            if ((curChar == L' ') || (curChar == L'\t'))
+            {
+                position.x += hspace;
+                continue;
+            }
+            else if (curChar == L'\n')
+                break;
+
+            const sf::Glyph& glyph = m_TextFont->getGlyph(curChar, m_TextSize, false);
+
+            float left   = position.x + glyph.bounds.left;
+            float top    = position.y + m_TextSize + glyph.bounds.top;
+            float right  = left + glyph.bounds.width;
+            float bottom = top + glyph.bounds.height;
+
+            // The rest of the text doesn't fit inside the column
+            if (right > maxX)
+                break;
+
+            float u1 = static_cast<float>(glyph.textureRect.left);
+            float v1 = static_cast<float>(glyph.textureRect.top);
+            float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width);
+            float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height);
+
+            vertices.append(sf::Vertex(sf::Vector2f(left, top), color, sf::Vector2f(u1, v1)));
+            vertices.append(sf::Vertex(sf::Vector2f(right, top), color, sf::Vector2f(u2, v1)));
+            vertices.append(sf::Vertex(sf::Vector2f(right, bottom), color, sf::Vector2f(u2, v2)));
+            vertices.append(sf::Vertex(sf::Vector2f(left, bottom), color, sf::Vector2f(u1, v2)));
+
+            position.x += static_cast<float>(glyph.advance);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
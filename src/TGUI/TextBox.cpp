@@ -23,6 +23,8 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <algorithm>
+
 #include <SFML/OpenGL.hpp>
 
 #include <TGUI/Scrollbar.hpp>
@@ -44,6 +46,7 @@ namespace tgui
     m_LineHeight              (40),
     m_Lines                   (1),
     m_MaxChars                (0),
+    m_MaxLines                (0),
     m_TopLine                 (1),
     m_VisibleLines            (1),
     m_SelChars                (0),
@@ -53,13 +56,19 @@ namespace tgui
     m_SelectionPointVisible   (true),
     m_SelectionPointColor     (110, 110, 255),
     m_SelectionPointWidth     (2),
-    m_SelectionTextsNeedUpdate(true),
+    m_TextGeometryNeedsUpdate (true),
+    m_GeometryFirstLine       (0),
+    m_GeometryEndLine         (0),
+    m_GeometryFirstChar       (0),
+    m_TextVertices            (sf::Quads),
+    m_SelectionColoredStart   (0),
+    m_SelectionColoredEnd     (0),
+    m_SelectionRects          (sf::Quads),
     m_Scroll                  (nullptr),
     m_PossibleDoubleClick     (false),
     m_readOnly                (false)
     {
         m_Callback.widgetType = Type_TextBox;
-        m_AnimatedWidget = true;
         m_DraggableWidget = true;
 
         changeColors();
@@ -81,6 +90,7 @@ namespace tgui
     m_LineHeight                 (copy.m_LineHeight),
     m_Lines                      (copy.m_Lines),
     m_MaxChars                   (copy.m_MaxChars),
+    m_MaxLines                   (copy.m_MaxLines),
     m_TopLine                    (copy.m_TopLine),
     m_VisibleLines               (copy.m_VisibleLines),
     m_SelChars                   (copy.m_SelChars),
@@ -90,18 +100,26 @@ namespace tgui
     m_SelectionPointVisible      (copy.m_SelectionPointVisible),
     m_SelectionPointColor        (copy.m_SelectionPointColor),
     m_SelectionPointWidth        (copy.m_SelectionPointWidth),
-    m_SelectionTextsNeedUpdate   (copy.m_SelectionTextsNeedUpdate),
+    m_TextGeometryNeedsUpdate    (copy.m_TextGeometryNeedsUpdate),
     m_BackgroundColor            (copy.m_BackgroundColor),
     m_SelectedTextBgrColor       (copy.m_SelectedTextBgrColor),
     m_BorderColor                (copy.m_BorderColor),
-    m_TextBeforeSelection        (copy.m_TextBeforeSelection),
-    m_TextSelection1             (copy.m_TextSelection1),
-    m_TextSelection2             (copy.m_TextSelection2),
-    m_TextAfterSelection1        (copy.m_TextAfterSelection1),
-    m_TextAfterSelection2        (copy.m_TextAfterSelection2),
-    m_MultilineSelectionRectWidth(copy.m_MultilineSelectionRectWidth),
+    m_TextColor                  (copy.m_TextColor),
+    m_SelectedTextColor          (copy.m_SelectedTextColor),
+    m_TextTemplate               (copy.m_TextTemplate),
+    m_LineStarts                 (copy.m_LineStarts),
+    m_WrapPositions              (copy.m_WrapPositions),
+    m_GeometryFirstLine          (copy.m_GeometryFirstLine),
+    m_GeometryEndLine            (copy.m_GeometryEndLine),
+    m_GeometryFirstChar          (copy.m_GeometryFirstChar),
+    m_TextVertices               (copy.m_TextVertices),
+    m_CharacterPositions         (copy.m_CharacterPositions),
+    m_SelectionColoredStart      (copy.m_SelectionColoredStart),
+    m_SelectionColoredEnd        (copy.m_SelectionColoredEnd),
+    m_SelectionRects             (copy.m_SelectionRects),
     m_PossibleDoubleClick        (copy.m_PossibleDoubleClick),
-    m_readOnly                   (copy.m_readOnly)
+    m_readOnly                   (copy.m_readOnly),
+    m_UndoHistory                (copy.m_UndoHistory)
     {
         // If there is a scrollbar then copy it
         if (copy.m_Scroll != nullptr)
@@ -112,6 +130,55 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TextBox::TextBox(TextBox&& other) :
+    Widget                       (std::move(other)),
+    WidgetBorders                (other),
+    m_LoadedConfigFile           (std::move(other.m_LoadedConfigFile)),
+    m_Size                       (other.m_Size),
+    m_Text                       (std::move(other.m_Text)),
+    m_DisplayedText              (std::move(other.m_DisplayedText)),
+    m_TextSize                   (other.m_TextSize),
+    m_LineHeight                 (other.m_LineHeight),
+    m_Lines                      (other.m_Lines),
+    m_MaxChars                   (other.m_MaxChars),
+    m_MaxLines                   (other.m_MaxLines),
+    m_TopLine                    (other.m_TopLine),
+    m_VisibleLines               (other.m_VisibleLines),
+    m_SelChars                   (other.m_SelChars),
+    m_SelStart                   (other.m_SelStart),
+    m_SelEnd                     (other.m_SelEnd),
+    m_SelectionPointPosition     (other.m_SelectionPointPosition),
+    m_SelectionPointVisible      (other.m_SelectionPointVisible),
+    m_SelectionPointColor        (other.m_SelectionPointColor),
+    m_SelectionPointWidth        (other.m_SelectionPointWidth),
+    m_TextGeometryNeedsUpdate    (other.m_TextGeometryNeedsUpdate),
+    m_BackgroundColor            (other.m_BackgroundColor),
+    m_SelectedTextBgrColor       (other.m_SelectedTextBgrColor),
+    m_BorderColor                (other.m_BorderColor),
+    m_TextColor                  (other.m_TextColor),
+    m_SelectedTextColor          (other.m_SelectedTextColor),
+    m_TextTemplate               (std::move(other.m_TextTemplate)),
+    m_LineStarts                 (std::move(other.m_LineStarts)),
+    m_WrapPositions              (std::move(other.m_WrapPositions)),
+    m_GeometryFirstLine          (other.m_GeometryFirstLine),
+    m_GeometryEndLine            (other.m_GeometryEndLine),
+    m_GeometryFirstChar          (other.m_GeometryFirstChar),
+    m_TextVertices               (std::move(other.m_TextVertices)),
+    m_CharacterPositions         (std::move(other.m_CharacterPositions)),
+    m_SelectionColoredStart      (other.m_SelectionColoredStart),
+    m_SelectionColoredEnd        (other.m_SelectionColoredEnd),
+    m_SelectionRects             (std::move(other.m_SelectionRects)),
+    m_PossibleDoubleClick        (other.m_PossibleDoubleClick),
+    m_readOnly                   (other.m_readOnly),
+    m_UndoHistory                (std::move(other.m_UndoHistory))
+    {
+        // Take over the scrollbar
+        m_Scroll = other.m_Scroll;
+        other.m_Scroll = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TextBox::~TextBox()
     {
         if (m_Scroll != nullptr)
@@ -143,6 +210,7 @@ namespace tgui
             std::swap(m_LineHeight,                  temp.m_LineHeight);
             std::swap(m_Lines,                       temp.m_Lines);
             std::swap(m_MaxChars,                    temp.m_MaxChars);
+            std::swap(m_MaxLines,                    temp.m_MaxLines);
             std::swap(m_TopLine,                     temp.m_TopLine);
             std::swap(m_VisibleLines,                temp.m_VisibleLines);
             std::swap(m_SelChars,                    temp.m_SelChars);
@@ -152,19 +220,80 @@ namespace tgui
             std::swap(m_SelectionPointVisible,       temp.m_SelectionPointVisible);
             std::swap(m_SelectionPointColor,         temp.m_SelectionPointColor);
             std::swap(m_SelectionPointWidth,         temp.m_SelectionPointWidth);
-            std::swap(m_SelectionTextsNeedUpdate,    temp.m_SelectionTextsNeedUpdate);
+            std::swap(m_TextGeometryNeedsUpdate,     temp.m_TextGeometryNeedsUpdate);
             std::swap(m_BackgroundColor,             temp.m_BackgroundColor);
             std::swap(m_SelectedTextBgrColor,        temp.m_SelectedTextBgrColor);
             std::swap(m_BorderColor,                 temp.m_BorderColor);
-            std::swap(m_TextBeforeSelection,         temp.m_TextBeforeSelection);
-            std::swap(m_TextSelection1,              temp.m_TextSelection1);
-            std::swap(m_TextSelection2,              temp.m_TextSelection2);
-            std::swap(m_TextAfterSelection1,         temp.m_TextAfterSelection1);
-            std::swap(m_TextAfterSelection2,         temp.m_TextAfterSelection2);
-            std::swap(m_MultilineSelectionRectWidth, temp.m_MultilineSelectionRectWidth);
+            std::swap(m_TextColor,                   temp.m_TextColor);
+            std::swap(m_SelectedTextColor,           temp.m_SelectedTextColor);
+            std::swap(m_TextTemplate,                temp.m_TextTemplate);
+            std::swap(m_LineStarts,                  temp.m_LineStarts);
+            std::swap(m_WrapPositions,               temp.m_WrapPositions);
+            std::swap(m_GeometryFirstLine,           temp.m_GeometryFirstLine);
+            std::swap(m_GeometryEndLine,             temp.m_GeometryEndLine);
+            std::swap(m_GeometryFirstChar,           temp.m_GeometryFirstChar);
+            std::swap(m_TextVertices,                temp.m_TextVertices);
+            std::swap(m_CharacterPositions,          temp.m_CharacterPositions);
+            std::swap(m_SelectionColoredStart,       temp.m_SelectionColoredStart);
+            std::swap(m_SelectionColoredEnd,         temp.m_SelectionColoredEnd);
+            std::swap(m_SelectionRects,              temp.m_SelectionRects);
             std::swap(m_Scroll,                      temp.m_Scroll);
             std::swap(m_PossibleDoubleClick,         temp.m_PossibleDoubleClick);
             std::swap(m_readOnly,                    temp.m_readOnly);
+            std::swap(m_UndoHistory,                 temp.m_UndoHistory);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextBox& TextBox::operator= (TextBox&& right)
+    {
+        if (this != &right)
+        {
+            this->Widget::operator=(std::move(right));
+            this->WidgetBorders::operator=(right);
+
+            std::swap(m_LoadedConfigFile,            right.m_LoadedConfigFile);
+            std::swap(m_Size,                        right.m_Size);
+            std::swap(m_Text,                        right.m_Text);
+            std::swap(m_DisplayedText,               right.m_DisplayedText);
+            std::swap(m_TextSize,                    right.m_TextSize);
+            std::swap(m_LineHeight,                  right.m_LineHeight);
+            std::swap(m_Lines,                       right.m_Lines);
+            std::swap(m_MaxChars,                    right.m_MaxChars);
+            std::swap(m_MaxLines,                    right.m_MaxLines);
+            std::swap(m_TopLine,                     right.m_TopLine);
+            std::swap(m_VisibleLines,                right.m_VisibleLines);
+            std::swap(m_SelChars,                    right.m_SelChars);
+            std::swap(m_SelStart,                    right.m_SelStart);
+            std::swap(m_SelEnd,                      right.m_SelEnd);
+            std::swap(m_SelectionPointPosition,      right.m_SelectionPointPosition);
+            std::swap(m_SelectionPointVisible,       right.m_SelectionPointVisible);
+            std::swap(m_SelectionPointColor,         right.m_SelectionPointColor);
+            std::swap(m_SelectionPointWidth,         right.m_SelectionPointWidth);
+            std::swap(m_TextGeometryNeedsUpdate,     right.m_TextGeometryNeedsUpdate);
+            std::swap(m_BackgroundColor,             right.m_BackgroundColor);
+            std::swap(m_SelectedTextBgrColor,        right.m_SelectedTextBgrColor);
+            std::swap(m_BorderColor,                 right.m_BorderColor);
+            std::swap(m_TextColor,                   right.m_TextColor);
+            std::swap(m_SelectedTextColor,           right.m_SelectedTextColor);
+            std::swap(m_TextTemplate,                right.m_TextTemplate);
+            std::swap(m_LineStarts,                  right.m_LineStarts);
+            std::swap(m_WrapPositions,               right.m_WrapPositions);
+            std::swap(m_GeometryFirstLine,           right.m_GeometryFirstLine);
+            std::swap(m_GeometryEndLine,             right.m_GeometryEndLine);
+            std::swap(m_GeometryFirstChar,           right.m_GeometryFirstChar);
+            std::swap(m_TextVertices,                right.m_TextVertices);
+            std::swap(m_CharacterPositions,          right.m_CharacterPositions);
+            std::swap(m_SelectionColoredStart,       right.m_SelectionColoredStart);
+            std::swap(m_SelectionColoredEnd,         right.m_SelectionColoredEnd);
+            std::swap(m_SelectionRects,              right.m_SelectionRects);
+            std::swap(m_Scroll,                      right.m_Scroll);
+            std::swap(m_PossibleDoubleClick,         right.m_PossibleDoubleClick);
+            std::swap(m_readOnly,                    right.m_readOnly);
+            std::swap(m_UndoHistory,                 right.m_UndoHistory);
         }
 
         return *this;
@@ -296,6 +425,8 @@ namespace tgui
 
     void TextBox::setSize(float width, float height)
     {
+        invalidate();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -355,7 +486,6 @@ namespace tgui
         }
 
         // The size of the textbox has changed, update the text
-        m_SelectionTextsNeedUpdate = true;
         updateDisplayedText();
     }
 
@@ -378,10 +508,16 @@ namespace tgui
 
     void TextBox::setText(const sf::String& text)
     {
+        invalidate();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
 
+        // The changes to the old text can no longer be undone
+        if (text != m_Text)
+            m_UndoHistory.clear();
+
         // Store the text
         m_Text = text;
 
@@ -393,15 +529,56 @@ namespace tgui
 
     void TextBox::addText(const sf::String& text)
     {
+        invalidate();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
 
-        // Add the text
+        // When the text was never split into lines then the whole text has to be handled
+        if ((m_LineHeight == 0) || m_LineStarts.empty())
+        {
+            m_Text += text;
+            setSelectionPointPosition(m_Text.getSize());
+            return;
+        }
+
+        // Remember whether the bottom of the text was visible
+        bool scrolledToBottom = (m_Scroll == nullptr) || (m_Scroll->getMaximum() < m_Scroll->getLowValue())
+                             || (m_Scroll->getValue() >= m_Scroll->getMaximum() - m_Scroll->getLowValue());
+
+        // Add the text and only split the last line and the new text into lines
         m_Text += text;
+        rewrapText(m_LineStarts.size() - 1);
+        removeExcessLines();
 
-        // Set the selection point behind the last character
-        setSelectionPointPosition(m_Text.getSize());
+        // Lines may also have been removed when there is no scrollbar, so the selection has to stay inside the text
+        m_SelStart = TGUI_MINIMUM(m_SelStart, m_Text.getSize());
+        m_SelEnd = TGUI_MINIMUM(m_SelEnd, m_Text.getSize());
+        m_SelChars = TGUI_MAXIMUM(m_SelStart, m_SelEnd) - TGUI_MINIMUM(m_SelStart, m_SelEnd);
+
+        // A read-only text box keeps its selection, otherwise the selection point is placed behind the last character
+        if (m_readOnly == false)
+        {
+            m_SelChars = 0;
+            m_SelStart = m_Text.getSize();
+            m_SelEnd = m_Text.getSize();
+            scrolledToBottom = true;
+        }
+
+        // Scroll down to show the new text
+        if (m_Scroll != nullptr)
+        {
+            m_Scroll->setMaximum(m_Lines * m_LineHeight);
+
+            if (scrolledToBottom)
+                m_Scroll->setValue(m_Scroll->getMaximum());
+        }
+
+        // Only the quads of the visible lines are recreated, which happens when the text box is drawn
+        m_TextGeometryNeedsUpdate = true;
+        updateVisibleLines();
+        updateSelection();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -415,11 +592,9 @@ namespace tgui
 
     void TextBox::setTextFont(const sf::Font& font)
     {
-        m_TextBeforeSelection.setFont(font);
-        m_TextSelection1.setFont(font);
-        m_TextSelection2.setFont(font);
-        m_TextAfterSelection1.setFont(font);
-        m_TextAfterSelection2.setFont(font);
+        invalidate();
+
+        m_TextTemplate.setFont(font);
 
         setTextSize(m_TextSize);
     }
@@ -428,13 +603,15 @@ namespace tgui
 
     const sf::Font* TextBox::getTextFont() const
     {
-        return m_TextBeforeSelection.getFont();
+        return m_TextTemplate.getFont();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Store the new text size
         m_TextSize = size;
 
@@ -443,17 +620,13 @@ namespace tgui
             m_TextSize = 8;
 
         // Change the text size
-        m_TextBeforeSelection.setCharacterSize(m_TextSize);
-        m_TextSelection1.setCharacterSize(m_TextSize);
-        m_TextSelection2.setCharacterSize(m_TextSize);
-        m_TextAfterSelection1.setCharacterSize(m_TextSize);
-        m_TextAfterSelection2.setCharacterSize(m_TextSize);
+        m_TextTemplate.setCharacterSize(m_TextSize);
 
-        if (!m_TextBeforeSelection.getFont())
+        if (!m_TextTemplate.getFont())
             return;
 
         // Calculate the height of one line
-        m_LineHeight = static_cast<unsigned int>(m_TextBeforeSelection.getFont()->getLineSpacing(m_TextSize));
+        m_LineHeight = static_cast<unsigned int>(m_TextTemplate.getFont()->getLineSpacing(m_TextSize));
 
         // There is also a minimum height
         if (m_Size.y < m_LineHeight)
@@ -467,7 +640,7 @@ namespace tgui
         }
 
         // The size has changed, update the text
-        m_SelectionTextsNeedUpdate = true;
+        m_TextGeometryNeedsUpdate = true;
         updateDisplayedText();
     }
 
@@ -482,6 +655,8 @@ namespace tgui
 
     void TextBox::setMaximumCharacters(unsigned int maxChars)
     {
+        invalidate();
+
         // Set the new character limit ( 0 to disable the limit )
         m_MaxChars = maxChars;
 
@@ -489,6 +664,7 @@ namespace tgui
         if ((m_MaxChars > 0) && (m_Text.getSize() > m_MaxChars))
         {
             // Remove all the excess characters
+            m_UndoHistory.addChange(TextHistory::Other, m_MaxChars, m_Text.substring(m_MaxChars, sf::String::InvalidPos), "", m_SelStart, m_SelEnd);
             m_Text.erase(m_MaxChars, sf::String::InvalidPos);
 
             // Set the selection point behind the last character
@@ -505,8 +681,122 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::setMaximumLines(unsigned int maxLines)
+    {
+        invalidate();
+
+        // Set the new line limit ( 0 to disable the limit )
+        m_MaxLines = maxLines;
+
+        // Remove the lines that exceed the limit
+        updateDisplayedText();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextBox::getMaximumLines() const
+    {
+        return m_MaxLines;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextBox::undo()
+    {
+        // Don't do anything when the text box wasn't loaded correctly
+        if (m_Loaded == false)
+            return false;
+
+        const TextHistory::Change* change = m_UndoHistory.undo();
+        if (change == nullptr)
+            return false;
+
+        // The text may have been changed in a way that the history didn't see
+        if (change->position + change->inserted.getSize() > m_Text.getSize())
+        {
+            m_UndoHistory.clear();
+            return false;
+        }
+
+        invalidate();
+
+        // The change may be forgotten while the text is changed, e.g. when lines are removed because of the line limit
+        unsigned int selectionStart = change->selectionStart;
+        unsigned int selectionEnd = change->selectionEnd;
+        const unsigned int textSize = m_Text.getSize() - change->inserted.getSize() + change->removed.getSize();
+
+        // Put the removed characters back in place of the inserted ones
+        replaceText(change->position, change->inserted.getSize(), change->removed);
+
+        // Restore the selection from before the change, on the same characters when lines were removed from the front
+        const unsigned int removedChars = textSize - m_Text.getSize();
+        selectionStart = (selectionStart > removedChars) ? selectionStart - removedChars : 0;
+        selectionEnd = (selectionEnd > removedChars) ? selectionEnd - removedChars : 0;
+        m_SelStart = TGUI_MINIMUM(selectionStart, m_Text.getSize());
+        m_SelEnd = TGUI_MINIMUM(selectionEnd, m_Text.getSize());
+        m_SelChars = TGUI_MAXIMUM(m_SelStart, m_SelEnd) - TGUI_MINIMUM(m_SelStart, m_SelEnd);
+        updateSelection();
+        scrollToSelectionPoint();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextBox::redo()
+    {
+        // Don't do anything when the text box wasn't loaded correctly
+        if (m_Loaded == false)
+            return false;
+
+        const TextHistory::Change* change = m_UndoHistory.redo();
+        if (change == nullptr)
+            return false;
+
+        // The text may have been changed in a way that the history didn't see
+        if (change->position + change->removed.getSize() > m_Text.getSize())
+        {
+            m_UndoHistory.clear();
+            return false;
+        }
+
+        invalidate();
+
+        // Make the change again and place the selection point behind the inserted characters
+        unsigned int selectionPoint = change->position + change->inserted.getSize();
+        const unsigned int textSize = m_Text.getSize() - change->removed.getSize() + change->inserted.getSize();
+        replaceText(change->position, change->removed.getSize(), change->inserted);
+
+        // Lines may have been removed from the front because of the line limit
+        const unsigned int removedChars = textSize - m_Text.getSize();
+        selectionPoint = (selectionPoint > removedChars) ? selectionPoint - removedChars : 0;
+        m_SelStart = TGUI_MINIMUM(selectionPoint, m_Text.getSize());
+        m_SelEnd = m_SelStart;
+        m_SelChars = 0;
+        updateSelection();
+        scrollToSelectionPoint();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::setUndoMemoryLimit(std::size_t bytes)
+    {
+        m_UndoHistory.setMemoryLimit(bytes);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBox::getUndoMemoryLimit() const
+    {
+        return m_UndoHistory.getMemoryLimit();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        invalidate();
+
         m_LeftBorder   = leftBorder;
         m_TopBorder    = topBorder;
         m_RightBorder  = rightBorder;
@@ -522,22 +812,23 @@ namespace tgui
                                const sf::Color& borderColor,
                                const sf::Color& selectionPointColor)
     {
-        m_TextBeforeSelection.setColor(color);
-        m_TextSelection1.setColor(selectedColor);
-        m_TextSelection2.setColor(selectedColor);
-        m_TextAfterSelection1.setColor(color);
-        m_TextAfterSelection2.setColor(color);
+        m_TextColor                     = color;
+        m_SelectedTextColor             = selectedColor;
 
         m_SelectionPointColor           = selectionPointColor;
         m_BackgroundColor               = backgroundColor;
         m_SelectedTextBgrColor          = selectedBgrColor;
         m_BorderColor                   = borderColor;
+
+        updateCharacterColors(0, m_DisplayedText.getSize());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_BackgroundColor = backgroundColor;
     }
 
@@ -545,30 +836,40 @@ namespace tgui
 
     void TextBox::setTextColor(const sf::Color& textColor)
     {
-        m_TextBeforeSelection.setColor(textColor);
-        m_TextAfterSelection1.setColor(textColor);
-        m_TextAfterSelection2.setColor(textColor);
+        invalidate();
+
+        m_TextColor = textColor;
+        updateCharacterColors(0, m_DisplayedText.getSize());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
-        m_TextSelection1.setColor(selectedTextColor);
-        m_TextSelection2.setColor(selectedTextColor);
+        invalidate();
+
+        m_SelectedTextColor = selectedTextColor;
+        updateCharacterColors(m_SelectionColoredStart, m_SelectionColoredEnd);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::setSelectedTextBackgroundColor(const sf::Color& selectedTextBackgroundColor)
     {
+        invalidate();
+
         m_SelectedTextBgrColor = selectedTextBackgroundColor;
+
+        for (unsigned int i = 0; i < m_SelectionRects.getVertexCount(); ++i)
+            m_SelectionRects[i].color = m_SelectedTextBgrColor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::setBorderColor(const sf::Color& borderColor)
     {
+        invalidate();
+
         m_BorderColor = borderColor;
     }
 
@@ -576,6 +877,8 @@ namespace tgui
 
     void TextBox::setSelectionPointColor(const sf::Color& selectionPointColor)
     {
+        invalidate();
+
         m_SelectionPointColor = selectionPointColor;
     }
 
@@ -590,14 +893,14 @@ namespace tgui
 
     const sf::Color& TextBox::getTextColor() const
     {
-        return m_TextBeforeSelection.getColor();
+        return m_TextColor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::Color& TextBox::getSelectedTextColor() const
     {
-        return m_TextSelection1.getColor();
+        return m_SelectedTextColor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -625,6 +928,8 @@ namespace tgui
 
     void TextBox::setSelectionPointPosition(unsigned int charactersBeforeSelectionPoint)
     {
+        invalidate();
+
         // The selection point position has to stay inside the string
         if (charactersBeforeSelectionPoint > m_Text.getSize())
             charactersBeforeSelectionPoint = m_Text.getSize();
@@ -638,74 +943,18 @@ namespace tgui
         m_SelStart = charactersBeforeSelectionPoint;
         m_SelEnd = charactersBeforeSelectionPoint;
 
-        // Change our three texts
-        m_TextBeforeSelection.setString(m_DisplayedText);
-        m_TextSelection1.setString("");
-        m_TextSelection2.setString("");
-        m_TextAfterSelection1.setString("");
-        m_TextAfterSelection2.setString("");
-
         // Update the text
         updateDisplayedText();
 
-        // Check if there is a scrollbar
-        if (m_Scroll != nullptr)
-        {
-            unsigned int newlines = 0;
-            unsigned int newlinesAdded = 0;
-            unsigned int totalLines = 0;
-
-            // Loop through all characters
-            for (unsigned int i=0; i<m_SelEnd; ++i)
-            {
-                // Make sure there is no newline in the text
-                if (m_Text[i] != '\n')
-                {
-                    // Check if there is a newline in the displayed text
-                    if (m_DisplayedText[i + newlinesAdded] == '\n')
-                    {
-                        // A newline was added here
-                        ++newlinesAdded;
-                        ++totalLines;
-
-                        if (i < m_SelEnd)
-                            ++newlines;
-                    }
-                }
-                else // The text already contains a newline
-                {
-                    ++totalLines;
-
-                    if (i < m_SelEnd)
-                        ++newlines;
-                }
-            }
-
-            // Check if the selection point is located above the view
-            if ((newlines < m_TopLine - 1) || ((newlines < m_TopLine) && (m_Scroll->getValue() % m_LineHeight > 0)))
-            {
-                m_Scroll->setValue(newlines * m_LineHeight);
-                updateDisplayedText();
-            }
-
-            // Check if the selection point is below the view
-            else if (newlines > m_TopLine + m_VisibleLines - 2)
-            {
-                m_Scroll->setValue((newlines - m_VisibleLines + 1) * m_LineHeight);
-                updateDisplayedText();
-            }
-            else if ((newlines > m_TopLine + m_VisibleLines - 3) && (m_Scroll->getValue() % m_LineHeight > 0))
-            {
-                m_Scroll->setValue((newlines - m_VisibleLines + 2) * m_LineHeight);
-                updateDisplayedText();
-            }
-        }
+        scrollToSelectionPoint();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool TextBox::setScrollbar(const std::string& scrollbarConfigFileFilename)
     {
+        invalidate();
+
         // Do nothing when the string is empty
         if (scrollbarConfigFileFilename.empty() == true)
             return false;
@@ -740,6 +989,8 @@ namespace tgui
 
     void TextBox::removeScrollbar()
     {
+        invalidate();
+
         // Delete the scrollbar
         delete m_Scroll;
         m_Scroll = nullptr;
@@ -751,6 +1002,8 @@ namespace tgui
 
     void TextBox::setSelectionPointWidth(unsigned int width)
     {
+        invalidate();
+
         m_SelectionPointWidth = width;
     }
 
@@ -765,6 +1018,8 @@ namespace tgui
 
     void TextBox::setReadOnly(bool readOnly)
     {
+        invalidate();
+
         m_readOnly = readOnly;
     }
 
@@ -772,6 +1027,8 @@ namespace tgui
 
     void TextBox::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         if (m_Scroll != nullptr)
@@ -823,6 +1080,9 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        // Text that is typed after clicking is undone separately
+        m_UndoHistory.stopMerging();
+
         // Set the mouse down flag
         m_MouseDown = true;
 
@@ -848,9 +1108,9 @@ namespace tgui
             // Reset the position
             m_Scroll->setPosition(0, 0);
 
-            // If the value of the scrollbar has changed then update the text
+            // If the value of the scrollbar has changed then update the visible lines
             if (oldValue != m_Scroll->getValue())
-                updateDisplayedText();
+                updateVisibleLines();
         }
 
         // If the click occured on the text box
@@ -873,9 +1133,8 @@ namespace tgui
                 m_SelEnd = m_Text.getSize();
                 m_SelChars = m_Text.getSize();
 
-                // Update the text
-                m_SelectionTextsNeedUpdate = true;
-                updateDisplayedText();
+                // Update the selection
+                updateSelection();
 
                 // Check if there is a scrollbar
                 if (m_Scroll != nullptr)
@@ -914,19 +1173,19 @@ namespace tgui
                     if ((newlines < m_TopLine - 1) || ((newlines < m_TopLine) && (m_Scroll->getValue() % m_LineHeight > 0)))
                     {
                         m_Scroll->setValue(newlines * m_LineHeight);
-                        updateDisplayedText();
+                        updateVisibleLines();
                     }
 
                     // Check if the selection point is below the view
                     else if (newlines > m_TopLine + m_VisibleLines - 2)
                     {
                         m_Scroll->setValue((newlines - m_VisibleLines + 1) * m_LineHeight);
-                        updateDisplayedText();
+                        updateVisibleLines();
                     }
                     else if ((newlines > m_TopLine + m_VisibleLines - 3) && (m_Scroll->getValue() % m_LineHeight > 0))
                     {
                         m_Scroll->setValue((newlines - m_VisibleLines + 2) * m_LineHeight);
-                        updateDisplayedText();
+                        updateVisibleLines();
                     }
                 }
             }
@@ -975,11 +1234,9 @@ namespace tgui
                 // Reset the position
                 m_Scroll->setPosition(0, 0);
 
-                // If the value of the scrollbar has changed then update the text
+                // If the value of the scrollbar has changed then update the visible lines
                 if (oldValue != m_Scroll->getValue())
                 {
-                    updateDisplayedText();
-
                     // Check if the scrollbar value was incremented (you have pressed on the down arrow)
                     if (m_Scroll->getValue() == oldValue + 1)
                     {
@@ -1000,6 +1257,8 @@ namespace tgui
                         else
                             m_Scroll->setValue(m_Scroll->getValue() - m_LineHeight);
                     }
+
+                    updateVisibleLines();
                 }
             }
         }
@@ -1039,9 +1298,9 @@ namespace tgui
                 // Pass the event, even when the mouse is not on top of the scrollbar
                 m_Scroll->mouseMoved(x, y);
 
-                // If the value of the scrollbar has changed then update the text
+                // If the value of the scrollbar has changed then update the visible lines
                 if (oldValue != m_Scroll->getValue())
-                    updateDisplayedText();
+                    updateVisibleLines();
             }
             else // You are just moving the mouse
             {
@@ -1096,6 +1355,11 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        // Text that is typed after moving the selection point is undone separately
+        if ((event.code == sf::Keyboard::Left) || (event.code == sf::Keyboard::Right) || (event.code == sf::Keyboard::Up)
+         || (event.code == sf::Keyboard::Down) || (event.code == sf::Keyboard::Home) || (event.code == sf::Keyboard::End))
+            m_UndoHistory.stopMerging();
+
         // Check if one of the correct keys was pressed
         if (event.code == sf::Keyboard::Left)
         {
@@ -1149,7 +1413,7 @@ namespace tgui
         }
         else if (event.code == sf::Keyboard::Up)
         {
-            sf::Text tempText(m_TextBeforeSelection);
+            sf::Text tempText(m_TextTemplate);
             tempText.setString(m_DisplayedText);
 
             bool newlineAdded = false;
@@ -1244,7 +1508,7 @@ namespace tgui
         }
         else if (event.code == sf::Keyboard::Down)
         {
-            sf::Text tempText(m_TextBeforeSelection);
+            sf::Text tempText(m_TextTemplate);
             tempText.setString(m_DisplayedText);
 
             bool newlineAdded = false;
@@ -1375,6 +1639,7 @@ namespace tgui
                     return;
 
                 // Erase the character
+                m_UndoHistory.addChange(TextHistory::Backspace, m_SelEnd-1, m_Text.substring(m_SelEnd-1, 1), "", m_SelStart, m_SelEnd);
                 m_Text.erase(m_SelEnd-1, 1);
 
                 // Set the selection point back on the correct position
@@ -1388,9 +1653,8 @@ namespace tgui
                         // Adjust the value of the scrollbar
                         m_Scroll->setValue(m_Scroll->getValue());
 
-                        // The text has to be updated again
-                        m_SelectionTextsNeedUpdate = true;
-                        updateDisplayedText();
+                        // The visible lines have to be updated again
+                        updateVisibleLines();
                     }
                 }
             }
@@ -1422,6 +1686,7 @@ namespace tgui
                     return;
 
                 // Erase the character
+                m_UndoHistory.addChange(TextHistory::Delete, m_SelEnd, m_Text.substring(m_SelEnd, 1), "", m_SelStart, m_SelEnd);
                 m_Text.erase(m_SelEnd, 1);
 
                 // Set the selection point back on the correct position
@@ -1435,9 +1700,8 @@ namespace tgui
                         // Reset the value of the scroll. If it is too high then it will be automatically be adjusted.
                         m_Scroll->setValue(m_Scroll->getValue());
 
-                        // The text has to be updated again
-                        m_SelectionTextsNeedUpdate = true;
-                        updateDisplayedText();
+                        // The visible lines have to be updated again
+                        updateVisibleLines();
                     }
                 }
             }
@@ -1463,47 +1727,28 @@ namespace tgui
             {
                 if (event.code == sf::Keyboard::C)
                 {
-                    if ((m_TextSelection1.getString() != "") && (m_TextSelection2.getString() != ""))
-                        TGUI_Clipboard.set(m_TextSelection1.getString() + "\n" + m_TextSelection2.getString());
-                    else
-                        TGUI_Clipboard.set(m_TextSelection1.getString() + m_TextSelection2.getString());
+                    TGUI_Clipboard.set(m_Text.substring(TGUI_MINIMUM(m_SelStart, m_SelEnd), m_SelChars));
                 }
                 else if (event.code == sf::Keyboard::V)
                 {
-                    if (m_readOnly)
-                        return;
-
-                    auto clipboardContents = TGUI_Clipboard.get();
-
-                    // Only continue pasting if you actually have to do something
-                    if ((m_SelChars > 0) || (clipboardContents.getSize() > 0))
+                    // On X11 the contents may first have to arrive from another application, the widget could be gone by then.
+                    // Widgets that aren't owned by a SharedWidgetPtr can't be tracked, they paste the last known contents.
+                    WeakWidgetPtr<TextBox> textBox(this);
+                    if (textBox.expired())
+                        pasteText(TGUI_Clipboard.get());
+                    else
                     {
-                        deleteSelectedCharacters();
-
-                        unsigned int oldCaretPos = m_SelEnd;
-
-                        if (m_Text.getSize() > m_SelEnd)
-                            setText(m_Text.substring(0, m_SelEnd) + TGUI_Clipboard.get() + m_Text.substring(m_SelEnd, m_Text.getSize() - m_SelEnd));
-                        else
-                            setText(m_Text + clipboardContents);
-
-                        setSelectionPointPosition(oldCaretPos + clipboardContents.getSize());
-
-                        // Add the callback (if the user requested it)
-                        if (m_CallbackFunctions[TextChanged].empty() == false)
-                        {
-                            m_Callback.trigger = TextChanged;
-                            m_Callback.text    = m_Text;
-                            addCallback();
-                        }
+                        TGUI_Clipboard.requestContents([textBox](const sf::String& contents)
+                            {
+                                TextBox::Ptr widget = textBox.lock();
+                                if (widget != nullptr)
+                                    widget->pasteText(contents);
+                            });
                     }
                 }
                 else if (event.code == sf::Keyboard::X)
                 {
-                    if ((m_TextSelection1.getString() != "") && (m_TextSelection2.getString() != ""))
-                        TGUI_Clipboard.set(m_TextSelection1.getString() + "\n" + m_TextSelection2.getString());
-                    else
-                        TGUI_Clipboard.set(m_TextSelection1.getString() + m_TextSelection2.getString());
+                    TGUI_Clipboard.set(m_Text.substring(TGUI_MINIMUM(m_SelStart, m_SelEnd), m_SelChars));
 
                     if (m_readOnly)
                         return;
@@ -1512,17 +1757,41 @@ namespace tgui
                 }
                 else if (event.code == sf::Keyboard::A)
                 {
+                    m_UndoHistory.stopMerging();
+
                     m_SelStart = 0;
                     m_SelEnd = m_Text.getSize();
                     m_SelChars = m_Text.getSize();
 
-                    m_TextBeforeSelection.setString("");
-                    m_TextSelection1.setString(m_DisplayedText);
-                    m_TextSelection2.setString("");
-                    m_TextAfterSelection1.setString("");
-                    m_TextAfterSelection2.setString("");
+                    invalidate();
+                    updateSelection();
+                }
+                else if ((event.code == sf::Keyboard::Z) || (event.code == sf::Keyboard::Y))
+                {
+                    if (m_readOnly)
+                        return;
+
+                    // Ctrl+Z undoes the last change, Ctrl+Y and Ctrl+Shift+Z redo it
+                    bool changed;
+                    if ((event.code == sf::Keyboard::Z) && !event.shift)
+                        changed = undo();
+                    else
+                        changed = redo();
+
+                    if (changed)
+                    {
+                        // The selection point should be visible again
+                        m_SelectionPointVisible = true;
+                        m_AnimationTimeElapsed = sf::Time();
 
-                    updateDisplayedText();
+                        // Add the callback (if the user requested it)
+                        if (m_CallbackFunctions[TextChanged].empty() == false)
+                        {
+                            m_Callback.trigger = TextChanged;
+                            m_Callback.text    = m_Text;
+                            addCallback();
+                        }
+                    }
                 }
             }
         }
@@ -1556,7 +1825,7 @@ namespace tgui
             float maxLineWidth = TGUI_MAXIMUM(m_Size.x - 4.0f, 0);
 
             // Make some preparations
-            sf::Text tempText(m_TextBeforeSelection);
+            sf::Text tempText(m_TextTemplate);
             unsigned int beginChar = 0;
             unsigned int newlinesAdded = 0;
 
@@ -1603,6 +1872,7 @@ namespace tgui
         }
 
         // Insert our character
+        m_UndoHistory.addChange(TextHistory::Typing, m_SelEnd, "", sf::String(key), m_SelStart, m_SelEnd);
         m_Text.insert(m_SelEnd, key);
 
         // Move our selection point forward
@@ -1646,18 +1916,33 @@ namespace tgui
                     else
                         m_Scroll->setValue(0);
                 }
+
+                updateVisibleLines();
             }
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::widgetFocused()
+    {
+        // The selection point only blinks while the widget is focused
+        m_SelectionPointVisible = true;
+        m_AnimationTimeElapsed = sf::Time();
+        startAnimation();
+
+        Widget::widgetFocused();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::widgetUnfocused()
     {
         // If there is a selection then undo it now
         if (m_SelChars)
             setSelectionPointPosition(m_SelEnd);
 
+        stopAnimation();
         Widget::widgetUnfocused();
     }
 
@@ -1851,7 +2136,7 @@ namespace tgui
         }
 
         // Create a temporary text widget that contains the full text
-        sf::Text fullText(m_TextBeforeSelection);
+        sf::Text fullText(m_TextTemplate);
         fullText.setString(m_DisplayedText);
 
         // Check if you clicked behind all characters
@@ -1889,7 +2174,7 @@ namespace tgui
                 tempString.erase(newlinePos2, sf::String::InvalidPos);
 
             // Create a temporary text widget
-            sf::Text tempText(m_TextBeforeSelection);
+            sf::Text tempText(m_TextTemplate);
 
             // We are going to calculate the number of newlines we have added
             unsigned int newlinesAdded = 0;
@@ -1988,6 +2273,8 @@ namespace tgui
 
     void TextBox::selectText(float posX, float posY)
     {
+        invalidate();
+
         // Don't continue when line height is 0
         if (m_LineHeight == 0)
             return;
@@ -2001,9 +2288,8 @@ namespace tgui
         else
             m_SelChars = m_SelEnd - m_SelStart;
 
-        // Update the text
-        m_SelectionTextsNeedUpdate = true;
-        updateDisplayedText();
+        // Only the selection changed, the text itself doesn't have to be split into lines again
+        updateSelection();
 
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
@@ -2042,19 +2328,19 @@ namespace tgui
             if ((newlines < m_TopLine - 1) || ((newlines < m_TopLine) && (m_Scroll->getValue() % m_LineHeight > 0)))
             {
                 m_Scroll->setValue(newlines * m_LineHeight);
-                updateDisplayedText();
+                updateVisibleLines();
             }
 
             // Check if the selection point is below the view
             else if (newlines > m_TopLine + m_VisibleLines - 2)
             {
                 m_Scroll->setValue((newlines - m_VisibleLines + 1) * m_LineHeight);
-                updateDisplayedText();
+                updateVisibleLines();
             }
             else if ((newlines > m_TopLine + m_VisibleLines - 3) && (m_Scroll->getValue() % m_LineHeight > 0))
             {
                 m_Scroll->setValue((newlines - m_VisibleLines + 2) * m_LineHeight);
-                updateDisplayedText();
+                updateVisibleLines();
             }
         }
     }
@@ -2067,6 +2353,10 @@ namespace tgui
         if (m_SelChars == 0)
             return;
 
+        // Remember which characters are removed
+        m_UndoHistory.addChange(TextHistory::Other, TGUI_MINIMUM(m_SelStart, m_SelEnd),
+                                m_Text.substring(TGUI_MINIMUM(m_SelStart, m_SelEnd), m_SelChars), "", m_SelStart, m_SelEnd);
+
         // Erase the characters
         m_Text.erase(TGUI_MINIMUM(m_SelStart, m_SelEnd), m_SelChars);
 
@@ -2076,6 +2366,36 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::pasteText(const sf::String& contents)
+    {
+        // The text box may have become read-only while the contents were on their way
+        if (m_readOnly)
+            return;
+
+        // Only continue pasting if you actually have to do something
+        if ((m_SelChars > 0) || (contents.getSize() > 0))
+        {
+            deleteSelectedCharacters();
+
+            unsigned int oldCaretPos = m_SelEnd;
+
+            m_UndoHistory.addChange(TextHistory::Other, m_SelEnd, "", contents, m_SelStart, m_SelEnd);
+            m_Text.insert(m_SelEnd, contents);
+
+            setSelectionPointPosition(oldCaretPos + contents.getSize());
+
+            // Add the callback (if the user requested it)
+            if (m_CallbackFunctions[TextChanged].empty() == false)
+            {
+                m_Callback.trigger = TextChanged;
+                m_Callback.text    = m_Text;
+                addCallback();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::updateDisplayedText()
     {
         // Don't continue when the text box wasn't loaded correctly
@@ -2086,6 +2406,30 @@ namespace tgui
         if (m_LineHeight == 0)
             return;
 
+        // Split the whole text into lines
+        if (m_LineStarts.empty())
+            m_LineStarts.push_back(0);
+
+        rewrapText(0);
+        removeExcessLines();
+
+        // Tell the scrollbar how many pixels the text contains
+        if (m_Scroll != nullptr)
+            m_Scroll->setMaximum(m_Lines * m_LineHeight);
+
+        m_TextGeometryNeedsUpdate = true;
+
+        // Recreate the quads of the visible characters
+        updateVisibleLines();
+
+        // Color the selected characters and place the selection point
+        updateSelection();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::rewrapText(unsigned int line)
+    {
         float maxLineWidth = m_Size.x - 4.0f;
         if (m_Scroll != nullptr)
             maxLineWidth -= m_Scroll->getSize().x;
@@ -2094,74 +2438,226 @@ namespace tgui
         if (maxLineWidth < 0)
             maxLineWidth = 0;
 
-        // Make some preparations
-        sf::Text tempText(m_TextBeforeSelection);
-        unsigned int beginChar = 0;
-        unsigned int newlinesAdded = 0;
-        unsigned int newlinesAddedBeforeSelection = 0;
+        // Forget everything behind the start of the line, it is recalculated below
+        unsigned int displayedStart = m_LineStarts[line];
+        while (!m_WrapPositions.empty() && (m_WrapPositions.back() + m_WrapPositions.size() - 1 >= displayedStart))
+            m_WrapPositions.pop_back();
+
+        m_DisplayedText.erase(displayedStart, sf::String::InvalidPos);
+        m_LineStarts.resize(line + 1);
+        m_Lines = line + 1;
 
-        m_DisplayedText = m_Text;
-        m_Lines = 1;
+        const sf::Font* font = m_TextTemplate.getFont();
+        bool  bold   = (m_TextTemplate.getStyle() & sf::Text::Bold) != 0;
+        float hspace = (font != nullptr) ? static_cast<float>(font->getGlyph(L' ', m_TextSize, bold).advance) : 0;
 
-        // Loop through every character
-        for (unsigned i=1; i < m_Text.getSize() + 1; ++i)
+        // The new lines are collected first and added to the displayed text at once
+        std::basic_string<sf::Uint32> lines;
+
+        float lineWidth = 0;
+        sf::Uint32 prevChar = 0;
+        for (unsigned int i = displayedStart - m_WrapPositions.size(); i < m_Text.getSize(); ++i)
         {
-            // Make sure the character is not a newline
-            if (m_Text[i-1] != '\n')
-            {
-                // Add the next character to the text widget
-                tempText.setString(m_Text.substring(beginChar, i - beginChar));
+            sf::Uint32 curChar = m_Text[i];
 
-                // Check if the string still fits on the line
-                if (tempText.findCharacterPos(i).x > maxLineWidth)
+            // Calculate the width of the character, the same way as sf::Text does it
+            float charWidth = 0;
+            if (curChar != '\n')
+            {
+                if (font != nullptr)
                 {
-                    // Insert the newline character
-                    m_DisplayedText.insert(i + newlinesAdded - 1, '\n');
+                    charWidth = static_cast<float>(font->getKerning(prevChar, curChar, m_TextSize));
+
+                    if (curChar == ' ')
+                        charWidth += hspace;
+                    else if (curChar == '\t')
+                        charWidth += hspace * 4;
+                    else
+                        charWidth += static_cast<float>(font->getGlyph(curChar, m_TextSize, bold).advance);
+                }
 
-                    // Prepare to find the next line end
-                    beginChar = i - 1;
-                    ++newlinesAdded;
-                    ++m_Lines;
+                // When the character doesn't fit on the line anymore then it goes to the next line
+                if (lineWidth + charWidth <= maxLineWidth)
+                {
+                    lineWidth += charWidth;
+                    prevChar = curChar;
+                    lines += curChar;
+                    continue;
                 }
             }
-            else // The character was a newline
+
+            // Check if there is a limit in the amount of lines
+            if ((m_Scroll == nullptr) && (m_Lines + 1 > m_Size.y / m_LineHeight))
             {
-                beginChar = i;
-                ++m_Lines;
+                // Remove all exceeding lines, the positions in the undo history may no longer exist afterwards
+                m_Text.erase(i, sf::String::InvalidPos);
+                m_UndoHistory.clear();
+                break;
             }
 
-            // Find the position of the selection point
-            if (m_SelEnd == i - 1)
-                newlinesAddedBeforeSelection = newlinesAdded;
+            // Start a new line
+            lines += '\n';
+            m_LineStarts.push_back(displayedStart + lines.size());
+            ++m_Lines;
 
-            // Check if there is a limit in the amount of lines
-            if (m_Scroll == nullptr)
+            if (curChar == '\n')
             {
-                // Check if you passed this limit
-                if (m_Lines > m_Size.y / m_LineHeight)
-                {
-                    // Remove all exceeding lines
-                    m_DisplayedText.erase(i + newlinesAdded - 1, sf::String::InvalidPos);
-                    m_Text.erase(i-1, sf::String::InvalidPos);
+                lineWidth = 0;
+                prevChar = 0;
+            }
+            else // The line was split in front of this character
+            {
+                m_WrapPositions.push_back(i);
 
-                    // We counted one line too much
-                    --m_Lines;
+                if (font != nullptr)
+                    charWidth -= static_cast<float>(font->getKerning(prevChar, curChar, m_TextSize));
 
-                    break;
-                }
+                lineWidth = charWidth;
+                prevChar = curChar;
+                lines += curChar;
             }
         }
 
-        // Find the position of the selection point
-        if (m_SelEnd == m_Text.getSize())
-            newlinesAddedBeforeSelection = newlinesAdded;
+        m_DisplayedText += sf::String(lines);
+    }
 
-        // Check if there is a scrollbar
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::replaceText(unsigned int position, unsigned int removedChars, const sf::String& inserted)
+    {
+        // When the text was never split into lines then the whole text has to be handled
+        if ((m_LineHeight == 0) || m_LineStarts.empty())
+        {
+            m_Text.erase(position, removedChars);
+            m_Text.insert(position, inserted);
+            updateDisplayedText();
+            return;
+        }
+
+        // Find the line of the change while the lines still match the text. The line in front of it is split again as well,
+        // because the first characters of the changed line may fit on it now.
+        unsigned int displayedPosition = position + (std::upper_bound(m_WrapPositions.begin(), m_WrapPositions.end(), position) - m_WrapPositions.begin());
+        unsigned int line = std::upper_bound(m_LineStarts.begin(), m_LineStarts.end(), displayedPosition) - m_LineStarts.begin() - 1;
+        if (line > 0)
+            --line;
+
+        m_Text.erase(position, removedChars);
+        m_Text.insert(position, inserted);
+
+        rewrapText(line);
+        removeExcessLines();
+
+        // Tell the scrollbar how many pixels the text contains
+        if (m_Scroll != nullptr)
+            m_Scroll->setMaximum(m_Lines * m_LineHeight);
+
+        // Only the quads of the visible lines are recreated, which happens when the text box is drawn
+        m_TextGeometryNeedsUpdate = true;
+        updateVisibleLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::scrollToSelectionPoint()
+    {
+        if ((m_Scroll == nullptr) || (m_LineHeight == 0) || m_LineStarts.empty())
+            return;
+
+        // Find the line of the selection point. When the line was split at the selection point then it stays on the first line.
+        unsigned int selectionPoint = m_SelEnd + (std::lower_bound(m_WrapPositions.begin(), m_WrapPositions.end(), m_SelEnd) - m_WrapPositions.begin());
+        unsigned int newlines = std::upper_bound(m_LineStarts.begin(), m_LineStarts.end(), selectionPoint) - m_LineStarts.begin() - 1;
+
+        // Check if the selection point is located above the view
+        if ((newlines < m_TopLine - 1) || ((newlines < m_TopLine) && (m_Scroll->getValue() % m_LineHeight > 0)))
+        {
+            m_Scroll->setValue(newlines * m_LineHeight);
+            updateVisibleLines();
+        }
+
+        // Check if the selection point is below the view
+        else if (newlines > m_TopLine + m_VisibleLines - 2)
+        {
+            m_Scroll->setValue((newlines - m_VisibleLines + 1) * m_LineHeight);
+            updateVisibleLines();
+        }
+        else if ((newlines > m_TopLine + m_VisibleLines - 3) && (m_Scroll->getValue() % m_LineHeight > 0))
+        {
+            m_Scroll->setValue((newlines - m_VisibleLines + 2) * m_LineHeight);
+            updateVisibleLines();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::removeExcessLines()
+    {
+        // The lines in the text are the displayed lines minus the ones that were only split
+        unsigned int lines = m_LineStarts.size() - m_WrapPositions.size();
+        if ((m_MaxLines == 0) || (lines <= m_MaxLines))
+            return;
+
+        // Remove some extra lines, so that the text doesn't have to be moved every time a line is added.
+        // The last line is always kept, as it is the only one that doesn't end with a newline.
+        unsigned int linesToRemove = TGUI_MINIMUM(lines - m_MaxLines + TGUI_MAXIMUM(m_MaxLines / 8, 1u), lines - 1);
+
+        // Find the first character that is kept
+        unsigned int textEnd = 0;
+        for (unsigned int removedLines = 0; removedLines < linesToRemove; ++textEnd)
+        {
+            if (m_Text[textEnd] == '\n')
+                ++removedLines;
+        }
+
+        // Find the same character in the displayed text and the lines that disappear
+        unsigned int removedWraps = std::lower_bound(m_WrapPositions.begin(), m_WrapPositions.end(), textEnd) - m_WrapPositions.begin();
+        unsigned int displayedEnd = textEnd + removedWraps;
+        unsigned int removedDisplayedLines = std::lower_bound(m_LineStarts.begin(), m_LineStarts.end(), displayedEnd) - m_LineStarts.begin();
+
+        m_Text.erase(0, textEnd);
+        m_DisplayedText.erase(0, displayedEnd);
+
+        // The remembered changes have to be moved along with the text
+        m_UndoHistory.removeFront(textEnd);
+
+        m_WrapPositions.erase(m_WrapPositions.begin(), m_WrapPositions.begin() + removedWraps);
+        for (unsigned int i = 0; i < m_WrapPositions.size(); ++i)
+            m_WrapPositions[i] -= textEnd;
+
+        m_LineStarts.erase(m_LineStarts.begin(), m_LineStarts.begin() + removedDisplayedLines);
+        for (unsigned int i = 0; i < m_LineStarts.size(); ++i)
+            m_LineStarts[i] -= displayedEnd;
+
+        m_Lines = m_LineStarts.size();
+
+        // Keep the selection on the same characters
+        m_SelStart = (m_SelStart > textEnd) ? m_SelStart - textEnd : 0;
+        m_SelEnd = (m_SelEnd > textEnd) ? m_SelEnd - textEnd : 0;
+        m_SelChars = TGUI_MAXIMUM(m_SelStart, m_SelEnd) - TGUI_MINIMUM(m_SelStart, m_SelEnd);
+
+        m_SelectionColoredStart = (m_SelectionColoredStart > displayedEnd) ? m_SelectionColoredStart - displayedEnd : 0;
+        m_SelectionColoredEnd = (m_SelectionColoredEnd > displayedEnd) ? m_SelectionColoredEnd - displayedEnd : 0;
+        m_TextGeometryNeedsUpdate = true;
+
+        // Keep showing the same lines
         if (m_Scroll != nullptr)
         {
-            // Tell the scrollbar how many pixels the text contains
+            unsigned int removedHeight = removedDisplayedLines * m_LineHeight;
             m_Scroll->setMaximum(m_Lines * m_LineHeight);
+            m_Scroll->setValue((m_Scroll->getValue() > removedHeight) ? m_Scroll->getValue() - removedHeight : 0);
+        }
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateVisibleLines()
+    {
+        // Don't continue when the text hasn't been split into lines yet
+        if ((m_LineHeight == 0) || m_LineStarts.empty())
+            return;
+
+        // Check if there is a scrollbar
+        if (m_Scroll != nullptr)
+        {
             // Calculate the top line
             m_TopLine = m_Scroll->getValue() / m_LineHeight + 1;
 
@@ -2180,180 +2676,257 @@ namespace tgui
             m_VisibleLines = TGUI_MINIMUM(m_Size.y / m_LineHeight, m_Lines);
         }
 
-        // Fill the temporary text widget with the whole text
-        tempText.setString(m_DisplayedText);
+        // Only the lines that are visible get quads
+        unsigned int firstLine = TGUI_MINIMUM(m_TopLine - 1, m_LineStarts.size() - 1);
+        unsigned int endLine = TGUI_MINIMUM(m_TopLine - 1 + m_VisibleLines, m_LineStarts.size());
+        if (endLine <= firstLine)
+            endLine = firstLine + 1;
 
-        // Set the position of the selection point
-        m_SelectionPointPosition = sf::Vector2u(tempText.findCharacterPos(m_SelEnd + newlinesAddedBeforeSelection));
+        if ((firstLine != m_GeometryFirstLine) || (endLine != m_GeometryEndLine))
+        {
+            m_GeometryFirstLine = firstLine;
+            m_GeometryEndLine = endLine;
+            m_TextGeometryNeedsUpdate = true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateTextGeometry() const
+    {
+        m_TextGeometryNeedsUpdate = false;
 
-        // Only do the check when the selection point is not standing at the first character
-        if ((m_SelEnd > 0) && (m_SelEnd + newlinesAddedBeforeSelection > 0))
+        // Find the characters on the visible lines
+        unsigned int firstChar = m_LineStarts[m_GeometryFirstLine];
+        unsigned int endChar;
+        if (m_GeometryEndLine < m_LineStarts.size())
+            endChar = m_LineStarts[m_GeometryEndLine];
+        else
+            endChar = m_DisplayedText.getSize();
+
+        m_GeometryFirstChar = firstChar;
+        m_TextVertices.resize((endChar - firstChar) * 4);
+        m_CharacterPositions.resize(endChar - firstChar + 1);
+
+        // The layout is identical to the one of sf::Text
+        const sf::Font* font = m_TextTemplate.getFont();
+        bool  bold   = (m_TextTemplate.getStyle() & sf::Text::Bold) != 0;
+        float hspace = (font != nullptr) ? static_cast<float>(font->getGlyph(L' ', m_TextSize, bold).advance) : 0;
+
+        sf::Vector2f position(0, static_cast<float>(m_GeometryFirstLine * m_LineHeight));
+        sf::Uint32 prevChar = 0;
+        for (unsigned int i = firstChar; i < endChar; ++i)
         {
-            // If you are at the end of the line then also set the selection point there, instead of at the beginning of the next line
-            if ((m_Text[m_SelEnd - 1] != '\n') && (m_DisplayedText[m_SelEnd + newlinesAddedBeforeSelection - 1] == '\n'))
-                m_SelectionPointPosition = sf::Vector2u(tempText.findCharacterPos(m_SelEnd + newlinesAddedBeforeSelection - 1));
+            sf::Uint32 curChar = m_DisplayedText[i];
+
+            // Apply the kerning offset
+            if (font != nullptr)
+                position.x += static_cast<float>(font->getKerning(prevChar, curChar, m_TextSize));
+            prevChar = curChar;
+
+            m_CharacterPositions[i - firstChar] = position;
+
+            // Every character gets a quad, which stays empty for whitespace characters
+            const sf::Color& color = ((i >= m_SelectionColoredStart) && (i < m_SelectionColoredEnd)) ? m_SelectedTextColor : m_TextColor;
+            sf::Vertex* quad = &m_TextVertices[(i - firstChar) * 4];
+            for (unsigned int j = 0; j < 4; ++j)
+                quad[j] = sf::Vertex(position, color);
+
+            if (curChar == L'\n')
+            {
+                position.y += m_LineHeight;
+                position.x = 0;
+                continue;
+            }
+            else if (curChar == L' ')
+            {
+                position.x += hspace;
+                continue;
+            }
+            else if (curChar == L'\t')
+            {
+                position.x += hspace * 4;
+                continue;
+            }
+
+            if (font == nullptr)
+                continue;
+
+            const sf::Glyph& glyph = font->getGlyph(curChar, m_TextSize, bold);
+
+            float left   = position.x + glyph.bounds.left;
+            float top    = position.y + m_TextSize + glyph.bounds.top;
+            float right  = left + glyph.bounds.width;
+            float bottom = top + glyph.bounds.height;
+
+            float u1 = static_cast<float>(glyph.textureRect.left);
+            float v1 = static_cast<float>(glyph.textureRect.top);
+            float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width);
+            float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height);
+
+            quad[0] = sf::Vertex(sf::Vector2f(left, top), color, sf::Vector2f(u1, v1));
+            quad[1] = sf::Vertex(sf::Vector2f(right, top), color, sf::Vector2f(u2, v1));
+            quad[2] = sf::Vertex(sf::Vector2f(right, bottom), color, sf::Vector2f(u2, v2));
+            quad[3] = sf::Vertex(sf::Vector2f(left, bottom), color, sf::Vector2f(u1, v2));
+
+            position.x += static_cast<float>(glyph.advance);
         }
 
-        // Check if the text has to be redivided in five pieces
-        if (m_SelectionTextsNeedUpdate)
-            updateSelectionTexts(maxLineWidth);
+        m_CharacterPositions.back() = position;
+
+        // The rectangles behind the selection also only exist for the visible lines
+        updateSelectionRects();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::updateSelectionTexts(float maxLineWidth)
+    void TextBox::updateSelection()
     {
-        // If there is no selection then just put the whole text in m_TextBeforeSelection
-        if (m_SelChars == 0)
-        {
-            m_TextBeforeSelection.setString(m_DisplayedText);
-            m_TextSelection1.setString("");
-            m_TextSelection2.setString("");
-            m_TextAfterSelection1.setString("");
-            m_TextAfterSelection2.setString("");
+        // Don't continue when the text hasn't been split into lines yet
+        if (m_LineStarts.empty())
+            return;
 
-            // Clear the list of selection rectangle sizes
-            m_MultilineSelectionRectWidth.clear();
+        // Find the selection inside the displayed text, which contains extra newlines where the lines were split.
+        // A selection that starts at a split begins on the next line, a selection that ends there stays on the line.
+        unsigned int selectionStart = TGUI_MINIMUM(m_SelStart, m_SelEnd);
+        unsigned int selectionEnd = TGUI_MAXIMUM(m_SelStart, m_SelEnd);
+        selectionStart += std::upper_bound(m_WrapPositions.begin(), m_WrapPositions.end(), selectionStart) - m_WrapPositions.begin();
+        selectionEnd += std::lower_bound(m_WrapPositions.begin(), m_WrapPositions.end(), selectionEnd) - m_WrapPositions.begin();
+
+        // An empty range is placed on the border of the other range, so that only the characters in between get recolored
+        unsigned int oldStart = m_SelectionColoredStart;
+        unsigned int oldEnd = m_SelectionColoredEnd;
+        if (selectionStart >= selectionEnd)
+        {
+            selectionStart = oldStart;
+            selectionEnd = oldStart;
         }
-        else // Some text is selected
+        if (oldStart == oldEnd)
         {
-            // Make some preparations
-            unsigned i;
-            unsigned int selectionStart = TGUI_MINIMUM(m_SelEnd, m_SelStart);
-            unsigned int selectionEnd = TGUI_MAXIMUM(m_SelEnd, m_SelStart);
+            oldStart = selectionStart;
+            oldEnd = selectionStart;
+        }
 
-            sf::Text tempText(m_TextBeforeSelection);
-            unsigned int beginChar = 0;
-            unsigned int newlinesAddedBeforeSelection = 0;
-            unsigned int newlinesAddedInsideSelection = 0;
-            unsigned int lastNewlineBeforeSelection = 0;
-            bool newlineFoundInsideSelection = false;
+        // Only the characters between the old and new borders of the selection have to change color
+        m_SelectionColoredStart = selectionStart;
+        m_SelectionColoredEnd = selectionEnd;
+        updateCharacterColors(TGUI_MINIMUM(oldStart, selectionStart), TGUI_MAXIMUM(oldStart, selectionStart));
+        updateCharacterColors(TGUI_MINIMUM(oldEnd, selectionEnd), TGUI_MAXIMUM(oldEnd, selectionEnd));
 
-            // Clear the list of selection rectangle sizes
-            m_MultilineSelectionRectWidth.clear();
+        // When the quads still have to be recreated then the rectangles will be recreated together with them
+        if (!m_TextGeometryNeedsUpdate)
+            updateSelectionRects();
 
-            // Loop through every character before the selection
-            for (i=0; i < selectionStart; ++i)
-            {
-                // Make sure the character is not a newline
-                if (m_Text[i] != '\n')
-                {
-                    // Add the next character to the text widget
-                    tempText.setString(m_Text.substring(beginChar, i - beginChar + 1));
+        // Set the position of the selection point
+        unsigned int selectionPoint = m_SelEnd + (std::upper_bound(m_WrapPositions.begin(), m_WrapPositions.end(), m_SelEnd) - m_WrapPositions.begin());
 
-                    // Check if the string still fits on the line
-                    if (tempText.findCharacterPos(i+1).x > maxLineWidth)
-                    {
-                        beginChar = i;
-                        lastNewlineBeforeSelection = i;
-                        ++newlinesAddedBeforeSelection;
-                    }
-                }
-                else // The character was a newline
-                {
-                    beginChar = i+1;
-                    lastNewlineBeforeSelection = i;
-                }
-            }
+        // If you are at the end of the line then also set the selection point there, instead of at the beginning of the next line
+        if ((m_SelEnd > 0) && (m_Text[m_SelEnd - 1] != '\n') && (m_DisplayedText[selectionPoint - 1] == '\n'))
+            --selectionPoint;
 
-            // Reset the position from where we should start looking for newlines
-            beginChar = lastNewlineBeforeSelection;
+        m_SelectionPointPosition = sf::Vector2u(findCharacterPos(selectionPoint));
+    }
 
-            // Loop through every selected character
-            for (i=selectionStart; i < selectionEnd; ++i)
-            {
-                // Make sure the character is not a newline
-                if (m_Text[i] != '\n')
-                {
-                    // Add the next character to the text widget
-                    tempText.setString(m_Text.substring(beginChar, i - beginChar + 1));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    // Check if the string still fits on the line
-                    if (tempText.findCharacterPos(i+1).x > maxLineWidth)
-                    {
-                        beginChar = i;
-                        ++newlinesAddedInsideSelection;
-                    }
-                }
-                else // The character was a newline
-                    beginChar = i+1;
-            }
+    void TextBox::updateSelectionRects() const
+    {
+        m_SelectionRects.clear();
 
-            // Find out where the selection starts and where it ends
-            if (m_SelEnd < m_SelStart)
-            {
-                selectionStart = m_SelEnd + newlinesAddedBeforeSelection;
-                selectionEnd = m_SelStart + newlinesAddedBeforeSelection + newlinesAddedInsideSelection;
-            }
+        // Only the visible part of the selection gets rectangles
+        unsigned int geometryEnd = m_GeometryFirstChar + m_CharacterPositions.size() - 1;
+        unsigned int selectionStart = TGUI_MAXIMUM(m_SelectionColoredStart, m_GeometryFirstChar);
+        unsigned int selectionEnd = TGUI_MINIMUM(m_SelectionColoredEnd, geometryEnd);
+        if (selectionStart >= selectionEnd)
+            return;
+
+        // Create one rectangle per selected line
+        unsigned int line = std::upper_bound(m_LineStarts.begin(), m_LineStarts.end(), selectionStart) - m_LineStarts.begin() - 1;
+        unsigned int begin = selectionStart;
+        while (begin < selectionEnd)
+        {
+            // Find where the selection ends on this line
+            unsigned int lineEnd;
+            if (line + 1 < m_LineStarts.size())
+                lineEnd = m_LineStarts[line + 1] - 1;
             else
-            {
-                selectionStart = m_SelStart + newlinesAddedBeforeSelection;
-                selectionEnd = m_SelEnd + newlinesAddedBeforeSelection + newlinesAddedInsideSelection;
-            }
+                lineEnd = m_DisplayedText.getSize();
 
-            // Create another temprary text widget
-            sf::Text tempText2(m_TextBeforeSelection);
-            tempText2.setString(m_DisplayedText);
+            unsigned int end = TGUI_MINIMUM(lineEnd, selectionEnd);
 
-            // Loop through the selected characters again
-            for (i=selectionStart; i<selectionEnd; ++i)
-            {
-                if (m_DisplayedText[i] == '\n')
-                {
-                    // Check if this is not the first newline
-                    if (newlineFoundInsideSelection == true)
-                    {
-                        // Add a new rectangle to the selection
-                        if (tempText2.findCharacterPos(i).x > 0)
-                            m_MultilineSelectionRectWidth.push_back(tempText2.findCharacterPos(i).x);
-                        else
-                            m_MultilineSelectionRectWidth.push_back(2);
-                    }
-                    else // This is the first newline, skip it
-                        newlineFoundInsideSelection = true;
-                }
-            }
+            float left = m_CharacterPositions[begin - m_GeometryFirstChar].x;
+            float right = m_CharacterPositions[end - m_GeometryFirstChar].x;
+            float top = static_cast<float>(line * m_LineHeight);
+            float bottom = top + m_LineHeight;
 
-            // Add the last selection rectangle
-            m_MultilineSelectionRectWidth.push_back(tempText2.findCharacterPos(i).x);
+            // A selected empty line still gets a small rectangle
+            if ((end < selectionEnd) && (right == left))
+                right = left + 2;
 
-            // Set the text before selection
-            m_TextBeforeSelection.setString(m_DisplayedText.substring(0, selectionStart));
+            m_SelectionRects.append(sf::Vertex(sf::Vector2f(left, top), m_SelectedTextBgrColor));
+            m_SelectionRects.append(sf::Vertex(sf::Vector2f(right, top), m_SelectedTextBgrColor));
+            m_SelectionRects.append(sf::Vertex(sf::Vector2f(right, bottom), m_SelectedTextBgrColor));
+            m_SelectionRects.append(sf::Vertex(sf::Vector2f(left, bottom), m_SelectedTextBgrColor));
 
-            // Set the text that is selected. If it consists of multiple lines then it will be changed below.
-            m_TextSelection1.setString(m_DisplayedText.substring(selectionStart, m_SelChars));
-            m_TextSelection2.setString("");
+            begin = lineEnd + 1;
+            ++line;
+        }
+    }
 
-            // Loop through every character inside the selection
-            for (i=selectionStart; i < selectionEnd; ++i)
-            {
-                // Check if the character is a newline
-                if (m_DisplayedText[i] == '\n')
-                {
-                    // Set the text that is selected
-                    m_TextSelection1.setString(m_DisplayedText.substring(selectionStart, i - selectionStart));
-                    m_TextSelection2.setString(m_DisplayedText.substring(i + 1, m_SelChars + newlinesAddedInsideSelection + selectionStart - i - 1));
-                    break;
-                }
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Set the text after the selection. If it consists of multiple lines then it will be changed below.
-            m_TextAfterSelection1.setString(m_DisplayedText.substring(selectionEnd, m_DisplayedText.getSize() - selectionEnd));
-            m_TextAfterSelection2.setString("");
+    void TextBox::updateCharacterColors(unsigned int begin, unsigned int end)
+    {
+        // The quads will get the correct colors when they are recreated
+        if (m_TextGeometryNeedsUpdate)
+            return;
 
-            // Loop through every character after the selection
-            for (i=selectionEnd; i < m_DisplayedText.getSize(); ++i)
-            {
-                // Check if the character is a newline
-                if (m_DisplayedText[i] == '\n')
-                {
-                    // Set the text that is selected
-                    m_TextAfterSelection1.setString(m_DisplayedText.substring(selectionEnd, i - selectionEnd));
-                    m_TextAfterSelection2.setString(m_DisplayedText.substring(i + 1, m_DisplayedText.getSize() - i - 1));
-                    break;
-                }
-            }
+        // Only the visible characters have quads
+        begin = TGUI_MAXIMUM(begin, m_GeometryFirstChar);
+        end = TGUI_MINIMUM(end, m_GeometryFirstChar + m_TextVertices.getVertexCount() / 4);
+
+        for (unsigned int i = begin; i < end; ++i)
+        {
+            const sf::Color& color = ((i >= m_SelectionColoredStart) && (i < m_SelectionColoredEnd)) ? m_SelectedTextColor : m_TextColor;
+
+            for (unsigned int j = 0; j < 4; ++j)
+                m_TextVertices[(i - m_GeometryFirstChar) * 4 + j].color = color;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2f TextBox::findCharacterPos(unsigned int index) const
+    {
+        // Characters on the visible lines were already positioned
+        if (!m_TextGeometryNeedsUpdate && (index >= m_GeometryFirstChar) && (index - m_GeometryFirstChar < m_CharacterPositions.size()))
+            return m_CharacterPositions[index - m_GeometryFirstChar];
+
+        // Otherwise only the line on which the character lies has to be laid out
+        unsigned int line = std::upper_bound(m_LineStarts.begin(), m_LineStarts.end(), index) - m_LineStarts.begin() - 1;
+        sf::Vector2f position(0, static_cast<float>(line * m_LineHeight));
+
+        const sf::Font* font = m_TextTemplate.getFont();
+        if (font == nullptr)
+            return position;
+
+        bool bold = (m_TextTemplate.getStyle() & sf::Text::Bold) != 0;
+        sf::Uint32 prevChar = 0;
+        for (unsigned int i = m_LineStarts[line]; i < index; ++i)
+        {
+            sf::Uint32 curChar = m_DisplayedText[i];
+            position.x += static_cast<float>(font->getKerning(prevChar, curChar, m_TextSize));
+            prevChar = curChar;
+
+            if (curChar == L' ')
+                position.x += static_cast<float>(font->getGlyph(L' ', m_TextSize, bold).advance);
+            else if (curChar == L'\t')
+                position.x += static_cast<float>(font->getGlyph(L' ', m_TextSize, bold).advance) * 4;
+            else
+                position.x += static_cast<float>(font->getGlyph(curChar, m_TextSize, bold).advance);
         }
+
+        return position;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2388,6 +2961,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time TextBox::getTimeUntilNextUpdate() const
+    {
+        return sf::milliseconds(500) - m_AnimationTimeElapsed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         // Don't draw anything when the text box wasn't loaded correctly
@@ -2469,123 +3049,25 @@ namespace tgui
         // Set the clipping area
         glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
 
-        sf::Text tempText(m_TextBeforeSelection);
+        // The quads of the visible lines are only recreated right before they are needed
+        if (m_TextGeometryNeedsUpdate && !m_LineStarts.empty())
+            updateTextGeometry();
+
+        sf::Text tempText(m_TextTemplate);
         tempText.setString("kg");
         sf::Vector2f textShift(tempText.getLocalBounds().left, tempText.getLocalBounds().top);
 
-        // Draw the text
-        states.transform.translate(-textShift.x, -textShift.y);
-        target.draw(m_TextBeforeSelection, states);
-        states.transform.translate(0, textShift.y);
+        // Draw the rectangles behind the selected text
+        states.transform.translate(-textShift.x, 0);
+        target.draw(m_SelectionRects, states);
 
-        // Check if there is a selection
-        if (m_SelChars > 0)
+        // Draw the text
+        if (m_TextTemplate.getFont() != nullptr)
         {
-            // Store the lenghts of the texts
-            unsigned int textBeforeSelectionLength = m_TextBeforeSelection.getString().getSize() + 1;
-            unsigned int textSelection1Length = m_TextSelection1.getString().getSize() + 1;
-            unsigned int textSelection2Length = m_TextSelection2.getString().getSize() + 1;
-
-            // Set the text on the correct position
-            states.transform.translate(m_TextBeforeSelection.findCharacterPos(textBeforeSelectionLength).x, m_TextBeforeSelection.findCharacterPos(textBeforeSelectionLength).y);
-
-            // Watch out for kerning
-            if (textBeforeSelectionLength > 1)
-                states.transform.translate(static_cast<float>(m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[textBeforeSelectionLength-2], m_DisplayedText[textBeforeSelectionLength-1], m_TextSize)), 0);
-
-            // Create the selection background
-            sf::RectangleShape selectionBackground1(sf::Vector2f(m_TextSelection1.findCharacterPos(textSelection1Length).x, static_cast<float>(m_LineHeight)));
-            selectionBackground1.setFillColor(m_SelectedTextBgrColor);
-
-            // Draw the selection background
-            target.draw(selectionBackground1, states);
-
-            // Draw the first part of the selected text
             states.transform.translate(0, -textShift.y);
-            target.draw(m_TextSelection1, states);
-            states.transform.translate(0, textShift.y);
-
-            // Check if there is a second part in the selection
-            if (m_TextSelection2.getString().getSize() > 0)
-            {
-                // Translate to the beginning of the next line
-                states.transform.translate(-m_TextBeforeSelection.findCharacterPos(textBeforeSelectionLength).x, static_cast<float>(m_LineHeight));
-
-                // If there was a kerning correction then undo it now
-                if (textBeforeSelectionLength > 1)
-                    states.transform.translate(static_cast<float>(-m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[textBeforeSelectionLength-2], m_DisplayedText[textBeforeSelectionLength-1], m_TextSize)), 0);
-
-                // Create the second selection background
-                sf::RectangleShape selectionBackground2;
-                selectionBackground2.setFillColor(m_SelectedTextBgrColor);
-
-                // Draw the background rectangles of the selected text
-                for (unsigned int i=0; i<m_MultilineSelectionRectWidth.size(); ++i)
-                {
-                    selectionBackground2.setSize(sf::Vector2f(m_MultilineSelectionRectWidth[i], static_cast<float>(m_LineHeight)));
-                    target.draw(selectionBackground2, states);
-                    selectionBackground2.move(0, static_cast<float>(m_LineHeight));
-                }
-
-                // Draw the second part of the selection
-                states.transform.translate(0, -textShift.y);
-                target.draw(m_TextSelection2, states);
-                states.transform.translate(0, textShift.y);
-
-                // Translate to the end of the selection
-                states.transform.translate(m_TextSelection2.findCharacterPos(textSelection2Length));
-
-                // Watch out for kerning
-                if (m_DisplayedText.getSize() > textBeforeSelectionLength + textSelection1Length + textSelection2Length - 2)
-                    states.transform.translate(static_cast<float>(m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[textBeforeSelectionLength + textSelection1Length + textSelection2Length - 3], m_DisplayedText[textBeforeSelectionLength + textSelection1Length + textSelection2Length - 2], m_TextSize)), 0);
-            }
-            else // The selection was only on one line
-            {
-                // Translate to the end of the selection
-                states.transform.translate(m_TextSelection1.findCharacterPos(textSelection1Length).x, 0);
-
-                // Watch out for kerning
-                if ((m_DisplayedText.getSize() > textBeforeSelectionLength + textSelection1Length - 2) && (textBeforeSelectionLength + textSelection1Length > 2))
-                    states.transform.translate(static_cast<float>(m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[textBeforeSelectionLength + textSelection1Length - 3], m_DisplayedText[textBeforeSelectionLength + textSelection1Length - 2], m_TextSize)), 0);
-            }
-
-            // Draw the first part of the text behind the selection
-            states.transform.translate(0, -textShift.y);
-            target.draw(m_TextAfterSelection1, states);
-            states.transform.translate(textShift.x, textShift.y);
-
-            // Check if there is a second part in the selection
-            if (m_TextAfterSelection2.getString().getSize() > 0)
-            {
-                // Translate to the beginning of the next line
-                if (m_TextSelection2.getString().getSize() > 0)
-                {
-                    // Undo the last translation
-                    states.transform.translate(-m_TextSelection2.findCharacterPos(textSelection2Length).x, static_cast<float>(m_LineHeight));
-
-                    // If there was a kerning correction then undo it now
-                    if (m_DisplayedText.getSize() > textBeforeSelectionLength + textSelection1Length + textSelection2Length - 2)
-                        states.transform.translate(static_cast<float>(-m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[textBeforeSelectionLength + textSelection1Length + textSelection2Length - 3], m_DisplayedText[textBeforeSelectionLength + textSelection1Length + textSelection2Length - 2], m_TextSize)), 0);
-                }
-                else
-                {
-                    // Undo the last translation
-                    states.transform.translate(-m_TextSelection1.findCharacterPos(textSelection1Length).x - m_TextBeforeSelection.findCharacterPos(textBeforeSelectionLength).x, static_cast<float>(m_LineHeight));
-
-                    // If there was a kerning correction then undo it now
-                    if (textBeforeSelectionLength > 1)
-                        states.transform.translate(static_cast<float>(-m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[textBeforeSelectionLength-2], m_DisplayedText[textBeforeSelectionLength-1], m_TextSize)), 0);
-
-                    // If there was a kerning correction then undo it now
-                    if ((m_DisplayedText.getSize() > textBeforeSelectionLength + textSelection1Length - 2) && (textBeforeSelectionLength + textSelection1Length > 2))
-                        states.transform.translate(static_cast<float>(-m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[textBeforeSelectionLength + textSelection1Length - 3], m_DisplayedText[textBeforeSelectionLength + textSelection1Length - 2], m_TextSize)), 0);
-                }
-
-                // Draw the second part of the text after the selection
-                states.transform.translate(-textShift.x, -textShift.y);
-                target.draw(m_TextAfterSelection2, states);
-                states.transform.translate(textShift.x, textShift.y);
-            }
+            states.texture = &m_TextTemplate.getFont()->getTexture(m_TextSize);
+            target.draw(m_TextVertices, states);
+            states.texture = nullptr;
         }
 
         // Only draw the selection point if it has a width
@@ -0,0 +1,306 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/TextHistory.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextHistory::TextHistory() :
+    m_MergeAllowed(false),
+    m_MemoryUsage (0),
+    m_MemoryLimit (1024 * 1024)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextHistory::addChange(ChangeType type, unsigned int position, const sf::String& removed, const sf::String& inserted,
+                                unsigned int selectionStart, unsigned int selectionEnd)
+    {
+        // Nothing has to be stored when nothing changed
+        if (removed.isEmpty() && inserted.isEmpty())
+            return;
+
+        // The changes that were undone no longer apply to the new text
+        for (auto it = m_RedoChanges.begin(); it != m_RedoChanges.end(); ++it)
+            m_MemoryUsage -= getMemoryUsage(*it);
+
+        m_RedoChanges.clear();
+
+        std::size_t lastMemoryUsage = m_UndoChanges.empty() ? 0 : getMemoryUsage(m_UndoChanges.back());
+        if (mergeChange(type, position, removed, inserted))
+        {
+            m_MemoryUsage += getMemoryUsage(m_UndoChanges.back()) - lastMemoryUsage;
+        }
+        else // The change is stored separately
+        {
+            Change change;
+            change.type = type;
+            change.position = position;
+            change.removed = removed;
+            change.inserted = inserted;
+            change.selectionStart = selectionStart;
+            change.selectionEnd = selectionEnd;
+
+            m_UndoChanges.push_back(change);
+            m_MemoryUsage += getMemoryUsage(change);
+        }
+
+        m_MergeAllowed = true;
+        limitMemoryUsage();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextHistory::addChange(ChangeType type, const sf::String& oldText, const sf::String& newText,
+                                unsigned int selectionStart, unsigned int selectionEnd)
+    {
+        // Skip the characters that didn't change at the front
+        unsigned int front = 0;
+        while ((front < oldText.getSize()) && (front < newText.getSize()) && (oldText[front] == newText[front]))
+            ++front;
+
+        // Skip the characters that didn't change at the back
+        unsigned int back = 0;
+        while ((back < oldText.getSize() - front) && (back < newText.getSize() - front)
+            && (oldText[oldText.getSize() - back - 1] == newText[newText.getSize() - back - 1]))
+            ++back;
+
+        addChange(type, front,
+                  oldText.substring(front, oldText.getSize() - front - back),
+                  newText.substring(front, newText.getSize() - front - back),
+                  selectionStart, selectionEnd);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const TextHistory::Change* TextHistory::undo()
+    {
+        if (m_UndoChanges.empty())
+            return nullptr;
+
+        m_RedoChanges.push_back(m_UndoChanges.back());
+        m_UndoChanges.pop_back();
+
+        m_MergeAllowed = false;
+        return &m_RedoChanges.back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const TextHistory::Change* TextHistory::redo()
+    {
+        if (m_RedoChanges.empty())
+            return nullptr;
+
+        m_UndoChanges.push_back(m_RedoChanges.back());
+        m_RedoChanges.pop_back();
+
+        m_MergeAllowed = false;
+        return &m_UndoChanges.back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextHistory::clear()
+    {
+        m_UndoChanges.clear();
+        m_RedoChanges.clear();
+        m_MergeAllowed = false;
+        m_MemoryUsage = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextHistory::removeFront(unsigned int chars)
+    {
+        if (chars == 0)
+            return;
+
+        // The next change to undo and the next change to redo are both at the back of their list
+        removeFront(m_UndoChanges, chars);
+        removeFront(m_RedoChanges, chars);
+
+        if (m_UndoChanges.empty())
+            m_MergeAllowed = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextHistory::stopMerging()
+    {
+        m_MergeAllowed = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextHistory::setMemoryLimit(std::size_t bytes)
+    {
+        m_MemoryLimit = bytes;
+        limitMemoryUsage();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextHistory::getMemoryLimit() const
+    {
+        return m_MemoryLimit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextHistory::mergeChange(ChangeType type, unsigned int position, const sf::String& removed, const sf::String& inserted)
+    {
+        if (!m_MergeAllowed || m_UndoChanges.empty())
+            return false;
+
+        Change& last = m_UndoChanges.back();
+
+        // Text that is inserted where other text was just removed (e.g. typing while text was selected) replaces that text
+        if ((last.type == Other) && last.inserted.isEmpty() && removed.isEmpty() && (last.position == position))
+        {
+            last.type = type;
+            last.inserted = inserted;
+            return true;
+        }
+
+        if (type != last.type)
+            return false;
+
+        if (type == Typing)
+        {
+            // The typed character has to follow the previously typed ones
+            if (!removed.isEmpty() || (last.position + last.inserted.getSize() != position) || last.inserted.isEmpty())
+                return false;
+
+            // A new word starts a new change
+            if (isWordStart(last.inserted[last.inserted.getSize() - 1], inserted[0]))
+                return false;
+
+            last.inserted += inserted;
+            return true;
+        }
+        else if (type == Backspace)
+        {
+            // The removed characters have to lie right in front of the previously removed ones
+            if (!inserted.isEmpty() || !last.inserted.isEmpty() || (position + removed.getSize() != last.position))
+                return false;
+
+            // Removing the end of another word starts a new change
+            if (isWordStart(last.removed[0], removed[removed.getSize() - 1]))
+                return false;
+
+            last.removed.insert(0, removed);
+            last.position = position;
+            return true;
+        }
+        else if (type == Delete)
+        {
+            // The removed characters have to lie at the same place as the previously removed ones
+            if (!inserted.isEmpty() || !last.inserted.isEmpty() || (position != last.position))
+                return false;
+
+            // Removing the start of another word starts a new change
+            if (isWordStart(last.removed[last.removed.getSize() - 1], removed[0]))
+                return false;
+
+            last.removed += removed;
+            return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextHistory::isWordStart(sf::Uint32 prevChar, sf::Uint32 curChar)
+    {
+        bool prevWhitespace = (prevChar == ' ') || (prevChar == '\t') || (prevChar == '\n');
+        bool curWhitespace = (curChar == ' ') || (curChar == '\t') || (curChar == '\n');
+        return prevWhitespace && !curWhitespace;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextHistory::getMemoryUsage(const Change& change)
+    {
+        return sizeof(Change) + (change.removed.getSize() + change.inserted.getSize()) * sizeof(sf::Uint32);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextHistory::removeFront(std::deque<Change>& changes, unsigned int chars)
+    {
+        // Walk from the change that will be reverted first to the last one. The characters in front of a change are not touched
+        // by the changes that are reverted before it, so they match the removed characters until a change touches them.
+        unsigned int kept = changes.size();
+        while (kept > 0)
+        {
+            Change& change = changes[kept-1];
+            if (change.position < chars)
+                break;
+
+            change.position -= chars;
+            change.selectionStart = (change.selectionStart > chars) ? change.selectionStart - chars : 0;
+            change.selectionEnd = (change.selectionEnd > chars) ? change.selectionEnd - chars : 0;
+            --kept;
+        }
+
+        for (unsigned int i = 0; i < kept; ++i)
+            m_MemoryUsage -= getMemoryUsage(changes[i]);
+
+        changes.erase(changes.begin(), changes.begin() + kept);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextHistory::limitMemoryUsage()
+    {
+        // The oldest changes are forgotten first
+        while ((m_MemoryUsage > m_MemoryLimit) && !m_UndoChanges.empty())
+        {
+            m_MemoryUsage -= getMemoryUsage(m_UndoChanges.front());
+            m_UndoChanges.pop_front();
+        }
+
+        // Changes that can be redone are only forgotten when there is nothing left to undo
+        while ((m_MemoryUsage > m_MemoryLimit) && !m_RedoChanges.empty())
+        {
+            m_MemoryUsage -= getMemoryUsage(m_RedoChanges.front());
+            m_RedoChanges.pop_front();
+        }
+
+        if (m_UndoChanges.empty())
+            m_MergeAllowed = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
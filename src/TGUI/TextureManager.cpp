@@ -31,6 +31,35 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void AlphaMask::create(const sf::Image& image)
+    {
+        size = image.getSize();
+        bits.assign((size.x * size.y + 7) / 8, 0);
+
+        // The alpha channel is the fourth byte of every pixel
+        const sf::Uint8* pixels = image.getPixelsPtr();
+        for (unsigned int i = 0; i < size.x * size.y; ++i)
+        {
+            if (pixels[i * 4 + 3] == 0)
+                bits[i / 8] |= (1 << (i % 8));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AlphaMask::isTransparentPixel(unsigned int x, unsigned int y) const
+    {
+        // Pixels outside the image are considered transparent
+        if ((x >= size.x) || (y >= size.y))
+            return true;
+
+        const unsigned int i = y * size.x + x;
+        return (bits[i / 8] & (1 << (i % 8))) != 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Texture::Texture() :
     data(nullptr)
     {
@@ -50,10 +79,11 @@ namespace tgui
 
     bool Texture::isTransparentPixel(unsigned int x, unsigned int y)
     {
-        if (data->image->getPixel(x + data->rect.left, y + data->rect.top).a == 0)
-            return true;
-        else
+        // Textures that weren't loaded from a file have no mask, they are treated as fully opaque
+        if (data->mask == nullptr)
             return false;
+
+        return data->mask->isTransparentPixel(x + data->rect.left, y + data->rect.top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,6 +96,16 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TextureManager::TextureManager() :
+    m_MemoryBudget      (0),
+    m_TextureBytes      (0),
+    m_UnusedTextureBytes(0),
+    m_Evictions         (0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool TextureManager::getTexture(const std::string& filename, Texture& texture, const sf::IntRect& rect)
     {
         // Look if we already had this image
@@ -78,6 +118,13 @@ namespace tgui
                 // Only reuse the texture when the exact same part of the image is used
                 if (it->rect == rect)
                 {
+                    // A texture that was no longer used is needed again
+                    if (it->users == 0)
+                    {
+                        m_UnusedTextures.remove(&(*it));
+                        m_UnusedTextureBytes -= getTextureBytes(*it);
+                    }
+
                     // The texture is now used at multiple places
                     ++(it->users);
 
@@ -100,18 +147,23 @@ namespace tgui
         // Add new data to the list
         imageIt->second.data.push_back(TextureData());
         texture.data = &imageIt->second.data.back();
-        texture.data->image = &imageIt->second.image;
+        texture.data->mask = &imageIt->second.mask;
         texture.data->rect = rect;
 
-        // load the image
-        if (texture.data->image->loadFromFile(filename))
+        // load the image, the pixels are only kept until they are uploaded to the texture
+        sf::Image image;
+        if (image.loadFromFile(filename))
         {
+            // The mask is shared by all parts of the image, so it only has to be created the first time
+            if (imageIt->second.data.size() == 1)
+                imageIt->second.mask.create(image);
+
             // Create a texture from the image
             bool success;
             if (rect == sf::IntRect(0, 0, 0, 0))
-                success = texture.data->texture.loadFromImage(*texture.data->image);
+                success = texture.data->texture.loadFromImage(image);
             else
-                success = texture.data->texture.loadFromImage(*texture.data->image, rect);
+                success = texture.data->texture.loadFromImage(image, rect);
 
             if (success)
             {
@@ -121,12 +173,20 @@ namespace tgui
                 // Set the other members of the data
                 texture.data->filename = filename;
                 texture.data->users = 1;
+
+                // Unused textures may have to make room for the new one
+                m_TextureBytes += getTextureBytes(*texture.data);
+                evictUnusedTextures(m_MemoryBudget);
                 return true;
             }
         }
 
-        // The image couldn't be loaded
-        m_ImageMap.erase(imageIt);
+        // The image couldn't be loaded. The other parts of the image (when there are any) are kept.
+        if (imageIt->second.data.size() == 1)
+            m_ImageMap.erase(imageIt);
+        else
+            imageIt->second.data.pop_back();
+
         texture.data = nullptr;
         return false;
     }
@@ -174,15 +234,12 @@ namespace tgui
                 // Check if the pointer points to our texture
                 if (&(*dataIt) == textureToRemove.data)
                 {
-                    // If this was the only place where the texture is used then delete it
+                    // If this was the only place where the texture is used then it is kept as long as the budget allows it
                     if (--(dataIt->users) == 0)
                     {
-                        // Remove the texture from the list, or even the whole image if it isn't used anywhere else
-                        int usage = std::count_if(imageIt->second.data.begin(), imageIt->second.data.end(), [dataIt](TextureData& data){ return data.image == dataIt->image; });
-                        if (usage == 1)
-                            m_ImageMap.erase(imageIt);
-                        else
-                            imageIt->second.data.erase(dataIt);
+                        m_UnusedTextures.push_front(&(*dataIt));
+                        m_UnusedTextureBytes += getTextureBytes(*dataIt);
+                        evictUnusedTextures(m_MemoryBudget);
                     }
 
                     // The pointer is now useless
@@ -198,6 +255,99 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextureManager::setMemoryBudget(std::size_t bytes)
+    {
+        m_MemoryBudget = bytes;
+        evictUnusedTextures(m_MemoryBudget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getMemoryBudget() const
+    {
+        return m_MemoryBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeUnusedTextures()
+    {
+        evictUnusedTextures(0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getMemoryUsage(const std::string& filenamePrefix) const
+    {
+        std::size_t bytes = 0;
+
+        // The images are sorted by filename, so the images with the prefix are all next to each other
+        for (auto imageIt = m_ImageMap.lower_bound(filenamePrefix); imageIt != m_ImageMap.end(); ++imageIt)
+        {
+            if (imageIt->first.compare(0, filenamePrefix.length(), filenamePrefix) != 0)
+                break;
+
+            for (auto dataIt = imageIt->second.data.cbegin(); dataIt != imageIt->second.data.cend(); ++dataIt)
+                bytes += getTextureBytes(*dataIt);
+        }
+
+        return bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureManager::Stats TextureManager::getStats() const
+    {
+        Stats stats;
+        stats.textures = 0;
+        stats.unusedTextures = m_UnusedTextures.size();
+        stats.textureBytes = m_TextureBytes;
+        stats.unusedTextureBytes = m_UnusedTextureBytes;
+        stats.maskBytes = 0;
+        stats.evictions = m_Evictions;
+
+        for (auto imageIt = m_ImageMap.cbegin(); imageIt != m_ImageMap.cend(); ++imageIt)
+        {
+            stats.textures += imageIt->second.data.size();
+            stats.maskBytes += imageIt->second.mask.bits.size();
+        }
+
+        return stats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getTextureBytes(const TextureData& data)
+    {
+        return static_cast<std::size_t>(data.texture.getSize().x) * data.texture.getSize().y * 4;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::evictUnusedTextures(std::size_t budget)
+    {
+        while (!m_UnusedTextures.empty() && (m_TextureBytes > budget))
+        {
+            TextureData* data = m_UnusedTextures.back();
+            m_UnusedTextures.pop_back();
+
+            const std::size_t bytes = getTextureBytes(*data);
+            m_TextureBytes -= bytes;
+            m_UnusedTextureBytes -= bytes;
+            ++m_Evictions;
+
+            // Remove the texture from the list, or even the whole image if it has no other textures
+            auto imageIt = m_ImageMap.find(data->filename);
+            if (imageIt->second.data.size() == 1)
+                m_ImageMap.erase(imageIt);
+            else
+            {
+                imageIt->second.data.remove_if([data](const TextureData& other){ return &other == data; });
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,287 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <cmath>
+
+#include <TGUI/Tween.hpp>
+#include <TGUI/Widget.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Tween::Tween() :
+    widget  (nullptr),
+    property(Position),
+    easing  (Linear)
+    {
+        // The unused values are set as well, so that all properties can be treated the same way
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            startValue[i] = 0;
+            endValue[i] = 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float Tween::ease(Easing easing, float progress)
+    {
+        switch (easing)
+        {
+            case QuadraticIn:
+                return progress * progress;
+
+            case QuadraticOut:
+                return progress * (2 - progress);
+
+            case QuadraticInOut:
+                if (progress < 0.5f)
+                    return 2 * progress * progress;
+                else
+                    return -1 + (4 - 2 * progress) * progress;
+
+            case CubicIn:
+                return progress * progress * progress;
+
+            case CubicOut:
+                progress -= 1;
+                return progress * progress * progress + 1;
+
+            case CubicInOut:
+                if (progress < 0.5f)
+                    return 4 * progress * progress * progress;
+                else
+                {
+                    progress = 2 * progress - 2;
+                    return 0.5f * progress * progress * progress + 1;
+                }
+
+            case SineInOut:
+                return 0.5f * (1 - std::cos(3.14159265f * progress));
+
+            case BackOut:
+            {
+                const float overshoot = 1.70158f;
+                progress -= 1;
+                return progress * progress * ((overshoot + 1) * progress + overshoot) + 1;
+            }
+
+            case BounceOut:
+                if (progress < 1 / 2.75f)
+                    return 7.5625f * progress * progress;
+                else if (progress < 2 / 2.75f)
+                {
+                    progress -= 1.5f / 2.75f;
+                    return 7.5625f * progress * progress + 0.75f;
+                }
+                else if (progress < 2.5f / 2.75f)
+                {
+                    progress -= 2.25f / 2.75f;
+                    return 7.5625f * progress * progress + 0.9375f;
+                }
+                else
+                {
+                    progress -= 2.625f / 2.75f;
+                    return 7.5625f * progress * progress + 0.984375f;
+                }
+
+            case Linear:
+            default:
+                return progress;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Tweener::Tweener() :
+    m_ActiveTweens(0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tweener::add(const Tween& tween)
+    {
+        // Check if the property is already being tweened
+        unsigned int index = 0;
+        for (; index < m_ActiveTweens; ++index)
+        {
+            if ((m_Tweens[index].widget == tween.widget) && (m_Tweens[index].property == tween.property))
+                break;
+        }
+
+        if (index < m_ActiveTweens)
+        {
+            // The color can't be read from the widget, so continue from the color that the old tween reached
+            if (tween.property == Tween::Color)
+            {
+                float currentValue[4];
+                getCurrentValue(m_Tweens[index], currentValue);
+
+                m_Tweens[index] = tween;
+                for (unsigned int i = 0; i < 4; ++i)
+                    m_Tweens[index].startValue[i] = currentValue[i];
+            }
+            else
+                m_Tweens[index] = tween;
+        }
+        else // This is a new tween
+        {
+            // Reuse the slot of a finished tween when possible
+            if (m_ActiveTweens < m_Tweens.size())
+                m_Tweens[m_ActiveTweens] = tween;
+            else
+                m_Tweens.push_back(tween);
+
+            ++m_ActiveTweens;
+        }
+
+        apply(m_Tweens[index]);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tweener::remove(const Widget* widget)
+    {
+        unsigned int i = 0;
+        while (i < m_ActiveTweens)
+        {
+            if (m_Tweens[i].widget == widget)
+                recycle(i);
+            else
+                ++i;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tweener::removeAll()
+    {
+        while (m_ActiveTweens > 0)
+            recycle(m_ActiveTweens - 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tweener::update(const sf::Time& elapsedTime)
+    {
+        unsigned int i = 0;
+        while (i < m_ActiveTweens)
+        {
+            Tween& tween = m_Tweens[i];
+
+            tween.elapsed += elapsedTime;
+            if (tween.elapsed >= tween.duration)
+            {
+                // Make sure the widget ends up exactly at the end value
+                tween.elapsed = tween.duration;
+                apply(tween);
+
+                // The last running tween is moved to this index, so don't increment it
+                recycle(i);
+            }
+            else
+            {
+                apply(tween);
+                ++i;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Tweener::isEmpty() const
+    {
+        return m_ActiveTweens == 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tweener::getCurrentValue(const Tween& tween, float value[4])
+    {
+        float progress = 1;
+        if (tween.elapsed < tween.duration)
+            progress = Tween::ease(tween.easing, tween.elapsed.asSeconds() / tween.duration.asSeconds());
+
+        for (unsigned int i = 0; i < 4; ++i)
+            value[i] = tween.startValue[i] + (tween.endValue[i] - tween.startValue[i]) * progress;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tweener::apply(const Tween& tween)
+    {
+        float value[4];
+        getCurrentValue(tween, value);
+
+        // Some easing curves go past the end value, so make sure the values remain valid
+        switch (tween.property)
+        {
+            case Tween::Position:
+                tween.widget->setPosition(value[0], value[1]);
+                break;
+
+            case Tween::Size:
+                tween.widget->setSize(TGUI_MAXIMUM(value[0], 0.f), TGUI_MAXIMUM(value[1], 0.f));
+                break;
+
+            case Tween::Transparency:
+                tween.widget->setTransparency(static_cast<unsigned char>(TGUI_MINIMUM(TGUI_MAXIMUM(value[0], 0.f), 255.f) + 0.5f));
+                break;
+
+            case Tween::Color:
+            {
+                sf::Uint8 color[4];
+                for (unsigned int i = 0; i < 4; ++i)
+                    color[i] = static_cast<sf::Uint8>(TGUI_MINIMUM(TGUI_MAXIMUM(value[i], 0.f), 255.f) + 0.5f);
+
+                tween.setColor(sf::Color(color[0], color[1], color[2], color[3]));
+                break;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tweener::recycle(unsigned int index)
+    {
+        --m_ActiveTweens;
+        if (index != m_ActiveTweens)
+            std::swap(m_Tweens[index], m_Tweens[m_ActiveTweens]);
+
+        // Don't keep anything alive that was captured by the color function
+        m_Tweens[m_ActiveTweens].widget = nullptr;
+        m_Tweens[m_ActiveTweens].setColor = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,7 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/Container.hpp>
+#include <TGUI/WidgetArena.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -46,7 +47,8 @@ namespace tgui
     m_AllowFocus     (false),
     m_AnimatedWidget (false),
     m_DraggableWidget(false),
-    m_ContainerWidget(false)
+    m_ContainerWidget(false),
+    m_ControlBlock   (nullptr)
     {
         m_Callback.widget = nullptr;
         m_Callback.widgetType = Type_Unknown;
@@ -69,15 +71,43 @@ namespace tgui
     m_MouseDown      (false),
     m_Focused        (false),
     m_AllowFocus     (copy.m_AllowFocus),
-    m_AnimatedWidget (copy.m_AnimatedWidget),
+    m_AnimatedWidget (false),
     m_DraggableWidget(copy.m_DraggableWidget),
-    m_ContainerWidget(copy.m_ContainerWidget)
+    m_ContainerWidget(copy.m_ContainerWidget),
+    m_ControlBlock   (nullptr)
     {
         m_Callback.widget = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget::Widget(Widget&& other) :
+    sf::Drawable     (other),
+    Transformable    (other),
+    CallbackManager  (std::move(other)),
+    m_Enabled        (other.m_Enabled),
+    m_Visible        (other.m_Visible),
+    m_Loaded         (other.m_Loaded),
+    m_WidgetPhase    (other.m_WidgetPhase),
+    m_Parent         (other.m_Parent),
+    m_Opacity        (other.m_Opacity),
+    m_MouseHover     (false),
+    m_MouseDown      (false),
+    m_Focused        (false),
+    m_AllowFocus     (other.m_AllowFocus),
+    m_AnimatedWidget (false),
+    m_DraggableWidget(other.m_DraggableWidget),
+    m_ContainerWidget(other.m_ContainerWidget),
+    m_ControlBlock   (nullptr)
+    {
+        m_Callback.widget = nullptr;
+
+        // The resources of the other widget are taken over, so it can no longer be drawn
+        other.m_Loaded = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::~Widget()
     {
     }
@@ -93,6 +123,10 @@ namespace tgui
             this->Transformable::operator=(right);
             this->CallbackManager::operator=(right);
 
+            // The visible and enabled state may change while the widget stays in its container
+            if (m_Parent)
+                m_Parent->widgetStateChanged();
+
             m_Enabled             = right.m_Enabled;
             m_Visible             = right.m_Visible;
             m_Loaded              = right.m_Loaded;
@@ -103,7 +137,6 @@ namespace tgui
             m_MouseDown           = false;
             m_Focused             = false;
             m_AllowFocus          = right.m_AllowFocus;
-            m_AnimatedWidget      = right.m_AnimatedWidget;
             m_DraggableWidget     = right.m_DraggableWidget;
             m_ContainerWidget     = right.m_ContainerWidget;
             m_Callback            = Callback();
@@ -117,6 +150,47 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget& Widget::operator= (Widget&& right)
+    {
+        // Make sure it is not the same widget
+        if (this != &right)
+        {
+            // The callback has to keep pointing to this widget
+            Widget* const callbackWidget = m_Callback.widget;
+
+            this->sf::Drawable::operator=(right);
+            this->Transformable::operator=(right);
+            this->CallbackManager::operator=(std::move(right));
+
+            // The widgets exchange their resources, so they also exchange whether these were loaded
+            std::swap(m_Loaded, right.m_Loaded);
+
+            // The visible and enabled state may change while the widget stays in its container
+            if (m_Parent)
+                m_Parent->widgetStateChanged();
+
+            m_Enabled             = right.m_Enabled;
+            m_Visible             = right.m_Visible;
+            m_WidgetPhase         = right.m_WidgetPhase;
+            m_Parent              = right.m_Parent;
+            m_Opacity             = right.m_Opacity;
+            m_MouseHover          = false;
+            m_MouseDown           = false;
+            m_Focused             = false;
+            m_AllowFocus          = right.m_AllowFocus;
+            m_DraggableWidget     = right.m_DraggableWidget;
+            m_ContainerWidget     = right.m_ContainerWidget;
+            m_Callback            = Callback();
+            m_Callback.widget     = callbackWidget;
+            m_Callback.widgetType = right.m_Callback.widgetType;
+            m_Callback.id         = right.m_Callback.id;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     sf::Vector2f Widget::getAbsolutePosition() const
     {
         if (m_Parent)
@@ -130,13 +204,20 @@ namespace tgui
     void Widget::show()
     {
         m_Visible = true;
+        if (m_Parent)
+            m_Parent->widgetStateChanged();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::hide()
     {
+        invalidate();
         m_Visible = false;
+        if (m_Parent)
+            m_Parent->widgetStateChanged();
 
         // If the widget is focused then it must be unfocused
         unfocus();
@@ -154,6 +235,10 @@ namespace tgui
     void Widget::enable()
     {
         m_Enabled = true;
+        if (m_Parent)
+            m_Parent->widgetStateChanged();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -161,6 +246,10 @@ namespace tgui
     void Widget::disable()
     {
         m_Enabled = false;
+        if (m_Parent)
+            m_Parent->widgetStateChanged();
+
+        invalidate();
 
         // Change the mouse button state.
         m_MouseHover = false;
@@ -230,9 +319,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::setPosition(float x, float y)
+    {
+        Transformable::setPosition(x, y);
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setTransparency(unsigned char transparency)
     {
         m_Opacity = transparency;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -244,6 +342,70 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::tweenPosition(const sf::Vector2f& position, sf::Time duration, Tween::Easing easing)
+    {
+        Tween tween;
+        tween.property = Tween::Position;
+        tween.startValue[0] = getPosition().x;
+        tween.startValue[1] = getPosition().y;
+        tween.endValue[0] = position.x;
+        tween.endValue[1] = position.y;
+        startTween(tween, duration, easing);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::tweenSize(const sf::Vector2f& size, sf::Time duration, Tween::Easing easing)
+    {
+        Tween tween;
+        tween.property = Tween::Size;
+        tween.startValue[0] = getSize().x;
+        tween.startValue[1] = getSize().y;
+        tween.endValue[0] = size.x;
+        tween.endValue[1] = size.y;
+        startTween(tween, duration, easing);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::tweenTransparency(unsigned char transparency, sf::Time duration, Tween::Easing easing)
+    {
+        Tween tween;
+        tween.property = Tween::Transparency;
+        tween.startValue[0] = m_Opacity;
+        tween.endValue[0] = transparency;
+        startTween(tween, duration, easing);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::tweenColor(const sf::Color& startColor, const sf::Color& endColor, sf::Time duration,
+                            const std::function<void(const sf::Color&)>& setColor, Tween::Easing easing)
+    {
+        Tween tween;
+        tween.property = Tween::Color;
+        tween.startValue[0] = startColor.r;
+        tween.startValue[1] = startColor.g;
+        tween.startValue[2] = startColor.b;
+        tween.startValue[3] = startColor.a;
+        tween.endValue[0] = endColor.r;
+        tween.endValue[1] = endColor.g;
+        tween.endValue[2] = endColor.b;
+        tween.endValue[3] = endColor.a;
+        tween.setColor = setColor;
+        startTween(tween, duration, easing);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::stopTweens()
+    {
+        if (m_Parent)
+            m_Parent->removeTweens(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::moveToFront()
     {
         m_Parent->moveWidgetToFront(this);
@@ -272,14 +434,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::FloatRect Widget::getDrawBounds() const
+    {
+        return sf::FloatRect(getPosition(), getFullSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::update()
     {
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time Widget::getTimeUntilNextUpdate() const
+    {
+        return sf::Time();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::addCallback()
     {
+        // Whatever triggered the callback is likely to have changed the looks of the widget
+        invalidate();
+
         // Loop through all callback functions
         auto& functions = m_CallbackFunctions[m_Callback.trigger];
         for (auto func = functions.cbegin(); func != functions.cend(); ++func)
@@ -296,6 +475,8 @@ namespace tgui
 
     void Widget::mouseEnteredWidget()
     {
+        invalidate();
+
         if (m_CallbackFunctions[MouseEntered].empty() == false)
         {
             m_Callback.trigger = MouseEntered;
@@ -307,6 +488,8 @@ namespace tgui
 
     void Widget::mouseLeftWidget()
     {
+        invalidate();
+
         if (m_CallbackFunctions[MouseLeft].empty() == false)
         {
             m_Callback.trigger = MouseLeft;
@@ -358,6 +541,8 @@ namespace tgui
 
     void Widget::widgetFocused()
     {
+        invalidate();
+
         if (m_CallbackFunctions[Focused].empty() == false)
         {
             m_Callback.trigger = Focused;
@@ -373,6 +558,8 @@ namespace tgui
 
     void Widget::widgetUnfocused()
     {
+        invalidate();
+
         if (m_CallbackFunctions[Unfocused].empty() == false)
         {
             m_Callback.trigger = Unfocused;
@@ -427,6 +614,9 @@ namespace tgui
                 m_Visible = false;
             else
                 TGUI_OUTPUT("TGUI error: Failed to parse 'Visible' property.");
+
+            if (m_Parent)
+                m_Parent->widgetStateChanged();
         }
         else if (property == "enabled")
         {
@@ -436,6 +626,9 @@ namespace tgui
                 m_Enabled = false;
             else
                 TGUI_OUTPUT("TGUI error: Failed to parse 'Enabled' property.");
+
+            if (m_Parent)
+                m_Parent->widgetStateChanged();
         }
         else if(property == "focused")
         {
@@ -549,6 +742,65 @@ namespace tgui
         m_Parent = parent;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::startAnimation()
+    {
+        if (m_AnimatedWidget)
+            return;
+
+        m_AnimatedWidget = true;
+
+        // When the widget has no parent yet, the container will check the flag when the widget gets added to it
+        if (m_Parent)
+            m_Parent->addAnimatedWidget(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::stopAnimation()
+    {
+        if (m_AnimatedWidget == false)
+            return;
+
+        m_AnimatedWidget = false;
+
+        if (m_Parent)
+            m_Parent->removeAnimatedWidget(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::startTween(Tween& tween, sf::Time duration, Tween::Easing easing)
+    {
+        tween.widget = this;
+        tween.easing = easing;
+        tween.duration = duration;
+
+        // Without a parent there is nobody to update the tween, so jump to the end immediately
+        if (m_Parent && (duration > sf::Time()))
+            m_Parent->addTween(tween);
+        else
+        {
+            tween.elapsed = duration;
+            Tweener::apply(tween);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidate()
+    {
+        if (m_Parent)
+        {
+            // The position or size of the widget may have changed, e.g. by a tween
+            m_Parent->m_WidgetBoundsNeedUpdate = true;
+
+            // Pass the request on until it reaches the gui
+            m_Parent->invalidate();
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -573,6 +825,39 @@ namespace tgui
         return Borders(m_LeftBorder, m_TopBorder, m_RightBorder, m_BottomBorder);
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetControlBlock::destroyWidget()
+    {
+        Widget* widgetToDestroy = widget;
+        widget = nullptr;
+
+        // When the widget was allocated together with the control block then the memory is only freed with the control block
+        if (embedded)
+            widgetToDestroy->~Widget();
+        else
+            delete widgetToDestroy;
+
+        // The shared pointers no longer keep the control block alive
+        releaseWeakRef();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetControlBlock::deallocate()
+    {
+        WidgetArena* widgetArena = arena;
+        const std::size_t size = allocationSize;
+
+        this->~WidgetControlBlock();
+
+        if (widgetArena != nullptr)
+            widgetArena->deallocate(this, size);
+        else
+            ::operator delete(this);
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
@@ -0,0 +1,172 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/WidgetArena.hpp>
+
+#include <new>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetArena::WidgetArena() :
+    m_CurrentChunk (0),
+    m_ChunkOffset  (0),
+    m_NextChunkSize(4096),
+    m_References   (1)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetArena::~WidgetArena()
+    {
+        for (auto it = m_Chunks.begin(); it != m_Chunks.end(); ++it)
+            ::operator delete(it->memory);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void* WidgetArena::allocate(std::size_t size)
+    {
+    #ifdef TGUI_ATOMIC_REFCOUNT
+        std::lock_guard<std::mutex> lock(m_Mutex);
+    #endif
+
+        const std::size_t index = getSizeIndex(size);
+        size = index * 16;
+
+        ++m_References;
+
+        // Reuse the memory of a destroyed widget of the same size when possible
+        if ((index < m_FreeLists.size()) && (m_FreeLists[index] != nullptr))
+        {
+            void* memory = m_FreeLists[index];
+            m_FreeLists[index] = *static_cast<void**>(memory);
+            return memory;
+        }
+
+        // Find a chunk with enough free space, the remaining space in the chunks that are skipped stays unused
+        while ((m_CurrentChunk < m_Chunks.size()) && (m_ChunkOffset + size > m_Chunks[m_CurrentChunk].size))
+        {
+            ++m_CurrentChunk;
+            m_ChunkOffset = 0;
+        }
+
+        // Create a new chunk when all chunks are full
+        if (m_CurrentChunk == m_Chunks.size())
+        {
+            Chunk chunk;
+            chunk.size = (size > m_NextChunkSize) ? size : m_NextChunkSize;
+            chunk.memory = static_cast<char*>(::operator new(chunk.size));
+            m_Chunks.push_back(chunk);
+
+            if (m_NextChunkSize < 65536)
+                m_NextChunkSize *= 2;
+
+            m_ChunkOffset = 0;
+        }
+
+        void* memory = m_Chunks[m_CurrentChunk].memory + m_ChunkOffset;
+        m_ChunkOffset += size;
+        return memory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetArena::deallocate(void* memory, std::size_t size)
+    {
+        bool lastReference;
+
+        {
+        #ifdef TGUI_ATOMIC_REFCOUNT
+            std::lock_guard<std::mutex> lock(m_Mutex);
+        #endif
+
+            const std::size_t index = getSizeIndex(size);
+            if (index >= m_FreeLists.size())
+                m_FreeLists.resize(index + 1, nullptr);
+
+            *static_cast<void**>(memory) = m_FreeLists[index];
+            m_FreeLists[index] = memory;
+
+            lastReference = (--m_References == 0);
+        }
+
+        // The mutex may not be locked while the arena is destroyed
+        if (lastReference)
+            delete this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetArena::recycle()
+    {
+    #ifdef TGUI_ATOMIC_REFCOUNT
+        std::lock_guard<std::mutex> lock(m_Mutex);
+    #endif
+
+        // Only the reference of the owner may be left, otherwise some widgets are still alive
+        if (m_References != 1)
+            return;
+
+        m_FreeLists.clear();
+        m_CurrentChunk = 0;
+        m_ChunkOffset = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetArena::release()
+    {
+        bool lastReference;
+
+        {
+        #ifdef TGUI_ATOMIC_REFCOUNT
+            std::lock_guard<std::mutex> lock(m_Mutex);
+        #endif
+
+            lastReference = (--m_References == 0);
+        }
+
+        if (lastReference)
+            delete this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t WidgetArena::getSizeIndex(std::size_t size)
+    {
+        // Blocks are a multiple of 16 bytes, so that every block is aligned for any type a widget can contain
+        return (size + 15) / 16;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
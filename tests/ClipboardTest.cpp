@@ -0,0 +1,400 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Tests the X11 clipboard against a stand-in for another application, without needing a desktop or a second program.
+// An X server is still needed, on CI the test can be run inside xvfb-run. It is skipped when no X server can be reached.
+
+#include <TGUI/Clipboard.hpp>
+
+#include <SFML/System/Utf.hpp>
+#include <X11/Xlib.h>
+#include <X11/Xatom.h>
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The exit code that tells ctest that the test was skipped
+    const int SkipTest = 77;
+
+    // The contents are sent in parts of this size, which doesn't fit the multi-byte characters of the text
+    const std::size_t PartSize = 65537;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Another application that uses the clipboard, with its own connection to the X server. It only implements the parts of
+    // the selection protocol that the tests need, and always sends big contents in parts (with INCR).
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class OtherApplication
+    {
+      public:
+
+        explicit OtherApplication(Display* connection) :
+            m_display          (connection),
+            m_window           (XCreateSimpleWindow(connection, DefaultRootWindow(connection), 0, 0, 1, 1, 0, 0, 0)),
+            m_clipboard        (XInternAtom(connection, "CLIPBOARD", False)),
+            m_targets          (XInternAtom(connection, "TARGETS", False)),
+            m_utf8String       (XInternAtom(connection, "UTF8_STRING", False)),
+            m_incr             (XInternAtom(connection, "INCR", False)),
+            m_property         (XInternAtom(connection, "OTHER_APPLICATION", False)),
+            m_sending          (false),
+            m_requestor        (0),
+            m_requestorProperty(None),
+            m_offset           (0)
+        {
+            XSelectInput(m_display, m_window, PropertyChangeMask);
+            XSync(m_display, False);
+        }
+
+        ~OtherApplication()
+        {
+            XDestroyWindow(m_display, m_window);
+            XCloseDisplay(m_display);
+        }
+
+        // Puts the text on the clipboard
+        void copy(const std::string& utf8Text)
+        {
+            m_contents = utf8Text;
+            XSetSelectionOwner(m_display, m_clipboard, m_window, CurrentTime);
+            XSync(m_display, False);
+        }
+
+        // Asks the owner of the clipboard for the contents, without waiting for them
+        void requestContents()
+        {
+            XDeleteProperty(m_display, m_window, m_property);
+            XConvertSelection(m_display, m_clipboard, m_utf8String, m_property, m_window, CurrentTime);
+            XFlush(m_display);
+        }
+
+        // Asks the owner of the clipboard for the contents and waits until they have arrived
+        bool paste(std::string& utf8Text)
+        {
+            utf8Text.clear();
+            requestContents();
+
+            bool receivingIncr = false;
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (std::chrono::steady_clock::now() < deadline)
+            {
+                if (!XPending(m_display))
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    continue;
+                }
+
+                XEvent event;
+                XNextEvent(m_display, &event);
+
+                // The requests go to this application itself while the clipboard of TGUI didn't claim the ownership yet
+                if (event.type == SelectionRequest)
+                    handleSelectionRequest(event.xselectionrequest);
+                else if (m_sending && (event.type == PropertyNotify) && (event.xproperty.window == m_requestor)
+                      && (event.xproperty.atom == m_requestorProperty) && (event.xproperty.state == PropertyDelete))
+                    sendNextPart();
+                else if (event.type == SelectionNotify)
+                {
+                    if (event.xselection.property == None)
+                        return false;
+
+                    // Reading the INCR property tells the owner to send the first part
+                    if (readProperty(utf8Text) == m_incr)
+                        receivingIncr = true;
+                    else
+                        return true;
+                }
+                else if (receivingIncr && (event.type == PropertyNotify) && (event.xproperty.window == m_window)
+                      && (event.xproperty.atom == m_property) && (event.xproperty.state == PropertyNewValue))
+                {
+                    // An empty part marks the end of the contents
+                    const std::size_t oldSize = utf8Text.size();
+                    readProperty(utf8Text);
+                    if (utf8Text.size() == oldSize)
+                        return true;
+                }
+            }
+
+            return false;
+        }
+
+        // Answers the requests of the clipboard of TGUI that arrived, without waiting for new ones
+        void processEvents()
+        {
+            while (XPending(m_display))
+            {
+                XEvent event;
+                XNextEvent(m_display, &event);
+
+                if (event.type == SelectionRequest)
+                    handleSelectionRequest(event.xselectionrequest);
+                else if (m_sending && (event.type == PropertyNotify) && (event.xproperty.window == m_requestor)
+                      && (event.xproperty.atom == m_requestorProperty) && (event.xproperty.state == PropertyDelete))
+                    sendNextPart();
+            }
+        }
+
+      private:
+
+        Atom readProperty(std::string& utf8Text)
+        {
+            Atom type = None;
+            int format;
+            unsigned long items;
+            unsigned long bytesAfter;
+            unsigned char* data = nullptr;
+
+            XGetWindowProperty(m_display, m_window, m_property, 0, LONG_MAX / 4, True, AnyPropertyType,
+                               &type, &format, &items, &bytesAfter, &data);
+
+            if ((type == m_utf8String) && (format == 8))
+                utf8Text.append(reinterpret_cast<const char*>(data), items);
+
+            if (data != nullptr)
+                XFree(data);
+
+            return type;
+        }
+
+        void handleSelectionRequest(const XSelectionRequestEvent& request)
+        {
+            XSelectionEvent reply;
+            reply.type      = SelectionNotify;
+            reply.display   = m_display;
+            reply.requestor = request.requestor;
+            reply.selection = request.selection;
+            reply.target    = request.target;
+            reply.property  = request.property;
+            reply.time      = request.time;
+
+            if (request.target == m_targets)
+            {
+                Atom supportedTargets[] = { m_targets, m_utf8String };
+                XChangeProperty(m_display, request.requestor, request.property, XA_ATOM, 32, PropModeReplace,
+                                reinterpret_cast<unsigned char*>(supportedTargets), 2);
+            }
+            else if ((request.target == m_utf8String) && (m_contents.size() > PartSize))
+            {
+                long size = static_cast<long>(m_contents.size());
+                XSelectInput(m_display, request.requestor, PropertyChangeMask);
+                XChangeProperty(m_display, request.requestor, request.property, m_incr, 32, PropModeReplace,
+                                reinterpret_cast<unsigned char*>(&size), 1);
+
+                m_sending = true;
+                m_requestor = request.requestor;
+                m_requestorProperty = request.property;
+                m_offset = 0;
+            }
+            else if (request.target == m_utf8String)
+            {
+                XChangeProperty(m_display, request.requestor, request.property, m_utf8String, 8, PropModeReplace,
+                                reinterpret_cast<const unsigned char*>(m_contents.data()), static_cast<int>(m_contents.size()));
+            }
+            else
+                reply.property = None;
+
+            XSendEvent(m_display, request.requestor, False, NoEventMask, reinterpret_cast<XEvent*>(&reply));
+            XFlush(m_display);
+        }
+
+        void sendNextPart()
+        {
+            const std::size_t size = std::min(PartSize, m_contents.size() - m_offset);
+            XChangeProperty(m_display, m_requestor, m_requestorProperty, m_utf8String, 8, PropModeReplace,
+                            reinterpret_cast<const unsigned char*>(m_contents.data() + m_offset), static_cast<int>(size));
+
+            m_offset += size;
+            if (size == 0)
+            {
+                XSelectInput(m_display, m_requestor, NoEventMask);
+                m_sending = false;
+            }
+
+            XFlush(m_display);
+        }
+
+      private:
+
+        Display* m_display;
+        Window   m_window;
+
+        Atom m_clipboard;
+        Atom m_targets;
+        Atom m_utf8String;
+        Atom m_incr;
+        Atom m_property;
+
+        std::string m_contents;
+
+        // The transfer that is being sent in parts
+        bool        m_sending;
+        Window      m_requestor;
+        Atom        m_requestorProperty;
+        std::size_t m_offset;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Lets both applications handle their events until the condition is met. Returns false when this takes too long.
+    template <typename Condition>
+    bool waitUntil(OtherApplication& other, tgui::Clipboard& clipboard, Condition condition)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!condition())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+
+            other.processEvents();
+            clipboard.update();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String fromUtf8(const std::string& utf8Text)
+    {
+        std::basic_string<sf::Uint32> text;
+        sf::Utf8::toUtf32(utf8Text.begin(), utf8Text.end(), std::back_inserter(text));
+        return sf::String(text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool check(bool condition, const char* message)
+    {
+        if (!condition)
+            std::cerr << "Clipboard test failed: " << message << std::endl;
+
+        return condition;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    Display* connection = XOpenDisplay(nullptr);
+    if (connection == nullptr)
+    {
+        std::cerr << "Clipboard test skipped: no X server" << std::endl;
+        return SkipTest;
+    }
+
+    OtherApplication other(connection);
+    tgui::Clipboard clipboard;
+
+    // A few megabytes of text with characters of every UTF-8 length, so that some of them are split between two parts
+    std::string bigText;
+    while (bigText.size() < 4 * 1024 * 1024)
+        bigText += "Clipboard \xC3\xA9\xC3\xA8 \xE2\x82\xAC \xF0\x9D\x84\x9E\n";
+
+    // Pasting the text of another application must not block, the contents are passed on by the update function
+    {
+        other.copy(bigText);
+
+        bool received = false;
+        sf::String contents;
+        clipboard.requestContents([&](const sf::String& text) { received = true; contents = text; });
+
+        // An application that only updates when needed has to know that it must keep checking the clipboard
+        sf::Time timeUntilUpdate;
+        if (!check(!received, "requestContents waited for the other application")
+         || !check(clipboard.getTimeUntilUpdate(timeUntilUpdate), "the clipboard doesn't report the waiting function")
+         || !check(timeUntilUpdate <= sf::seconds(1), "the clipboard asks to be updated too late")
+         || !check(waitUntil(other, clipboard, [&]{ return received; }), "the contents never arrived")
+         || !check(contents == fromUtf8(bigText), "the pasted contents differ from the copied text")
+         || !check(clipboard.get() == contents, "get doesn't return the received contents")
+         || !check(!clipboard.getTimeUntilUpdate(timeUntilUpdate), "the clipboard still reports a waiting function"))
+            return 1;
+    }
+
+    // Copying the text to another application
+    {
+        const std::string copiedText = bigText + "copied";
+        clipboard.set(fromUtf8(copiedText));
+
+        // The thread of the clipboard claims the ownership in the background
+        std::string pastedText;
+        bool pasted = false;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!pasted && (std::chrono::steady_clock::now() < deadline))
+            pasted = other.paste(pastedText) && (pastedText == copiedText);
+
+        if (!check(pasted, "the other application didn't get the copied text"))
+            return 1;
+    }
+
+    // An application that disappears in the middle of a transfer must not affect the clipboard or the rest of the application
+    {
+        Display* quitterConnection = XOpenDisplay(nullptr);
+        if (quitterConnection != nullptr)
+        {
+            OtherApplication* quitter = new OtherApplication(quitterConnection);
+            quitter->requestContents();
+            delete quitter;
+        }
+
+        std::string pastedText;
+        if (!check(other.paste(pastedText) && (pastedText == bigText + "copied"), "the clipboard stopped working"))
+            return 1;
+    }
+
+    // When the other application doesn't respond then the last known contents are used
+    {
+        other.copy("never sent");
+
+        // Give the clipboard the time to notice that it no longer owns the selection
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        const sf::String lastKnownContents = clipboard.get();
+
+        bool received = false;
+        sf::String contents;
+        clipboard.requestContents([&](const sf::String& text) { received = true; contents = text; });
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+        while (!received && (std::chrono::steady_clock::now() < deadline))
+        {
+            clipboard.update();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        if (!check(received, "the clipboard kept waiting for an application that doesn't respond")
+         || !check(contents == lastKnownContents, "the last known contents weren't used"))
+            return 1;
+    }
+
+    return 0;
+}